@@ -0,0 +1,146 @@
+#ifndef WHOT_BENCHMARKS_BENCH_COMMON_HPP
+#define WHOT_BENCHMARKS_BENCH_COMMON_HPP
+
+// Helpers shared by the benchmark programs; header-only because every
+// benchmark is its own executable.
+
+#include "Game/GameEngine.hpp"
+#include "Game/GameState.hpp"
+#include "Core/Player.hpp"
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace whot::bench {
+
+/// Reads `--name value` pairs into the fields registered with add(); other
+/// arguments are ignored.
+class Flags {
+public:
+    Flags(int argc, char** argv) : argc_(argc), argv_(argv) {}
+
+    Flags& add(const char* name, int& value) {
+        if (const char* v = find(name)) value = std::atoi(v);
+        return *this;
+    }
+    Flags& add(const char* name, size_t& value) {
+        if (const char* v = find(name)) value = std::strtoul(v, nullptr, 10);
+        return *this;
+    }
+    Flags& add(const char* name, bool& value) {
+        if (const char* v = find(name)) value = std::atoi(v) != 0;
+        return *this;
+    }
+    Flags& add(const char* name, std::string& value) {
+        if (const char* v = find(name)) value = v;
+        return *this;
+    }
+
+private:
+    const char* find(const char* name) const {
+        for (int i = 1; i + 1 < argc_; i += 2)
+            if (std::strcmp(argv_[i], name) == 0) return argv_[i + 1];
+        return nullptr;
+    }
+
+    int argc_;
+    char** argv_;
+};
+
+/// A lobby of `players` humans ("player-0", ...), dealt from `seed`.
+inline std::unique_ptr<game::GameState> gameWithPlayers(int players, uint64_t seed = 42) {
+    game::GameConfig config;
+    config.seed = seed;
+    auto state = std::make_unique<game::GameState>(config);
+    state->initialize();
+    for (int i = 0; i < players; ++i) {
+        state->addPlayer(std::make_unique<core::Player>(
+            "player-" + std::to_string(i), "Player" + std::to_string(i),
+            core::PlayerType::HUMAN));
+    }
+    return state;
+}
+
+/// gameWithPlayers() after GameEngine::startGame().
+inline std::unique_ptr<game::GameEngine> startedGame(int players, uint64_t seed = 42) {
+    auto engine = std::make_unique<game::GameEngine>(gameWithPlayers(players, seed));
+    engine->startGame();
+    return engine;
+}
+
+// The toJson() chain before JsonWriter and StateView: every Card, Hand and
+// Player dumps a nlohmann::json DOM that its parent parses back.
+inline std::string legacyCardJson(const core::Card& card) {
+    nlohmann::json j;
+    j["suit"] = core::suitToString(card.getSuit());
+    j["value"] = core::cardValueToString(card.getValue());
+    return j.dump();
+}
+
+inline std::string legacyHandJson(const core::Hand& hand) {
+    nlohmann::json j = nlohmann::json::array();
+    for (size_t i = 0; i < hand.size(); ++i) j.push_back(nlohmann::json::parse(legacyCardJson(hand.getCard(i))));
+    return j.dump();
+}
+
+inline std::string legacyPlayerJson(const core::Player& p) {
+    nlohmann::json j;
+    j["id"] = p.getId();
+    j["name"] = p.getName();
+    j["type"] = static_cast<int>(p.getType());
+    j["status"] = static_cast<int>(p.getStatus());
+    j["hand"] = nlohmann::json::parse(legacyHandJson(p.getHand()));
+    j["currentScore"] = p.getCurrentScore();
+    j["cumulativeScore"] = p.getCumulativeScore();
+    j["saidLastCard"] = p.hasSaidLastCard();
+    j["saidCheckUp"] = p.hasSaidCheckUp();
+    j["gamesPlayed"] = p.getGamesPlayed();
+    j["gamesWon"] = p.getGamesWon();
+    return j.dump();
+}
+
+/// toJsonForPlayer() the old way: a DOM per viewer, other hands masked.
+inline std::string legacyJsonForPlayer(game::GameState& state, const std::string& viewer) {
+    nlohmann::json j;
+    j["gameId"] = state.getGameId();
+    j["gameCode"] = state.getGameCode();
+    j["creatorPlayerId"] = state.getCreatorPlayerId();
+    j["phase"] = static_cast<int>(state.getPhase());
+    j["currentPlayerIndex"] = state.getCurrentPlayerIndex();
+    j["direction"] = state.getPlayDirection() == game::PlayDirection::CLOCKWISE
+        ? "clockwise" : "counter_clockwise";
+    j["activePickCount"] = state.getActivePickCount();
+    if (state.getDemandedSuit()) j["demandedSuit"] = core::suitToString(*state.getDemandedSuit());
+    j["players"] = nlohmann::json::array();
+    for (const auto* p : state.getAllPlayers()) {
+        nlohmann::json pj = nlohmann::json::parse(legacyPlayerJson(*p));
+        if (p->getId() != viewer) pj["hand"] = {{"count", p->getHand().size()}};
+        j["players"].push_back(std::move(pj));
+    }
+    if (state.getCallCard()) j["callCard"] = nlohmann::json::parse(legacyCardJson(*state.getCallCard()));
+    j["deckSize"] = state.getDeck().size();
+    j["discardPileSize"] = 1;  // no accessor; the value does not affect cost
+    if (auto winner = state.getWinnerId()) j["winnerId"] = *winner;
+    return j.dump();
+}
+
+/// Runs `run` (which returns the bytes it produced) `iterations` times and
+/// prints the last size and the mean time per call.
+template <typename F>
+void report(const char* name, int iterations, F&& run) {
+    size_t bytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) bytes = run();
+    const double us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count() / iterations;
+    std::printf("  %-8s %6zu B  %8.2f us\n", name, bytes, us);
+}
+
+} // namespace whot::bench
+
+#endif // WHOT_BENCHMARKS_BENCH_COMMON_HPP
@@ -0,0 +1,105 @@
+// Response compression benchmark.
+//
+// Builds bodies shaped like the real API responses (/api/games,
+// /api/leaderboard, /api/games/:id) and reports, per route and setting, the
+// bytes saved and the CPU spent compressing one response.
+//
+//   whot_bench_compression [--games N] [--players P] [--iterations I]
+
+#include "BenchCommon.hpp"
+#include "Utils/Compression.hpp"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using whot::utils::Compression;
+
+namespace {
+
+struct Options {
+    int games = 200;
+    int players = 4;
+    int iterations = 200;
+};
+
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    whot::bench::Flags(argc, argv)
+        .add("--games", o.games)
+        .add("--players", o.players)
+        .add("--iterations", o.iterations);
+    return o;
+}
+
+std::string gamesBody(int games) {
+    std::vector<nlohmann::json> arr;
+    for (int i = 0; i < games; ++i) {
+        nlohmann::json o;
+        o["gameId"] = "game-" + std::to_string(100000 + i * 7919);
+        o["phase"] = i % 3;
+        o["playerCount"] = 1 + i % 4;
+        o["maxPlayers"] = 4;
+        o["joinable"] = i % 3 == 0;
+        arr.push_back(std::move(o));
+    }
+    return nlohmann::json(arr).dump();
+}
+
+std::string leaderboardBody() {
+    std::vector<nlohmann::json> arr;
+    for (int i = 0; i < 100; ++i) {
+        nlohmann::json o;
+        o["playerId"] = "player-" + std::to_string(i * 104729 % 99991);
+        o["playerName"] = "Player" + std::to_string(i);
+        o["totalGames"] = 50 + i * 3;
+        o["gamesWon"] = 10 + i;
+        o["totalScore"] = 1200 - i * 7;
+        o["winRate"] = (10.0 + i) / (50.0 + i * 3);
+        arr.push_back(std::move(o));
+    }
+    return nlohmann::json(arr).dump();
+}
+
+std::string gameStateBody(int players) {
+    return whot::bench::startedGame(players)->getState()->toJson();
+}
+
+double cpuMicros() {
+    return static_cast<double>(std::clock()) * 1e6 / CLOCKS_PER_SEC;
+}
+
+void report(const char* route, const std::string& body, int iterations) {
+    struct Setting {
+        const char* name;
+        Compression::Format format;
+        int level;
+    };
+    const Setting settings[] = {
+        {"gzip-1", Compression::Format::GZIP, 1},
+        {"gzip-6", Compression::Format::GZIP, 6},
+        {"gzip-9", Compression::Format::GZIP, 9},
+        {"deflate-6", Compression::Format::ZLIB, 6},
+    };
+    std::printf("%-18s raw=%7zu B\n", route, body.size());
+    for (const Setting& s : settings) {
+        size_t out = 0;
+        const double t0 = cpuMicros();
+        for (int i = 0; i < iterations; ++i) out = Compression::compress(body, s.format, s.level).size();
+        const double perCall = (cpuMicros() - t0) / iterations;
+        std::printf("  %-10s %7zu B  %5.1f%% of raw  %7.1f us cpu  %6.1f B saved/us\n", s.name, out,
+                    100.0 * static_cast<double>(out) / static_cast<double>(body.size()), perCall,
+                    perCall > 0 ? static_cast<double>(body.size() - out) / perCall : 0.0);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt = parseArgs(argc, argv);
+    report("/api/games", gamesBody(opt.games), opt.iterations);
+    report("/api/leaderboard", leaderboardBody(), opt.iterations);
+    report("/api/games/:id", gameStateBody(opt.players), opt.iterations);
+    return 0;
+}
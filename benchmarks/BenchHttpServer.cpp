@@ -0,0 +1,170 @@
+// HTTP server throughput/latency benchmark.
+//
+// Starts an in-process HttpServer with a small JSON route and drives it from
+// N client threads, each issuing sequential requests on fresh connections
+// (or, with --keep-alive 1, on one persistent connection per client).
+// Reports requests/sec and p50/p99/max latency.
+//
+//   whot_bench_http [--clients N] [--requests M] [--threads T] [--keep-alive 0|1]
+
+#include "BenchCommon.hpp"
+#include "Network/HTTPServer.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace whot::network;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    int clients = 32;
+    int requestsPerClient = 500;
+    size_t serverThreads = 0;
+    bool keepAlive = false;
+};
+
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    whot::bench::Flags(argc, argv)
+        .add("--clients", o.clients)
+        .add("--requests", o.requestsPerClient)
+        .add("--threads", o.serverThreads)
+        .add("--keep-alive", o.keepAlive);
+    return o;
+}
+
+int connectTo(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/// One request on a persistent connection: reads headers plus Content-Length
+/// body. `closing` reports whether the server is about to close the socket.
+bool requestOn(int fd, const std::string& req, bool& closing) {
+    if (send(fd, req.data(), req.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(req.size()))
+        return false;
+    std::string resp;
+    char buf[4096];
+    for (;;) {
+        size_t headerEnd = resp.find("\r\n\r\n");
+        if (headerEnd != std::string::npos) {
+            size_t cl = resp.find("Content-Length: ");
+            size_t len = cl < headerEnd ? std::strtoul(resp.c_str() + cl + 16, nullptr, 10) : 0;
+            if (resp.size() >= headerEnd + 4 + len) {
+                closing = resp.find("Connection: close") < headerEnd;
+                return resp.rfind("HTTP/1.1 200", 0) == 0;
+            }
+        }
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) return false;
+        resp.append(buf, static_cast<size_t>(n));
+    }
+}
+
+bool request(uint16_t port, const std::string& req) {
+    int fd = connectTo(port);
+    if (fd < 0) return false;
+    bool ok = false;
+    if (send(fd, req.data(), req.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(req.size())) {
+        char buf[4096];
+        std::string resp;
+        ssize_t n;
+        while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) resp.append(buf, static_cast<size_t>(n));
+        ok = resp.rfind("HTTP/1.1 200", 0) == 0;
+    }
+    close(fd);
+    return ok;
+}
+
+double percentile(std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[idx];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt = parseArgs(argc, argv);
+
+    HttpServer server(0);
+    server.setWorkerThreads(opt.serverThreads);
+    server.setMaxConnections(static_cast<size_t>(opt.clients) * 2);
+    server.addRoute(HttpMethod::GET, "/api/health", [](const HttpRequest&) {
+        return HttpResponse::json(200, "{\"status\":\"ok\"}");
+    });
+    server.start();
+    if (!server.isRunning()) {
+        std::fprintf(stderr, "failed to start server\n");
+        return 1;
+    }
+    const uint16_t port = server.getPort();
+    const std::string req = opt.keepAlive
+        ? "GET /api/health HTTP/1.1\r\nHost: localhost\r\n\r\n"
+        : "GET /api/health HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n";
+
+    std::vector<std::vector<double>> latencies(static_cast<size_t>(opt.clients));
+    std::atomic<int> failures{0};
+    std::vector<std::thread> clients;
+    const auto begin = Clock::now();
+    for (int c = 0; c < opt.clients; ++c) {
+        clients.emplace_back([&, c] {
+            auto& lat = latencies[static_cast<size_t>(c)];
+            lat.reserve(static_cast<size_t>(opt.requestsPerClient));
+            int fd = opt.keepAlive ? connectTo(port) : -1;
+            for (int i = 0; i < opt.requestsPerClient; ++i) {
+                const auto t0 = Clock::now();
+                bool ok;
+                if (opt.keepAlive) {
+                    if (fd < 0) fd = connectTo(port);  // reconnect after max-requests close
+                    bool closing = false;
+                    ok = fd >= 0 && requestOn(fd, req, closing);
+                    if ((!ok || closing) && fd >= 0) {
+                        close(fd);
+                        fd = -1;
+                    }
+                } else {
+                    ok = request(port, req);
+                }
+                if (!ok) ++failures;
+                lat.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+            }
+            if (fd >= 0) close(fd);
+        });
+    }
+    for (auto& t : clients) t.join();
+    const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    server.stop();
+
+    std::vector<double> all;
+    for (auto& lat : latencies) all.insert(all.end(), lat.begin(), lat.end());
+    std::sort(all.begin(), all.end());
+    std::printf("clients=%d requests=%zu failures=%d\n", opt.clients, all.size(), failures.load());
+    std::printf("throughput: %.0f req/s\n", static_cast<double>(all.size()) / seconds);
+    std::printf("latency us: p50=%.0f p99=%.0f max=%.0f\n",
+                percentile(all, 0.50), percentile(all, 0.99), all.empty() ? 0.0 : all.back());
+    return failures.load() == 0 ? 0 : 1;
+}
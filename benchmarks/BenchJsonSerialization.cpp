@@ -0,0 +1,81 @@
+// Game state JSON serialization benchmark.
+//
+// Builds a started game and reports us per GameState::toJson() and per
+// toJsonForPlayer(), rendered the old way (every Card, Hand and Player
+// dumps a nlohmann::json DOM that its parent parses back) and the current
+// way (everything appends to one utils::JsonWriter buffer). The state is
+// touched before each current render so its memoized output is not reused.
+//
+//   whot_bench_jsonserialization [--players P] [--iterations I]
+
+#include "BenchCommon.hpp"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <string>
+
+using json = nlohmann::json;
+using whot::bench::legacyCardJson;
+using whot::bench::legacyJsonForPlayer;
+using whot::bench::legacyPlayerJson;
+using whot::bench::report;
+using whot::bench::startedGame;
+
+namespace {
+
+struct Options {
+    int players = 4;
+    int iterations = 20000;
+};
+
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    whot::bench::Flags(argc, argv).add("--players", o.players).add("--iterations", o.iterations);
+    return o;
+}
+
+// toJson() the old way, on the BenchCommon.hpp DOM chain.
+std::string legacyStateJson(whot::game::GameState& state) {
+    json j;
+    j["gameId"] = state.getGameId();
+    j["gameCode"] = state.getGameCode();
+    j["creatorPlayerId"] = state.getCreatorPlayerId();
+    j["seed"] = state.getSeed();
+    j["phase"] = static_cast<int>(state.getPhase());
+    j["currentPlayerIndex"] = state.getCurrentPlayerIndex();
+    j["direction"] = state.getPlayDirection() == whot::game::PlayDirection::CLOCKWISE
+        ? "clockwise" : "counter_clockwise";
+    j["activePickCount"] = state.getActivePickCount();
+    if (state.getDemandedSuit()) j["demandedSuit"] = whot::core::suitToString(*state.getDemandedSuit());
+    j["players"] = json::array();
+    for (const auto* p : state.getAllPlayers()) j["players"].push_back(json::parse(legacyPlayerJson(*p)));
+    if (state.getCallCard()) j["callCard"] = json::parse(legacyCardJson(*state.getCallCard()));
+    j["deckSize"] = state.getDeck().size();
+    j["discardPileSize"] = 1;  // no accessor; the value does not affect cost
+    if (auto winner = state.getWinnerId()) j["winnerId"] = *winner;
+    return j.dump();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options opt = parseArgs(argc, argv);
+    auto engine = startedGame(opt.players);
+    whot::game::GameState& state = *engine->getState();
+    whot::core::Player& host = *state.getPlayer("player-0");
+    bool saidLastCard = false;
+
+    std::printf("GameState::toJson, %d players\n", opt.players);
+    report("dom", opt.iterations, [&] { return legacyStateJson(state).size(); });
+    report("writer", opt.iterations, [&] {
+        host.setSaidLastCard(saidLastCard = !saidLastCard);
+        return state.toJson().size();
+    });
+
+    std::printf("GameState::toJsonForPlayer, %d players\n", opt.players);
+    report("dom", opt.iterations, [&] { return legacyJsonForPlayer(state, "player-0").size(); });
+    report("writer", opt.iterations, [&] {
+        host.setSaidLastCard(saidLastCard = !saidLastCard);
+        return state.toJsonForPlayer("player-0").size();
+    });
+    return 0;
+}
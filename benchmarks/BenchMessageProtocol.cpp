@@ -0,0 +1,180 @@
+// WebSocket wire protocol benchmark.
+//
+// Builds a started game and reports, per GAME_STATE_UPDATE frame and per
+// inbound PLAY_CARD frame, the bytes and CPU of the JSON text protocol
+// against the binary "whot.bin.1" protocol, plus the GAME_STATE_PATCHes
+// patch-applying JSON clients get for one draw (each whole view diffed, or
+// the shared part diffed once per broadcast and a hand per player), and the
+// CPU to render one broadcast's JSON views for every player (per-viewer
+// nlohmann rendering, the previous code, against StateView, freshly rendered
+// and memoized).
+//
+//   whot_bench_messageprotocol [--players P] [--iterations I]
+
+#include "BenchCommon.hpp"
+#include "Network/MessageProtocol.hpp"
+#include "Network/StateDelta.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using whot::network::Message;
+using whot::network::MessageType;
+using whot::network::PayloadFormat;
+using whot::network::PlayCardPayload;
+using whot::bench::legacyJsonForPlayer;
+using whot::bench::report;
+using whot::bench::startedGame;
+
+namespace {
+
+struct Options {
+    int players = 4;
+    int iterations = 20000;
+};
+
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    whot::bench::Flags(argc, argv).add("--players", o.players).add("--iterations", o.iterations);
+    return o;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options opt = parseArgs(argc, argv);
+    auto engine = startedGame(opt.players);
+    whot::game::GameState& state = *engine->getState();
+    const std::string gameId = state.getGameId();
+    // Toggled before a render to defeat the state's memoized views.
+    whot::core::Player& host = *state.getPlayer("player-0");
+    bool saidLastCard = false;
+
+    std::printf("GAME_STATE_UPDATE, %d players (render + frame)\n", opt.players);
+    report("json", opt.iterations, [&] {
+        Message m;
+        m.type = MessageType::GAME_STATE_UPDATE;
+        m.gameId = gameId;
+        m.timestamp = 1;
+        host.setSaidLastCard(saidLastCard = !saidLastCard);
+        m.payload = "{\"gameState\":" + state.toJsonForPlayer("player-0") + "}";
+        return m.serialize().size();
+    });
+    report("binary", opt.iterations, [&] {
+        Message m;
+        m.type = MessageType::GAME_STATE_UPDATE;
+        m.gameId = gameId;
+        m.timestamp = 1;
+        m.payloadFormat = PayloadFormat::BINARY;
+        host.setSaidLastCard(saidLastCard = !saidLastCard);
+        m.payload = state.toBinaryForPlayer("player-0");
+        return m.encode().size();
+    });
+
+    // Alternate between the views before and after one draw, so every
+    // update is a patch. Captured as text: a StateView reads live hands.
+    struct Render {
+        std::string shared;
+        std::vector<std::string> views;
+        std::vector<std::string> hands;
+    };
+    auto capture = [&] {
+        const auto& view = state.renderView(whot::game::StateView::Format::JSON);
+        Render r{view.shared(), {}, {}};
+        for (int p = 0; p < opt.players; ++p) {
+            const std::string id = "player-" + std::to_string(p);
+            r.views.push_back(view.forPlayer(id));
+            r.hands.push_back(view.seatOf(id)->hand);
+        }
+        return r;
+    };
+    const Render renders[2] = {
+        capture(),
+        [&] {
+            whot::game::GameAction draw;
+            draw.type = whot::game::ActionType::DRAW_CARD;
+            draw.playerId = state.getCurrentPlayer()->getId();
+            engine->processAction(draw);
+            return capture();
+        }()};
+    whot::network::StateStreams streams;
+    for (int p = 0; p < opt.players; ++p) {
+        const std::string id = "player-" + std::to_string(p);
+        streams.open(id);
+        streams.next(id, renders[0].views[p]);
+    }
+    int turn = 0;
+    auto patchFrame = [&](const std::string& payload) {
+        Message m;
+        m.type = MessageType::GAME_STATE_PATCH;
+        m.gameId = gameId;
+        m.timestamp = 1;
+        m.payload = payload;
+        return m.serialize().size();
+    };
+    std::printf("GAME_STATE_PATCH to all %d players after one draw (diff + frames, views pre-rendered)\n",
+                opt.players);
+    report("view", opt.iterations, [&] {
+        const Render& r = renders[++turn % 2];
+        size_t bytes = 0;
+        for (int p = 0; p < opt.players; ++p)
+            bytes += patchFrame(streams.next("player-" + std::to_string(p), r.views[p])->payload);
+        return bytes;
+    });
+    report("frame", opt.iterations, [&] {
+        const Render& r = renders[++turn % 2];
+        whot::network::StateStreams::Frame frame(r.shared);
+        size_t bytes = 0;
+        for (int p = 0; p < opt.players; ++p) {
+            bytes += patchFrame(streams.next("player-" + std::to_string(p), frame, r.views[p],
+                                             static_cast<size_t>(p), r.hands[p])->payload);
+        }
+        return bytes;
+    });
+
+    std::printf("Broadcast of JSON views to all %d players\n", opt.players);
+    report("legacy", opt.iterations, [&] {
+        size_t bytes = 0;
+        for (int p = 0; p < opt.players; ++p)
+            bytes += legacyJsonForPlayer(state, "player-" + std::to_string(p)).size();
+        return bytes;
+    });
+    report("view", opt.iterations, [&] {
+        host.setSaidLastCard(saidLastCard = !saidLastCard);
+        const auto& view = state.renderView(whot::game::StateView::Format::JSON);
+        size_t bytes = 0;
+        for (int p = 0; p < opt.players; ++p) bytes += view.forPlayer("player-" + std::to_string(p)).size();
+        return bytes;
+    });
+    report("cached", opt.iterations, [&] {
+        const auto& view = state.renderView(whot::game::StateView::Format::JSON);
+        size_t bytes = 0;
+        for (int p = 0; p < opt.players; ++p) bytes += view.forPlayer("player-" + std::to_string(p)).size();
+        return bytes;
+    });
+
+    PlayCardPayload play;
+    play.cardIndex = 3;
+    play.chosenSuit = whot::core::Suit::STAR;
+    Message in;
+    in.type = MessageType::PLAY_CARD;
+    in.playerId = "player-0";
+    in.gameId = gameId;
+    in.timestamp = 1;
+    in.payload = play.toJson();
+    const std::string jsonFrame = in.serialize();
+    in.payloadFormat = PayloadFormat::BINARY;
+    in.payload = play.toBinary();
+    const std::string binaryFrame = in.encode();
+
+    std::printf("PLAY_CARD inbound (parse frame + payload)\n");
+    report("json", opt.iterations, [&] {
+        Message m = Message::deserialize(jsonFrame);
+        return jsonFrame.size() + whot::network::decodePayload<PlayCardPayload>(m)->cardIndex * 0;
+    });
+    report("binary", opt.iterations, [&] {
+        Message m = Message::decode(binaryFrame);
+        return binaryFrame.size() + whot::network::decodePayload<PlayCardPayload>(m)->cardIndex * 0;
+    });
+    return 0;
+}
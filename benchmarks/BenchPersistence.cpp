@@ -0,0 +1,124 @@
+// Game persistence benchmark.
+//
+// Saves a started game after every simulated move into a SQLite file and
+// reports, per move, the time the calling (game strand) thread spends:
+// synchronously through GameRepository::saveGame (one autocommit
+// transaction, so one fsync, per move), and through WriteBehindQueue, which
+// only serializes the state and hands it to the writer thread. The queued
+// run is flushed before its total is taken, so "total" includes the writes.
+// Each run also reports the prepared-statement cache (--statement-cache 0
+// prepares every statement afresh, as before the cache).
+//
+//   whot_bench_persistence [--games G] [--moves M] [--db PATH] [--statement-cache N]
+
+#include "BenchCommon.hpp"
+#include "Persistence/Database.hpp"
+#include "Persistence/GameRepository.hpp"
+#include "Persistence/WriteBehindQueue.hpp"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    int games = 8;
+    int moves = 200;
+    std::string db = "whot_bench_persistence.db";
+    size_t statementCache = 32;
+};
+
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    whot::bench::Flags(argc, argv)
+        .add("--games", o.games)
+        .add("--moves", o.moves)
+        .add("--db", o.db)
+        .add("--statement-cache", o.statementCache);
+    return o;
+}
+
+std::vector<std::unique_ptr<whot::game::GameState>> startedGames(int count) {
+    std::vector<std::unique_ptr<whot::game::GameState>> games;
+    for (int g = 0; g < count; ++g) {
+        auto state = whot::bench::gameWithPlayers(4, 42 + g);
+        state->startRound();
+        games.push_back(std::move(state));
+    }
+    return games;
+}
+
+std::unique_ptr<whot::persistence::Database> openDatabase(const Options& opt) {
+    std::remove(opt.db.c_str());
+    whot::persistence::DatabaseConfig config;
+    config.type = whot::persistence::DatabaseType::SQLITE;
+    config.filepath = opt.db;
+    config.statementCacheSize = opt.statementCache;
+    auto db = whot::persistence::DatabaseFactory::create(config);
+    if (!db || !db->connect()) return nullptr;
+    db->initializeSchema();
+    return db;
+}
+
+void reportStatements(const whot::persistence::Database& db) {
+    const auto stats = db.getStatementCacheStats();
+    std::printf("           statements: %llu hits, %llu prepared, %.1f us preparing\n",
+                static_cast<unsigned long long>(stats.hits),
+                static_cast<unsigned long long>(stats.misses),
+                std::chrono::duration<double, std::micro>(stats.prepareTime).count());
+}
+
+/// Round-robin moves over the games, calling `save` after each.
+template <typename Save, typename Finish>
+void run(const char* name, const Options& opt, Save&& save, Finish&& finish) {
+    auto games = startedGames(opt.games);
+    double callerNs = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int m = 0; m < opt.moves; ++m) {
+        whot::game::GameState& state = *games[m % games.size()];
+        state.advanceTurn();
+        const auto before = std::chrono::steady_clock::now();
+        save(state);
+        callerNs += std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - before).count();
+    }
+    finish();
+    const double totalMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    std::printf("  %-8s caller %9.0f ns/move   total %8.1f ms\n", name, callerNs / opt.moves, totalMs);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options opt = parseArgs(argc, argv);
+    if (opt.games <= 0 || opt.moves <= 0) return 1;
+    std::printf("Save after every move, %d games, %d moves, %s\n", opt.games, opt.moves, opt.db.c_str());
+
+    {
+        auto db = openDatabase(opt);
+        if (!db) return 1;
+        whot::persistence::GameRepository repo(db.get());
+        run("sync", opt, [&](const whot::game::GameState& s) { repo.saveGame(s); }, [] {});
+        reportStatements(*db);
+    }
+    {
+        auto db = openDatabase(opt);
+        if (!db) return 1;
+        whot::persistence::GameRepository repo(db.get());
+        whot::persistence::WriteBehindQueue queue(*db, repo);
+        queue.start();
+        run("queued", opt, [&](const whot::game::GameState& s) { queue.saveGame(s); },
+            [&] { queue.flush(); });
+        const auto stats = queue.getStats();
+        std::printf("  queued: %llu writes in %llu transactions, %llu coalesced\n",
+                    static_cast<unsigned long long>(stats.written),
+                    static_cast<unsigned long long>(stats.batches),
+                    static_cast<unsigned long long>(stats.coalesced));
+        reportStatements(*db);
+    }
+    std::remove(opt.db.c_str());
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Route lookup benchmark.
+//
+// Registers the real API routes plus N synthetic ones (/api/admin/rK/:id,
+// /api/stats/rK, ...) and reports ns per lookup for a mix of request paths,
+// next to a linear scan over the same patterns (the previous router).
+//
+//   whot_bench_router [--routes N] [--lookups L]
+
+#include "BenchCommon.hpp"
+#include "Network/Router.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using whot::network::HttpMethod;
+using whot::network::PathParams;
+using whot::network::Router;
+
+namespace {
+
+struct Options {
+    int routes = 1000;
+    int lookups = 2000000;
+};
+
+Options parseArgs(int argc, char** argv) {
+    Options o;
+    whot::bench::Flags(argc, argv).add("--routes", o.routes).add("--lookups", o.lookups);
+    return o;
+}
+
+std::vector<std::pair<HttpMethod, std::string>> routeTable(int synthetic) {
+    std::vector<std::pair<HttpMethod, std::string>> routes = {
+        {HttpMethod::GET, "/api/games"},
+        {HttpMethod::POST, "/api/games"},
+        {HttpMethod::GET, "/api/health"},
+        {HttpMethod::POST, "/api/games/join"},
+        {HttpMethod::POST, "/api/games/cleanup-stale"},
+        {HttpMethod::GET, "/api/leaderboard"},
+    };
+    static const char* kGroups[] = {"admin", "stats", "replays", "players"};
+    for (int i = 0; i < synthetic; ++i) {
+        const std::string base = std::string("/api/") + kGroups[i % 4] + "/r" + std::to_string(i);
+        routes.emplace_back(HttpMethod::GET, i % 2 ? base + "/:id" : base);
+    }
+    routes.emplace_back(HttpMethod::GET, "/api/games/:id");
+    routes.emplace_back(HttpMethod::POST, "/api/games/:id/join");
+    return routes;
+}
+
+/// The pre-trie matcher: exact compare or ':' segments, one pattern at a time.
+bool linearMatch(std::string_view pattern, std::string_view path, PathParams& params) {
+    params.clear();
+    size_t pi = 0, qi = 0;
+    while (pi < pattern.size() && qi < path.size()) {
+        if (pattern[pi] == ':') {
+            size_t nameEnd = pattern.find('/', pi);
+            if (nameEnd == std::string_view::npos) nameEnd = pattern.size();
+            size_t valueEnd = path.find('/', qi);
+            if (valueEnd == std::string_view::npos) valueEnd = path.size();
+            params.add(pattern.substr(pi + 1, nameEnd - pi - 1), path.substr(qi, valueEnd - qi));
+            pi = nameEnd;
+            qi = valueEnd;
+            continue;
+        }
+        if (pattern[pi++] != path[qi++]) return false;
+    }
+    return pi == pattern.size() && qi == path.size();
+}
+
+template <typename F>
+double nsPerLookup(int lookups, F&& lookup) {
+    const auto start = std::chrono::steady_clock::now();
+    size_t hits = 0;
+    for (int i = 0; i < lookups; ++i) hits += lookup(i);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (hits == 0) std::printf("(no hits)\n");
+    return std::chrono::duration<double, std::nano>(elapsed).count() / lookups;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options opts = parseArgs(argc, argv);
+    const auto routes = routeTable(opts.routes);
+    Router router;
+    for (size_t i = 0; i < routes.size(); ++i)
+        router.add(routes[i].first, routes[i].second, static_cast<Router::RouteId>(i));
+
+    const std::vector<std::pair<HttpMethod, std::string>> requests = {
+        {HttpMethod::GET, "/api/games"},
+        {HttpMethod::GET, "/api/games/2b1f0c8e-5d7a-4c11-9e35-0f6a7d2c9b40"},
+        {HttpMethod::POST, "/api/games/2b1f0c8e-5d7a-4c11-9e35-0f6a7d2c9b40/join"},
+        {HttpMethod::GET, "/api/leaderboard"},
+        {HttpMethod::GET, "/api/health"},
+        {HttpMethod::GET, "/index.html"},
+    };
+    PathParams params;
+    const double trie = nsPerLookup(opts.lookups, [&](int i) {
+        const auto& [method, path] = requests[i % requests.size()];
+        return router.find(method, path, params).route != Router::kNoRoute;
+    });
+    const double linear = nsPerLookup(opts.lookups / 10, [&](int i) {
+        const auto& [method, path] = requests[i % requests.size()];
+        for (const auto& [m, pattern] : routes) {
+            if (m == method && linearMatch(pattern, path, params)) return true;
+        }
+        return false;
+    });
+    std::printf("routes=%zu  trie: %.0f ns/lookup  linear scan: %.0f ns/lookup\n",
+                routes.size(), trie, linear);
+    return 0;
+}
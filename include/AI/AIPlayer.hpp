@@ -15,7 +15,7 @@ public:
     AIPlayer(const std::string& id, const std::string& name, 
              DifficultyLevel difficulty);
     
-    // Decision making
+    // Decision making (returns immediately; callers apply the thinking delay)
     game::GameAction decideAction(const game::GameState& state);
     
     // Specific decisions
@@ -31,6 +31,7 @@ public:
     
     // Behavior
     void setThinkingDelay(int milliseconds);  // Simulate human-like delay
+    int getThinkingDelay() const;
     
 private:
     std::string id_;
@@ -3,14 +3,19 @@
 
 #include "Network/WebSocketServer.hpp"
 #include "Network/HTTPServer.hpp"
+#include "Network/StateDelta.hpp"
 #include "Game/GameEngine.hpp"
 #include "Persistence/Database.hpp"
 #include "Persistence/GameRepository.hpp"
 #include "Persistence/PlayerRepository.hpp"
+#include "Persistence/WriteBehindQueue.hpp"
+#include "Utils/Executor.hpp"
+#include "Utils/TimerQueue.hpp"
 #include <memory>
 #include <map>
 #include <string>
 #include <chrono>
+#include <optional>
 
 namespace whot {
 
@@ -19,10 +24,24 @@ struct ApplicationConfig {
     uint16_t httpPort = 8081;
     std::string staticFilesPath = "./web";
     persistence::DatabaseConfig dbConfig;
+    /// Batching of game and player writes once run() starts the writer.
+    persistence::WriteQueueConfig writeQueue;
     int maxGamesPerServer = 100;
     int maxPlayersPerGame = 8;
     bool enableAI = true;
     std::string logFilePath = "./logs/whot.log";
+    /// Worker threads shared by all game strands (0 = hardware concurrency).
+    size_t gameWorkerThreads = 0;
+    /// WebSocket IO threads (0 = hardware concurrency).
+    size_t wsIoThreads = 0;
+    /// HTTP handler threads (0 = hardware concurrency) and open-connection cap.
+    size_t httpWorkerThreads = 0;
+    size_t httpMaxConnections = 4096;
+    /// Keep-alive idle timeout (seconds) and requests served per connection.
+    int httpIdleTimeoutSeconds = 65;
+    size_t httpMaxRequestsPerConnection = 1000;
+    /// gzip/deflate JSON responses of 1 KiB or more when the client accepts it.
+    bool httpCompression = true;
 };
 
 class Application {
@@ -40,6 +59,8 @@ public:
     bool joinGame(const std::string& gameId, const std::string& playerId,
                   const std::string& playerName = "");
     void addBotsToGame(const std::string& gameId, int botCount);
+    /// Schedule the current bot's turn after its thinking delay; each played
+    /// bot turn schedules the next one until a human is to move.
     void runBotTurnsIfNeeded(const std::string& gameId);
     /// Resolve gameId from game code (empty if not found).
     std::string getGameIdByCode(const std::string& gameCode) const;
@@ -66,10 +87,38 @@ private:
     std::unique_ptr<persistence::Database> database_;
     std::unique_ptr<persistence::GameRepository> gameRepo_;
     std::unique_ptr<persistence::PlayerRepository> playerRepo_;
+    // All writes go through here; reads still use the repositories directly.
+    // Declared after them so it is stopped (and drained) first.
+    std::unique_ptr<persistence::WriteBehindQueue> writeQueue_;
     
     std::map<std::string, std::unique_ptr<game::GameEngine>> activeGames_;
     std::map<std::string, std::chrono::steady_clock::time_point> gameActivity_;
+    // What code off the game's strand (listings, code lookup, lobby cleanup)
+    // may know about a game. GameState is strand-confined, so these are
+    // copied out after every strand task (publishGameSummary).
+    struct GameSummary {
+        game::GamePhase phase = game::GamePhase::LOBBY;
+        size_t playerCount = 0;
+        int maxPlayers = 0;
+        std::string gameCode;
+    };
+    static GameSummary summarize(const game::GameState& state);
+    std::map<std::string, GameSummary> gameSummaries_;
     mutable std::mutex gamesMutex_;
+
+    // Every mutation of a game runs on that game's strand; strands share the pool.
+    // Declared after the game maps so the pool (and the bot timers below) stop
+    // before the games they work on are destroyed.
+    std::map<std::string, std::shared_ptr<utils::Strand>> gameStrands_;
+    std::unique_ptr<utils::WorkerPool> workerPool_;
+
+    // Pending bot turn per game (guarded by gamesMutex_). Timer callbacks only
+    // post playBotTurn to the game's strand, so no thread sleeps for a bot.
+    std::map<std::string, utils::TimerQueue::TimerId> pendingBotTurns_;
+    std::unique_ptr<utils::TimerQueue> botTimers_;
+
+    // Patch streams of JSON sessions that joined with statePatches.
+    network::StateStreams stateStreams_;
     
     // Initialization helpers
     void setupWebSocketHandlers();
@@ -86,10 +135,40 @@ private:
                          const network::Message& message);
     void handleGameAction(const std::string& sessionId,
                           const network::Message& message);
+    void handleStateResync(const std::string& sessionId);
+    
+    // Game strands
+    std::shared_ptr<utils::Strand> getGameStrand(const std::string& gameId) const;
+    /// Queue a task on the game's strand; false if the game does not exist.
+    bool postToGame(const std::string& gameId, utils::Task task);
+    /// Run a task on the game's strand and wait for it (runs directly when
+    /// already on that strand); false if the game does not exist.
+    bool runOnGame(const std::string& gameId, const utils::Task& task);
+    /// Refresh gameSummaries_ from the state; call on the game's strand.
+    void publishGameSummary(const std::string& gameId);
+
+    // Bot turns (run on the game's strand)
+    void scheduleBotTurn(const std::string& gameId, int streak);
+    void playBotTurn(const std::string& gameId, const std::string& botId, int streak);
     
     // Utility
+    /// Queues the state and the journal bytes recorded since the last save;
+    /// call on the game's strand.
+    void saveGame(game::GameEngine& engine);
     void touchGameActivity(const std::string& gameId);
     void broadcastGameState(const std::string& gameId);
+    /// Views of one state, each rendered on first use and shared by every
+    /// session of a broadcast.
+    struct StateViews {
+        const game::StateView* json = nullptr;
+        const game::StateView* binary = nullptr;
+        std::optional<network::StateStreams::Frame> frame;  // json's shared part, for patches
+    };
+    /// State update for one session: binary snapshot, JSON patch or snapshot
+    /// (StateStreams), or a plain JSON snapshot. nullopt if nothing changed.
+    std::optional<network::Message> makeStateUpdate(const game::GameState& state, StateViews& views,
+                                                    const std::string& sessionId,
+                                                    const std::string& playerId, uint64_t timestamp);
     void cleanupInactiveGames();
 
     // HTTP API handlers (used by HttpServer routes)
@@ -2,11 +2,18 @@
 #define WHOT_CORE_CARD_HPP
 
 #include "GameConstants.hpp"
-#include <memory>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <type_traits>
+
+namespace whot::utils { class JsonWriter; class ByteWriter; class ByteReader; }
 
 namespace whot::core {
 
+/// Two-byte value type: packed suit/value plus the card identity used to index
+/// the compile-time tables in GameConstants, so cards live inline in
+/// Deck/Hand/GameState vectors, copy like integers, and rule checks are lookups.
 class Card {
 public:
     Card(Suit suit, CardValue value);
@@ -18,6 +25,7 @@ public:
     SpecialAbility getSpecialAbility() const;
     bool isWhotCard() const;
     bool isStarCard() const;
+    size_t getIdentity() const;  // Index into the GameConstants card tables
     
     int getOuterStarValue() const;  // For star cards
     int getInnerStarValue() const;  // Doubled value for stars
@@ -28,19 +36,27 @@ public:
 
     std::string toString() const;
     std::string toJson() const;
-    static std::unique_ptr<Card> fromJson(const std::string& json);
+    /// Appends toJson() to `w`; parents nest cards without a round trip.
+    void writeJson(utils::JsonWriter& w) const;
+    static Card fromJson(const std::string& json);
+    /// One byte, suit in the top 3 bits and face value in the low 5; the
+    /// card encoding of the binary protocol and snapshots.
+    uint8_t toByte() const { return packed_; }
+    /// nullopt unless `byte` is a real Whot suit and value.
+    static std::optional<Card> fromByte(uint8_t byte);
     
     bool operator==(const Card& other) const;
     bool operator!=(const Card& other) const;
     
 private:
-    Suit suit_;
-    CardValue value_;
-    SpecialAbility specialAbility_;
-    
-    SpecialAbility determineSpecialAbility() const;
+    // Suit in the top 3 bits, face value (1-20) in the low 5 bits.
+    uint8_t packed_;
+    uint8_t identity_;
 };
 
+static_assert(sizeof(Card) == 2, "Card must stay a packed 2-byte value");
+static_assert(std::is_trivially_copyable_v<Card>, "Card must be trivially copyable");
+
 } // namespace whot::core
 
 #endif // WHOT_CORE_CARD_HPP
@@ -0,0 +1,36 @@
+#ifndef WHOT_CORE_CARD_MASK_HPP
+#define WHOT_CORE_CARD_MASK_HPP
+
+#include "Card.hpp"
+#include <bitset>
+#include <cstddef>
+#include <optional>
+
+namespace whot::core {
+
+/// One bit per card identity (see cardIdentity in GameConstants.hpp), so
+/// every constructible Card has a distinct bit.
+using CardMask = std::bitset<CARD_IDENTITY_COUNT>;
+
+inline size_t cardIdentity(const Card& card) {
+    return card.getIdentity();
+}
+
+inline CardMask cardMask(const Card& card) {
+    return CardMask().set(card.getIdentity());
+}
+
+/// Every identity of the given suit.
+const CardMask& suitMask(Suit suit);
+/// Every identity with the given face value, across all suits.
+const CardMask& valueMask(CardValue value);
+/// Identities that count as Whot cards (face value 20).
+const CardMask& whotMask();
+/// Identities that Card::canPlayOn(callCard) accepts: suit or value match,
+/// or a Whot card. With a demanded suit only that suit and Whot cards match.
+CardMask playableOnMask(const Card& callCard,
+                        std::optional<Suit> demandedSuit = std::nullopt);
+
+} // namespace whot::core
+
+#endif // WHOT_CORE_CARD_MASK_HPP
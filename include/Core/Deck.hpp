@@ -2,9 +2,10 @@
 #define WHOT_CORE_DECK_HPP
 
 #include "Card.hpp"
+#include "Utils/FastRng.hpp"
+#include <cstdint>
 #include <vector>
-#include <memory>
-#include <random>
+#include <optional>
 
 namespace whot::core {
 
@@ -12,37 +13,42 @@ class Deck {
 public:
     Deck();
     explicit Deck(int numberOfDecks);  // For games with many players
-    void createDeck();
+    /// Reproducible deck: same seed, same shuffles. numberOfDecks == 0 starts
+    /// empty (no throwaway build/shuffle when the cards come from elsewhere).
+    Deck(int numberOfDecks, uint64_t seed);
+    void createDeck();  // Appends one copy of STANDARD_DECK
 
     void shuffle();
-    std::unique_ptr<Card> draw();
-    void addCard(std::unique_ptr<Card> card);
-    void addCards(std::vector<std::unique_ptr<Card>> cards);
+    void seed(uint64_t seed);
+    std::optional<Card> draw();
+    void addCard(const Card& card);
+    void addCards(const std::vector<Card>& cards);
 
     size_t size() const;
+    /// Grows on every change to the cards or RNG; never repeats.
+    uint64_t getVersion() const;
     bool isEmpty() const;
-    const Card* peek() const;
+    std::optional<Card> peek() const;
     
     void initializeStandardDeck();
     void reset();
     void clear();
     
-    void reshuffleFromDiscardPile(std::vector<std::unique_ptr<Card>> discardPile, 
+    void reshuffleFromDiscardPile(const std::vector<Card>& discardPile,
                                    const Card& currentCallCard);
     
     std::string toJson() const;
+    void writeJson(utils::JsonWriter& w) const;
     static Deck fromJson(const std::string& json);
+    /// Generator state and cards in draw order, so a restored deck deals
+    /// and reshuffles exactly as this one would.
+    void writeSnapshot(utils::ByteWriter& w) const;
+    static std::optional<Deck> readSnapshot(utils::ByteReader& r);
     
 private:
-    std::vector<std::unique_ptr<Card>> cards_;
-    std::mt19937 rng_;
-    
-    void createCircleCards();
-    void createTriangleCards();
-    void createCrossCards();
-    void createBlockCards();
-    void createStarCards();
-    void createWhotCards();
+    std::vector<Card> cards_;
+    utils::FastRng rng_;
+    uint64_t version_ = 0;
 };
 
 } // namespace whot::core
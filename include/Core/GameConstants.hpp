@@ -1,7 +1,10 @@
 #ifndef WHOT_CORE_GAME_CONSTANTS_HPP
 #define WHOT_CORE_GAME_CONSTANTS_HPP
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace whot::core {
@@ -47,6 +50,174 @@ enum class SpecialAbility : uint8_t {
     WHOT_CARD          // 20 - change suit
 };
 
+// ========================================
+// Compile-time card tables
+// ========================================
+
+constexpr size_t SUIT_COUNT = 6;
+
+/// Face values dealt per suit in one standard deck (the WHOT suit is
+/// WHOT_CARDS_COUNT copies of 20).
+constexpr std::array<CardValue, 12> CIRCLE_VALUES = {
+    CardValue::ONE, CardValue::TWO, CardValue::THREE, CardValue::FOUR,
+    CardValue::FIVE, CardValue::SEVEN, CardValue::EIGHT, CardValue::TEN,
+    CardValue::ELEVEN, CardValue::TWELVE, CardValue::THIRTEEN, CardValue::FOURTEEN
+};
+constexpr std::array<CardValue, 12> TRIANGLE_VALUES = CIRCLE_VALUES;
+constexpr std::array<CardValue, 9> CROSS_VALUES = {
+    CardValue::ONE, CardValue::TWO, CardValue::THREE, CardValue::FIVE,
+    CardValue::SEVEN, CardValue::TEN, CardValue::ELEVEN, CardValue::THIRTEEN,
+    CardValue::FOURTEEN
+};
+constexpr std::array<CardValue, 9> BLOCK_VALUES = CROSS_VALUES;
+constexpr std::array<CardValue, 7> STAR_VALUES = {
+    CardValue::ONE, CardValue::TWO, CardValue::THREE, CardValue::FOUR,
+    CardValue::FIVE, CardValue::SEVEN, CardValue::EIGHT
+};
+
+struct CardSpec {
+    Suit suit;
+    CardValue value;
+};
+
+/// Card identities: suit * VALUE_SLOTS + slot, where slot is the face
+/// value's position among the 13 Whot values. Covers every constructible
+/// Card, not only the 50 distinct identities in a standard deck.
+constexpr size_t VALUE_SLOTS = 13;
+constexpr size_t CARD_IDENTITY_COUNT = SUIT_COUNT * VALUE_SLOTS;
+
+/// Face value (1-20) -> slot; 6, 9 and 15-19 are not Whot values.
+constexpr std::array<uint8_t, 21> VALUE_SLOT = {
+    0, 0, 1, 2, 3, 4, 0, 5, 6, 0, 7, 8, 9, 10, 11, 0, 0, 0, 0, 0, 12
+};
+constexpr std::array<CardValue, VALUE_SLOTS> SLOT_VALUE = {
+    CardValue::ONE, CardValue::TWO, CardValue::THREE, CardValue::FOUR,
+    CardValue::FIVE, CardValue::SEVEN, CardValue::EIGHT, CardValue::TEN,
+    CardValue::ELEVEN, CardValue::TWELVE, CardValue::THIRTEEN,
+    CardValue::FOURTEEN, CardValue::TWENTY
+};
+
+constexpr size_t cardIdentity(Suit suit, CardValue value) {
+    return static_cast<size_t>(suit) * VALUE_SLOTS +
+           VALUE_SLOT[static_cast<size_t>(value)];
+}
+constexpr Suit identitySuit(size_t id) { return static_cast<Suit>(id / VALUE_SLOTS); }
+constexpr CardValue identityValue(size_t id) { return SLOT_VALUE[id % VALUE_SLOTS]; }
+
+constexpr SpecialAbility abilityForValue(CardValue value) {
+    switch (value) {
+    case CardValue::ONE: return SpecialAbility::HOLD_ON;
+    case CardValue::TWO: return SpecialAbility::PICK_TWO;
+    case CardValue::FOURTEEN: return SpecialAbility::GENERAL_MARKET;
+    case CardValue::TWENTY: return SpecialAbility::WHOT_CARD;
+    default: return SpecialAbility::NONE;
+    }
+}
+
+namespace detail {
+template <size_t N>
+constexpr void appendSuit(std::array<CardSpec, STANDARD_DECK_SIZE>& deck, size_t& n,
+                          Suit suit, const std::array<CardValue, N>& values) {
+    for (CardValue v : values) deck[n++] = CardSpec{suit, v};
+}
+
+constexpr std::array<CardSpec, STANDARD_DECK_SIZE> makeStandardDeck() {
+    std::array<CardSpec, STANDARD_DECK_SIZE> deck{};
+    size_t n = 0;
+    appendSuit(deck, n, Suit::CIRCLE, CIRCLE_VALUES);
+    appendSuit(deck, n, Suit::TRIANGLE, TRIANGLE_VALUES);
+    appendSuit(deck, n, Suit::CROSS, CROSS_VALUES);
+    appendSuit(deck, n, Suit::BLOCK, BLOCK_VALUES);
+    appendSuit(deck, n, Suit::STAR, STAR_VALUES);
+    for (int i = 0; i < WHOT_CARDS_COUNT; ++i)
+        deck[n++] = CardSpec{Suit::WHOT, CardValue::TWENTY};
+    return deck;
+}
+
+template <typename T, typename Fn>
+constexpr std::array<T, CARD_IDENTITY_COUNT> makeIdentityTable(Fn fn) {
+    std::array<T, CARD_IDENTITY_COUNT> table{};
+    for (size_t id = 0; id < CARD_IDENTITY_COUNT; ++id) table[id] = fn(id);
+    return table;
+}
+
+constexpr bool canPlayOnIdentity(size_t card, size_t call) {
+    if (identityValue(card) == CardValue::TWENTY) return true;
+    return identitySuit(card) == identitySuit(call) ||
+           identityValue(card) == identityValue(call);
+}
+
+constexpr size_t countInDeck(Suit suit, CardValue value) {
+    size_t n = 0;
+    for (const CardSpec& c : makeStandardDeck())
+        if (c.suit == suit && c.value == value) ++n;
+    return n;
+}
+}  // namespace detail
+
+/// Deal order of one standard deck, as Deck::createDeck lays it out.
+constexpr std::array<CardSpec, STANDARD_DECK_SIZE> STANDARD_DECK = detail::makeStandardDeck();
+
+/// Hand score per identity: face value, doubled for stars.
+constexpr std::array<uint8_t, CARD_IDENTITY_COUNT> CARD_SCORE =
+    detail::makeIdentityTable<uint8_t>([](size_t id) {
+        const int v = static_cast<int>(identityValue(id));
+        return static_cast<uint8_t>(identitySuit(id) == Suit::STAR ? 2 * v : v);
+    });
+
+/// PLAYABLE_ON[card][call]: suit or value match, or card is a Whot card.
+constexpr std::array<std::array<bool, CARD_IDENTITY_COUNT>, CARD_IDENTITY_COUNT> PLAYABLE_ON =
+    detail::makeIdentityTable<std::array<bool, CARD_IDENTITY_COUNT>>([](size_t card) {
+        std::array<bool, CARD_IDENTITY_COUNT> row{};
+        for (size_t call = 0; call < CARD_IDENTITY_COUNT; ++call)
+            row[call] = detail::canPlayOnIdentity(card, call);
+        return row;
+    });
+
+/// PLAYABLE_ON_DEMAND[suit][card]: after a Whot call, only the demanded suit
+/// or another Whot card may follow.
+constexpr std::array<std::array<bool, CARD_IDENTITY_COUNT>, SUIT_COUNT> PLAYABLE_ON_DEMAND = [] {
+    std::array<std::array<bool, CARD_IDENTITY_COUNT>, SUIT_COUNT> table{};
+    for (size_t s = 0; s < SUIT_COUNT; ++s)
+        for (size_t id = 0; id < CARD_IDENTITY_COUNT; ++id)
+            table[s][id] = identityValue(id) == CardValue::TWENTY ||
+                           identitySuit(id) == static_cast<Suit>(s);
+    return table;
+}();
+
+constexpr bool isPlayableOn(size_t card, size_t call,
+                            std::optional<Suit> demandedSuit = std::nullopt) {
+    return demandedSuit.has_value()
+        ? PLAYABLE_ON_DEMAND[static_cast<size_t>(*demandedSuit)][card]
+        : PLAYABLE_ON[card][call];
+}
+
+static_assert(CIRCLE_VALUES.size() + TRIANGLE_VALUES.size() + CROSS_VALUES.size() +
+              BLOCK_VALUES.size() + STAR_VALUES.size() + WHOT_CARDS_COUNT == STANDARD_DECK_SIZE,
+              "Per-suit value lists must add up to the standard deck");
+static_assert(detail::countInDeck(Suit::CIRCLE, CardValue::FOURTEEN) == 1 &&
+              detail::countInDeck(Suit::CROSS, CardValue::FOUR) == 0 &&
+              detail::countInDeck(Suit::CROSS, CardValue::TWELVE) == 0 &&
+              detail::countInDeck(Suit::BLOCK, CardValue::EIGHT) == 0 &&
+              detail::countInDeck(Suit::STAR, CardValue::EIGHT) == 1 &&
+              detail::countInDeck(Suit::STAR, CardValue::TEN) == 0 &&
+              detail::countInDeck(Suit::WHOT, CardValue::TWENTY) == WHOT_CARDS_COUNT,
+              "Standard deck must match the Nigerian per-suit value lists");
+static_assert(identitySuit(cardIdentity(Suit::BLOCK, CardValue::THIRTEEN)) == Suit::BLOCK &&
+              identityValue(cardIdentity(Suit::BLOCK, CardValue::THIRTEEN)) == CardValue::THIRTEEN,
+              "Card identity must round-trip");
+static_assert(CARD_SCORE[cardIdentity(Suit::STAR, CardValue::SEVEN)] == 14 &&
+              CARD_SCORE[cardIdentity(Suit::WHOT, CardValue::TWENTY)] == 20,
+              "Star cards score double");
+static_assert(PLAYABLE_ON[cardIdentity(Suit::WHOT, CardValue::TWENTY)][cardIdentity(Suit::CROSS, CardValue::FIVE)] &&
+              PLAYABLE_ON[cardIdentity(Suit::CIRCLE, CardValue::FIVE)][cardIdentity(Suit::CROSS, CardValue::FIVE)] &&
+              !PLAYABLE_ON[cardIdentity(Suit::CIRCLE, CardValue::FOUR)][cardIdentity(Suit::CROSS, CardValue::FIVE)],
+              "Playability matrix must follow suit-or-value matching");
+static_assert(isPlayableOn(cardIdentity(Suit::STAR, CardValue::THREE), 0, Suit::STAR) &&
+              !isPlayableOn(cardIdentity(Suit::CIRCLE, CardValue::ONE),
+                            cardIdentity(Suit::CIRCLE, CardValue::ONE), Suit::STAR),
+              "A demanded suit overrides suit-or-value matching");
+
 std::string suitToString(Suit suit);
 std::string cardValueToString(CardValue value);
 Suit stringToSuit(const std::string& str);
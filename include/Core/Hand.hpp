@@ -2,34 +2,51 @@
 #define WHOT_CORE_HAND_HPP
 
 #include "Card.hpp"
+#include "CardMask.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <memory>
+#include <optional>
 
 namespace whot::core {
 
+/// Cards in deal order, indexed alongside by a per-identity count array and
+/// a CardMask, so membership and playability checks are mask operations and
+/// only the vector-returning queries walk the cards.
 class Hand {
 public:
     Hand();
     Hand(int numberOfCards);
     
-    void addCard(std::unique_ptr<Card> card);
-    void addCards(std::vector<std::unique_ptr<Card>> cards);
-    std::unique_ptr<Card> playCard(size_t index);
-    std::unique_ptr<Card> playCard(const Card& card);
+    void addCard(const Card& card);
+    void addCards(const std::vector<Card>& cards);
+    std::optional<Card> playCard(size_t index);
+    std::optional<Card> playCard(const Card& card);
     
     size_t size() const;
+    /// Grows on every change to the cards; never repeats.
+    uint64_t getVersion() const;
     bool isEmpty() const;
     bool hasCard(const Card& card) const;
     const Card& getCard(size_t index) const;
     
     std::vector<size_t> getPlayableCardIndices(const Card& callCard) const;
     bool hasPlayableCard(const Card& callCard) const;
-    std::vector<const Card*> getCardsBySuit(Suit suit) const;
-    std::vector<const Card*> getCardsByValue(CardValue value) const;
-    std::vector<const Card*> getWhotCards() const;
+    std::vector<Card> getCardsBySuit(Suit suit) const;
+    std::vector<Card> getCardsByValue(CardValue value) const;
+    std::vector<Card> getWhotCards() const;
     int calculateTotalScore() const;
 
+    // Mask queries: one bit per card identity held (see CardMask.hpp).
+    const CardMask& getCardMask() const;
+    CardMask getPlayableMask(const Card& callCard,
+                             std::optional<Suit> demandedSuit = std::nullopt) const;
+    CardMask getSuitMask(Suit suit) const;
+    CardMask getValueMask(CardValue value) const;
+    size_t countOf(const Card& card) const;
+
     std::string toJson() const;
+    void writeJson(utils::JsonWriter& w) const;
     static Hand fromJson(const std::string& json);
     
     auto begin();
@@ -38,9 +55,14 @@ public:
     auto end() const;
     
 private:
-    std::vector<std::unique_ptr<Card>> cards_;
+    std::vector<Card> cards_;
     size_t size_;
+    std::array<uint8_t, CARD_IDENTITY_COUNT> counts_;
+    CardMask mask_;
+    uint64_t version_ = 0;
     
+    void track(const Card& card);
+    void untrack(const Card& card);
     void sortCards();
 };
 
@@ -2,6 +2,8 @@
 #define WHOT_CORE_PLAYER_HPP
 
 #include "Hand.hpp"
+#include <functional>
+#include <memory>
 #include <string>
 #include <cstdint>
 #include <chrono>
@@ -62,8 +64,18 @@ public:
     void setGamesWon(int n);
     void setCumulativeScore(int n);
     
+    /// Grows on every change to the serialized fields or the hand.
+    uint64_t getVersion() const;
+    
     std::string toJson() const;
+    void writeJson(utils::JsonWriter& w) const;
+    /// writeJson() with `writeHand` writing the "hand" value, e.g. masked.
+    void writeJson(utils::JsonWriter& w, const std::function<void(utils::JsonWriter&)>& writeHand) const;
     static std::unique_ptr<Player> fromJson(const std::string& json);
+    /// The toJson() fields in binary, hand cards as Card::toByte().
+    void writeSnapshot(utils::ByteWriter& w) const;
+    /// nullptr on a truncated record or an invalid card.
+    static std::unique_ptr<Player> readSnapshot(utils::ByteReader& r);
     
 private:
     std::string id_;
@@ -83,6 +95,7 @@ private:
     
     int gamesPlayed_;
     int gamesWon_;
+    uint64_t version_ = 0;
 };
 
 } // namespace whot::core
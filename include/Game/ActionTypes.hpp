@@ -31,7 +31,10 @@ struct ActionResult {
     bool success;
     std::string message;
     std::vector<std::string> affectedPlayerIds;
-    std::string newStateJson;
+    const GameState* state = nullptr;  // set on success; owned by the engine
+
+    /// Serializes the state on demand; reflects the state at call time.
+    std::string stateJson() const { return state ? state->toJson() : "{}"; }
 };
 
 } // namespace whot::game
@@ -3,16 +3,22 @@
 
 #include "Game/GameState.hpp"
 #include "Game/ActionTypes.hpp"
+#include "Game/GameEvents.hpp"
+#include "Game/GameJournal.hpp"
 #include "Game/RuleEngine.hpp"
 #include "Game/TurnManager.hpp"
+#include <array>
 #include <memory>
 #include <functional>
 #include <map>
 
 namespace whot::game {
 
+using GameEventHandler = std::function<void(const GameEvent& event)>;
+/// Legacy string form: event name and the full state JSON.
 using GameEventCallback = std::function<void(const std::string& eventType, 
                                               const std::string& eventData)>;
+using SubscriptionId = uint64_t;
 
 class GameEngine {
 public:
@@ -23,13 +29,28 @@ public:
     void startNewRound();
     ActionResult processAction(const GameAction& action);
     void endGame();
+    /// Removes the player from the state and records it in the journal.
+    void removePlayer(const std::string& playerId);
     
     // State access
     GameState* getState();
     const GameState* getState() const;
+    /// Everything since startGame(); replay() rebuilds this engine's state.
+    const GameJournal& getJournal() const;
+    /// Journal bytes not yet handed to storage (see GameJournal::takeUnsaved).
+    GameJournal::Suffix takeUnsavedJournal();
+    /// Continues a journal loaded from storage, e.g. after a restart.
+    void restoreJournal(GameJournal journal);
+    const TurnManager* getTurnManager() const;
     
     // Event system
-    void registerEventCallback(const std::string& eventType, GameEventCallback callback);
+    SubscriptionId subscribe(GameEventType type, GameEventHandler handler);
+    /// Handler for every event type.
+    SubscriptionId subscribeAll(GameEventHandler handler);
+    void unsubscribe(SubscriptionId id);
+    /// Named events ("card_played", "*" for all); each call serializes the
+    /// state. False, and nothing registered, for an unknown name.
+    bool registerEventCallback(const std::string& eventType, GameEventCallback callback);
     void unregisterEventCallback(const std::string& eventType);
     
     // Validation
@@ -44,8 +65,16 @@ private:
     std::unique_ptr<GameState> state_;
     std::unique_ptr<RuleEngine> ruleEngine_;
     std::unique_ptr<TurnManager> turnManager_;
+    GameJournal journal_;
     
-    std::map<std::string, std::vector<GameEventCallback>> eventCallbacks_;
+    struct Subscriber {
+        SubscriptionId id;
+        GameEventHandler handler;
+    };
+    // One list per GameEventType, then one for subscribeAll.
+    std::array<std::vector<Subscriber>, kGameEventTypeCount + 1> subscribers_;
+    SubscriptionId nextSubscriptionId_ = 1;
+    std::map<std::string, std::vector<SubscriptionId>> namedSubscriptions_;
     
     // Action handlers
     ActionResult handlePlayCard(const GameAction& action);
@@ -54,7 +83,8 @@ private:
     ActionResult handleSuitChoice(const GameAction& action);
     
     // Event dispatching
-    void emitEvent(const std::string& eventType, const std::string& eventData);
+    bool hasSubscribers(GameEventType type) const;
+    void emitEvent(GameEventType type, GameEventData data);
     
     // Special card execution
     void executeSpecialCard(const core::Card& card, core::Player* player);
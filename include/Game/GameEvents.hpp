@@ -0,0 +1,82 @@
+#ifndef WHOT_GAME_GAME_EVENTS_HPP
+#define WHOT_GAME_GAME_EVENTS_HPP
+
+#include "Game/GameState.hpp"
+#include "Core/Card.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <variant>
+
+namespace whot::game {
+
+/// Event ids; subscriptions are indexed by these rather than by name.
+enum class GameEventType : uint8_t {
+    ROUND_STARTED,
+    CARD_PLAYED,
+    CARD_DRAWN,
+    SUIT_CHOSEN,
+    ROUND_ENDED,
+    GAME_ENDED
+};
+
+inline constexpr size_t kGameEventTypeCount = 6;
+
+/// Wire name of the event ("card_played", ...), as the string API used.
+inline constexpr const char* gameEventName(GameEventType type) {
+    switch (type) {
+        case GameEventType::ROUND_STARTED: return "round_started";
+        case GameEventType::CARD_PLAYED: return "card_played";
+        case GameEventType::CARD_DRAWN: return "card_drawn";
+        case GameEventType::SUIT_CHOSEN: return "suit_chosen";
+        case GameEventType::ROUND_ENDED: return "round_ended";
+        case GameEventType::GAME_ENDED: return "game_ended";
+    }
+    return "";
+}
+
+struct RoundStartedEvent {
+    std::optional<core::Card> callCard;
+    size_t playerCount;
+};
+
+struct CardPlayedEvent {
+    std::string playerId;
+    core::Card card;
+};
+
+struct CardDrawnEvent {
+    std::string playerId;
+    int count;  // cards actually drawn
+};
+
+struct SuitChosenEvent {
+    std::string playerId;
+    core::Suit suit;
+};
+
+struct RoundEndedEvent {
+    std::optional<std::string> winnerId;
+};
+
+struct GameEndedEvent {
+    std::optional<std::string> winnerId;
+};
+
+using GameEventData = std::variant<RoundStartedEvent, CardPlayedEvent, CardDrawnEvent,
+                                   SuitChosenEvent, RoundEndedEvent, GameEndedEvent>;
+
+/// One emitted event. Nothing is serialized unless a handler calls
+/// stateJson(); the state is the engine's, valid during dispatch only.
+struct GameEvent {
+    GameEventType type;
+    GameEventData data;
+    const GameState* state;
+
+    std::string stateJson() const { return state ? state->toJson() : "{}"; }
+};
+
+} // namespace whot::game
+
+#endif // WHOT_GAME_GAME_EVENTS_HPP
@@ -0,0 +1,65 @@
+#ifndef WHOT_GAME_GAME_JOURNAL_HPP
+#define WHOT_GAME_GAME_JOURNAL_HPP
+
+#include "Game/GameState.hpp"
+#include "Game/ActionTypes.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace whot::game {
+
+class GameEngine;
+
+/// Append-only binary record of one game from startGame() on: a header with
+/// the ids, seed, config and seating, then every round start, accepted
+/// action, removal and game end in order. The deck is the only randomness,
+/// and it follows the seed, so replay() rebuilds the exact state. An action
+/// costs 3-5 bytes: entries refer to players by seat, not id.
+class GameJournal {
+public:
+    GameJournal() = default;
+    /// Header for `state` at startGame().
+    explicit GameJournal(const GameState& state);
+
+    bool isOpen() const { return !bytes_.empty(); }
+    void recordRoundStart();
+    void recordAction(const GameAction& action);
+    void recordPlayerRemoved(const std::string& playerId);
+    void recordGameEnd();
+
+    /// Header and entries so far; grows only at the end, so a store can
+    /// append bytes().substr(previousSize).
+    const std::string& bytes() const { return bytes_; }
+    size_t entryCount() const { return entryCount_; }
+
+    /// Bytes a store has not been given yet and where they start in bytes().
+    /// Offset 0 means a new journal that replaces any stored one.
+    struct Suffix {
+        size_t offset = 0;
+        std::string bytes;
+    };
+    /// The bytes since the last call; they count as stored from then on.
+    Suffix takeUnsaved();
+
+    /// nullopt if `bytes` is not a journal or is cut off mid-entry. The
+    /// result counts as stored: takeUnsaved() returns only later entries.
+    static std::optional<GameJournal> fromBytes(std::string_view bytes);
+    /// Plays the journal through a fresh GameEngine; nullptr if an entry no
+    /// longer applies (e.g. the rules changed since it was written).
+    std::unique_ptr<GameEngine> replay() const;
+
+private:
+    std::string bytes_;
+    size_t entryCount_ = 0;
+    size_t savedSize_ = 0;  // prefix of bytes_ already returned by takeUnsaved()
+    std::vector<std::string> seats_;  // player ids in seating order
+
+    size_t seatOf(const std::string& playerId) const;
+};
+
+} // namespace whot::game
+
+#endif // WHOT_GAME_GAME_JOURNAL_HPP
@@ -4,11 +4,14 @@
 #include "Core/Player.hpp"
 #include "Core/Deck.hpp"
 #include "Core/Card.hpp"
+#include <functional>
 #include <vector>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <chrono>
+#include <cstdint>
 
 namespace whot::game {
 
@@ -34,6 +37,46 @@ struct GameConfig {
     bool allowDoubleDecking = false;
     bool allowDirectionChange = true;
     bool enforceTurnTimer = false;
+    uint64_t seed = 0;  // Deck shuffle seed; 0 picks a fresh one per game
+};
+
+/// GameConfig as varints and one flags byte, shared by the journal header
+/// and state snapshots.
+void writeConfig(utils::ByteWriter& w, const GameConfig& config);
+GameConfig readConfig(utils::ByteReader& r);
+
+/// One render of the per-viewer state for a whole broadcast. The part every
+/// viewer shares is built once with each player's hand masked; forPlayer()
+/// copies it once, splicing in the viewer's own hand. Points into the state,
+/// so use it only until the state next changes.
+class StateView {
+public:
+    enum class Format : uint8_t { JSON, BINARY };
+
+    /// toJsonForPlayer() / toBinaryForPlayer() output for this viewer.
+    std::string forPlayer(const std::string& viewerPlayerId) const;
+
+    /// The viewer's index in the player list and the own hand forPlayer()
+    /// splices in there; nullopt if the viewer holds no seat.
+    struct Seat {
+        size_t index;
+        std::string hand;
+    };
+    std::optional<Seat> seatOf(const std::string& viewerPlayerId) const;
+    /// The view with every hand masked, as a spectator gets it.
+    const std::string& shared() const { return shared_; }
+
+private:
+    friend class GameState;
+    struct HandSlot {
+        const core::Player* player;
+        size_t begin;  // masked hand bytes in shared_
+        size_t end;
+    };
+    const HandSlot* slotOf(const std::string& viewerPlayerId) const;
+    Format format_ = Format::JSON;
+    std::string shared_;
+    std::vector<HandSlot> hands_;
 };
 
 class GameState {
@@ -69,9 +112,12 @@ public:
     
     // Card management
     core::Deck& getDeck();
-    const core::Card* getCallCard() const;
-    void setCallCard(std::unique_ptr<core::Card> card);
-    void addToDiscardPile(std::unique_ptr<core::Card> card);
+    /// Seed of this game's deck RNG; deals replay exactly from initialize().
+    uint64_t getSeed() const;
+    void setSeed(uint64_t seed);
+    std::optional<core::Card> getCallCard() const;
+    void setCallCard(const core::Card& card);
+    void addToDiscardPile(const core::Card& card);
     
     // Special card state
     void setActivePickCount(int count);  // For chained 2s or 5s
@@ -92,6 +138,10 @@ public:
     const std::string& getCreatorPlayerId() const;
     void setCreatorPlayerId(const std::string& playerId);
     
+    /// Grows on every change to this state, its deck, players or hands, so
+    /// equal versions mean equal serializations.
+    uint64_t getVersion() const;
+
     bool needsReshufffle() const;
     void reshuffleDiscardPile();
     
@@ -101,12 +151,31 @@ public:
     std::optional<std::string> getWinnerId() const;
     
     // Serialization
+    /// Served as is by GET /api/games/:id, so it leaves the seed out; only
+    /// toSnapshot() carries it. fromJson() gives the game a fresh seed.
     std::string toJson() const;
+    /// Appends toJson() to `w` without the cache, e.g. into a larger document.
+    void writeJson(utils::JsonWriter& w) const;
     /// Same as toJson() but other players' hands are replaced with {"count": N}.
     std::string toJsonForPlayer(const std::string& viewerPlayerId) const;
+    /// The toJsonForPlayer() view in the binary wire layout (see
+    /// implementation manual, "Binary protocol"): cards are one byte each.
+    std::string toBinaryForPlayer(const std::string& viewerPlayerId) const;
+    /// Renders the shared part of those views once, for many viewers. Cached
+    /// until getVersion() changes; the reference is valid until then.
+    const StateView& renderView(StateView::Format format) const;
     static std::unique_ptr<GameState> fromJson(const std::string& json);
+    /// Everything needed to resume play exactly, which toJson() is not: deck
+    /// order and RNG state, discard pile, turn and pending-card state. Binary,
+    /// versioned and checksummed (see implementation manual, "Snapshots").
+    std::string toSnapshot() const;
+    /// nullptr if `bytes` is not a snapshot of this version, is truncated, or
+    /// fails its checksum.
+    static std::unique_ptr<GameState> fromSnapshot(std::string_view bytes);
     
 private:
+    friend class GameJournal;  // replay restores gameId_
+
     GameConfig config_;
     GamePhase phase_;
     
@@ -114,9 +183,10 @@ private:
     int currentPlayerIndex_;
     PlayDirection direction_;
     
+    uint64_t seed_;
     core::Deck deck_;
-    std::unique_ptr<core::Card> callCard_;
-    std::vector<std::unique_ptr<core::Card>> discardPile_;
+    std::optional<core::Card> callCard_;
+    std::vector<core::Card> discardPile_;
     
     // Special game state
     int activePickCount_;  // For chained pick 2/3
@@ -126,9 +196,31 @@ private:
     std::string gameCode_;
     std::string creatorPlayerId_;
     std::chrono::system_clock::time_point createdAt_;
+    uint64_t version_ = 0;
+
+    // Serializations memoized by getVersion(). Not synchronized: a state is
+    // only touched from its game's strand.
+    struct CachedText {
+        uint64_t version = 0;
+        bool valid = false;
+        std::string text;
+    };
+    struct CachedView {
+        uint64_t version = 0;
+        bool valid = false;
+        StateView view;
+    };
+    mutable CachedText jsonCache_;
+    mutable CachedView viewCache_[2];  // indexed by StateView::Format
     
     int getNextPlayerIndex() const;
     void eliminatePlayers();  // Check for elimination conditions
+    std::string buildJson() const;
+    /// The one JSON layout behind toJson() and the JSON StateView;
+    /// `writeHand` writes each player's "hand" value.
+    void writeJson(utils::JsonWriter& w,
+                   const std::function<void(utils::JsonWriter&, const core::Player&)>& writeHand) const;
+    StateView buildView(StateView::Format format) const;
 };
 
 } // namespace whot::game
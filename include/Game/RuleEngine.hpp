@@ -34,6 +34,15 @@ public:
     bool canPlayCard(const GameState& state, 
                      const core::Player& player,
                      const core::Card& card) const;
+
+    /**
+     * Whether any card in the player's hand is playable / can answer the
+     * active pick chain. Single mask AND against the hand's CardMask.
+     */
+    bool hasPlayableCard(const GameState& state,
+                         const core::Player& player) const;
+    bool hasDefenseCard(const GameState& state,
+                        const core::Player& player) const;
     
     /**
      * Check if player must draw a card
@@ -67,7 +76,7 @@ public:
      */
     bool canDoubleDesk(const GameState& state,
                        const core::Player& player,
-                       const std::vector<const core::Card*>& cards) const;
+                       const std::vector<core::Card>& cards) const;
     
     // ========================================
     // Declaration Validation
@@ -104,12 +113,6 @@ public:
     
 private:
     std::unique_ptr<rules::NigerianRules> rules_;
-    
-    // Helper methods
-    bool hasPlayableCard(const GameState& state,
-                         const core::Player& player) const;
-    bool hasDefenseCard(const GameState& state,
-                        const core::Player& player) const;
 };
 
 } // namespace whot::game
@@ -3,7 +3,6 @@
 
 #include "Game/GameState.hpp"
 #include "Game/ActionTypes.hpp"
-#include <queue>
 #include <chrono>
 #include <vector>
 
@@ -31,7 +30,9 @@ public:
     bool isPlayerTurn(const std::string& playerId) const;
     
     // Turn history
+    /// Keeps the last kHistoryCapacity actions; older ones are overwritten.
     void recordAction(const TurnAction& action);
+    /// The most recent `count` actions, oldest first.
     std::vector<TurnAction> getTurnHistory(int count = 10) const;
     const TurnAction* getLastAction() const;
     
@@ -49,8 +50,11 @@ public:
     void resetTimer();
     
 private:
+    static constexpr size_t kHistoryCapacity = 100;
+
     GameState* state_;
-    std::queue<TurnAction> actionHistory_;
+    std::vector<TurnAction> actionHistory_;  // ring buffer, oldest at historyStart_
+    size_t historyStart_ = 0;
     std::vector<std::string> skippedPlayers_;
     
     bool allowMultipleActions_;
@@ -1,34 +1,25 @@
 #ifndef WHOT_NETWORK_HTTP_SERVER_HPP
 #define WHOT_NETWORK_HTTP_SERVER_HPP
 
+#include "Network/HttpParser.hpp"
+#include "Network/Router.hpp"
+#include "Network/StaticAssetCache.hpp"
+#include "Utils/Executor.hpp"
 #include <string>
+#include <string_view>
 #include <map>
 #include <functional>
 #include <memory>
 #include <vector>
-#include <tuple>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 namespace whot::network {
 
-enum class HttpMethod {
-    GET,
-    POST,
-    PUT,
-    DELETE,
-    OPTIONS
-};
-
-struct HttpRequest {
-    HttpMethod method;
-    std::string path;
-    std::map<std::string, std::string> headers;
-    std::map<std::string, std::string> queryParams;
-    std::map<std::string, std::string> pathParams;  // e.g. :id from /api/games/:id
-    std::string body;
-};
-
 struct HttpResponse {
     int statusCode;
     std::map<std::string, std::string> headers;
@@ -44,6 +35,18 @@ struct HttpResponse {
 
 using RouteHandler = std::function<HttpResponse(const HttpRequest&)>;
 
+struct RouteOptions {
+    /// Opt a route out of enableCompression(), e.g. for tiny or
+    /// already-compressed bodies.
+    bool compress = true;
+};
+
+/// Edge-triggered epoll reactor on one thread owns every socket (accept,
+/// non-blocking read/write); complete requests are handed to a fixed pool of
+/// handler threads and the rendered response comes back to the reactor.
+/// Connections are HTTP/1.1 keep-alive with pipelining: requests are answered
+/// one at a time, in order, from the connection's read buffer. Connections
+/// beyond the cap are answered with 503 and closed.
 class HttpServer {
 public:
     explicit HttpServer(uint16_t port);
@@ -53,37 +56,99 @@ public:
     void start();
     void stop();
     bool isRunning() const;
+    /// Bound port; differs from the constructor's port when that was 0.
+    uint16_t getPort() const;
+    
+    // Limits (set before start())
+    void setWorkerThreads(size_t count);  // 0 = hardware concurrency
+    void setMaxConnections(size_t count);
+    size_t getConnectionCount() const;
+    /// Keep-alive: close connections idle between requests for this long,
+    /// and after this many requests.
+    void setIdleTimeout(std::chrono::milliseconds timeout);
+    void setMaxRequestsPerConnection(size_t count);
     
-    // Route registration
-    void addRoute(HttpMethod method, const std::string& path, RouteHandler handler);
-    void addPatternRoute(HttpMethod method, const std::string& pattern, RouteHandler handler);
+    // Route registration. Both forms share one Router, so paths may contain
+    // ":name" or ":name<int>" parameters; re-registering replaces a route.
+    void addRoute(HttpMethod method, const std::string& path, RouteHandler handler,
+                  RouteOptions options = {});
+    void addPatternRoute(HttpMethod method, const std::string& pattern, RouteHandler handler,
+                         RouteOptions options = {});
     void addStaticDirectory(const std::string& urlPath, const std::string& fsPath);
     void setStaticRoot(const std::string& fsPath);
     
-    // Middleware
+    // Middleware (set before start())
+    /// Allow any origin: CORS headers on every response and preflight answers.
     void addCorsHeaders();
-    void enableCompression();
+    /// gzip (or deflate) route responses of at least minBytes when the client's
+    /// Accept-Encoding allows it. Static files use their cached variants.
+    void enableCompression(size_t minBytes = 1024, int level = 6);
     void setMaxBodySize(size_t bytes);
     
     // REST API helpers
     void setupGameApi();  // Sets up standard game API endpoints
     
 private:
+    struct Connection;
+    using ConnectionPtr = std::shared_ptr<Connection>;
+
     uint16_t port_;
     std::atomic<bool> running_;
     size_t maxBodySize_;
+    size_t workerThreads_;
+    size_t maxConnections_;
+    std::chrono::milliseconds idleTimeout_;
+    size_t maxRequestsPerConnection_;
+    bool corsEnabled_;
+    bool compressionEnabled_;
+    size_t compressionMinBytes_;
+    int compressionLevel_;
     int listenFd_;
+    int epollFd_;
+    int wakeFd_;  // eventfd: stop() and finished handlers wake the reactor
+    int spareFd_;  // /dev/null, held so a connection can still be shed at EMFILE
+    bool acceptStalled_ = false;  // reactor thread: listener must be re-armed
     std::thread serverThread_;
+    std::unique_ptr<utils::WorkerPool> workers_;
+
+    // Reactor thread only.
+    std::unordered_map<int, ConnectionPtr> connections_;
+    std::atomic<size_t> connectionCount_;
+    // Responses rendered by handler threads, waiting for the reactor to send.
+    std::mutex completedMutex_;
+    std::vector<ConnectionPtr> completed_;
 
-    std::map<std::string, std::map<HttpMethod, RouteHandler>> routes_;
-    std::vector<std::tuple<std::string, HttpMethod, RouteHandler>> patternRoutes_;
+    struct Route {
+        RouteHandler handler;
+        RouteOptions options;
+    };
+    Router router_;
+    std::vector<Route> routeTable_;  // indexed by Router::RouteId
     std::map<std::string, std::string> staticDirectories_;
-    std::string staticRoot_;
+    std::unique_ptr<StaticAssetCache> staticAssets_;  // loaded by start()
     
-    HttpResponse handleRequest(const HttpRequest& request);
-    HttpResponse serveStaticFile(const std::string& urlPath);
-    bool matchRoute(const std::string& pattern, const std::string& path,
-                    std::map<std::string, std::string>& params);
+    void reactorLoop();
+    void acceptConnections();
+    /// Out of descriptors: frees the spare fd to accept one queued
+    /// connection, answers it 503 and closes it. False if that failed.
+    bool shedConnection();
+    void readFrom(const ConnectionPtr& conn);
+    void dispatchRequest(const ConnectionPtr& conn);
+    /// Handler thread: queue the rendered response for the reactor.
+    void finishRequest(const ConnectionPtr& conn, const HttpResponse& response);
+    /// Reactor thread: answer without running a handler (limits exceeded).
+    void rejectRequest(const ConnectionPtr& conn, const HttpResponse& response);
+    void drainCompleted();
+    void flush(const ConnectionPtr& conn);
+    void closeConnection(const ConnectionPtr& conn);
+    void closeIdleConnections(std::chrono::steady_clock::time_point now);
+    void closeAll();
+
+    /// Fills request.pathParams in place when a route matches.
+    HttpResponse handleRequest(HttpRequest& request);
+    HttpResponse runRoute(const Route& route, const HttpRequest& request) const;
+    void compressResponse(const HttpRequest& request, HttpResponse& response) const;
+    HttpResponse serveStaticFile(const HttpRequest& request);
 };
 
 } // namespace whot::network
@@ -0,0 +1,134 @@
+#ifndef WHOT_NETWORK_HTTP_PARSER_HPP
+#define WHOT_NETWORK_HTTP_PARSER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace whot::network {
+
+enum class HttpMethod {
+    GET,
+    POST,
+    PUT,
+    DELETE,
+    OPTIONS
+};
+
+/// Name/value views into a request buffer. Requests carry a handful of
+/// fields, so a linear scan over a reused vector beats a map of copies.
+class HttpFields {
+public:
+    using Field = std::pair<std::string_view, std::string_view>;
+    using const_iterator = std::vector<Field>::const_iterator;
+
+    void add(std::string_view name, std::string_view value) { fields_.emplace_back(name, value); }
+    void clear() { fields_.clear(); }
+    /// First field named exactly `name`, or end().
+    const_iterator find(std::string_view name) const;
+    const_iterator begin() const { return fields_.begin(); }
+    const_iterator end() const { return fields_.end(); }
+    size_t size() const { return fields_.size(); }
+    bool empty() const { return fields_.empty(); }
+
+private:
+    std::vector<Field> fields_;
+};
+
+/// Path parameters captured by the Router, e.g. :id from /api/games/:id.
+/// Stored inline so matching a route never allocates.
+class PathParams {
+public:
+    static constexpr size_t kCapacity = 8;
+    using Field = HttpFields::Field;
+    using const_iterator = const Field*;
+
+    /// False (and nothing stored) when already at capacity.
+    bool add(std::string_view name, std::string_view value);
+    void clear() { size_ = 0; }
+    /// Drops every parameter after the first `count`.
+    void truncate(size_t count) { if (count < size_) size_ = count; }
+    const_iterator find(std::string_view name) const;
+    /// Parameter parsed as a decimal integer (see ":name<int>" patterns);
+    /// nullopt if absent or not an integer.
+    std::optional<int64_t> getInt(std::string_view name) const;
+    const_iterator begin() const { return fields_.data(); }
+    const_iterator end() const { return fields_.data() + size_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    std::array<Field, kCapacity> fields_{};
+    size_t size_ = 0;
+};
+
+/// Views into the connection's request buffer, valid while the handler runs;
+/// copy anything that must outlive it. Header names are lower-cased.
+struct HttpRequest {
+    HttpMethod method = HttpMethod::GET;
+    std::string_view path;
+    HttpFields headers;
+    HttpFields queryParams;
+    PathParams pathParams;  // filled by the router
+    std::string_view body;
+};
+
+/// True if an Accept-Encoding value allows `coding` (named or via "*", with
+/// a non-zero q). Matching is case-insensitive.
+bool acceptsEncoding(std::string_view acceptEncoding, std::string_view coding);
+
+/// Incremental HTTP/1.x request parser. Call parse() on the connection's
+/// read buffer after every read: it resumes where it stopped, records
+/// offsets instead of copying, and rejects oversized headers or a
+/// Content-Length above the body limit before the body arrives.
+class HttpRequestParser {
+public:
+    enum class Status { INCOMPLETE, COMPLETE, ERROR };
+
+    HttpRequestParser(size_t maxHeaderBytes, size_t maxBodyBytes);
+
+    /// Parses the request at the start of `buffer`. Lower-cases header
+    /// names in place. After COMPLETE or ERROR, call reset() before reuse.
+    Status parse(std::string& buffer);
+    /// Header plus body bytes of the completed request; anything after them
+    /// is the next pipelined request.
+    size_t requestSize() const { return bodyStart_ + contentLength_; }
+    bool keepAlive() const { return keepAlive_; }
+    const char* error() const { return error_; }
+
+    /// Points `request` into `buffer`, which must hold the bytes parse()
+    /// completed on (the same string, or one they were moved into).
+    void build(std::string_view buffer, HttpRequest& request) const;
+    void reset();
+
+private:
+    enum class Stage { HEAD, BODY, DONE, FAILED };
+    struct Slice {
+        size_t pos;
+        size_t len;
+    };
+
+    Status fail(const char* message);
+    Status parseHead(std::string& buffer, size_t headerEnd);
+
+    size_t maxHeaderBytes_;
+    size_t maxBodyBytes_;
+    Stage stage_;
+    size_t scanned_;  // where the search for the blank line resumes
+    size_t bodyStart_;
+    size_t contentLength_;
+    bool keepAlive_;
+    HttpMethod method_;
+    Slice target_;
+    std::vector<std::pair<Slice, Slice>> fields_;
+    const char* error_;
+};
+
+} // namespace whot::network
+
+#endif // WHOT_NETWORK_HTTP_PARSER_HPP
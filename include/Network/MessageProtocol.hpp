@@ -2,6 +2,7 @@
 #define WHOT_NETWORK_MESSAGE_PROTOCOL_HPP
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <vector>
 #include <optional>
@@ -22,6 +23,7 @@ enum class MessageType : uint16_t {
     CHOOSE_SUIT = 106,
     CHAT_MESSAGE = 107,
     READY_UP = 108,
+    STATE_RESYNC = 110,  // Patch sequence gap; asks for a snapshot
     
     // Server -> Client
     GAME_STATE_UPDATE = 200,
@@ -34,32 +36,67 @@ enum class MessageType : uint16_t {
     GAME_ENDED = 207,
     ERROR = 208,
     CHAT_BROADCAST = 209,
+    GAME_STATE_PATCH = 210,  // StateStreams patch against the previous update
     
     // Bidirectional
     PING = 300,
     PONG = 301
 };
 
+/// Sec-WebSocket-Protocol a client offers to get binary frames (Message::encode)
+/// instead of JSON text frames.
+inline constexpr std::string_view kBinarySubprotocol = "whot.bin.1";
+
+/// How Message::payload is encoded. BINARY payloads use the type's
+/// toBinary() layout and only travel in binary frames.
+enum class PayloadFormat : uint8_t {
+    JSON = 0,
+    BINARY = 1
+};
+
 struct Message {
     MessageType type;
     std::string playerId;
     std::string gameId;
-    std::string payload;  // JSON payload
+    std::string payload;
     uint64_t timestamp;
+    PayloadFormat payloadFormat = PayloadFormat::JSON;
     
+    /// JSON text frame. An object or array payload is embedded as a raw
+    /// JSON value, not re-escaped into a string, so it must be valid JSON.
     std::string serialize() const;
+    /// Accepts the payload as an embedded value or, from older clients, as a
+    /// JSON string; either way `payload` ends up holding the JSON text.
     static Message deserialize(const std::string& data);
+    /// Binary frame: varint type, format byte, varint timestamp, playerId and
+    /// gameId as length-prefixed strings, then the payload bytes.
+    std::string encode() const;
+    /// Type ERROR if the frame is malformed, like deserialize().
+    static Message decode(std::string_view frame);
 };
 
+/// Payload of `message` in whichever format it arrived; nullopt if a
+/// binary payload is malformed.
+template <typename Payload>
+std::optional<Payload> decodePayload(const Message& message) {
+    if (message.payloadFormat == PayloadFormat::BINARY) return Payload::fromBinary(message.payload);
+    return Payload::fromJson(message.payload);
+}
+
 // Specific message payloads
 struct JoinGamePayload {
     std::string playerName;
     std::string gameId;
     std::optional<std::string> gameCode;  // Join by code (Kahoot-style)
     std::optional<std::string> password;
+    bool statePatches = false;  // Client applies GAME_STATE_PATCH (JSON protocol only)
     
     std::string toJson() const;
     static JoinGamePayload fromJson(const std::string& json);
+    /// playerName, gameId, flags (bit 0 code, bit 1 password), then those present.
+    std::string toBinary() const;
+    /// nullopt if the frame is truncated or any string is not valid UTF-8.
+    static std::optional<JoinGamePayload> fromBinary(std::string_view data);
 };
 
 struct PlayCardPayload {
@@ -70,6 +107,12 @@ struct PlayCardPayload {
     
     std::string toJson() const;
     static PlayCardPayload fromJson(const std::string& json);
+    /// Varint cardIndex, suit byte (0xFF none), reverse byte (0xFF none,
+    /// else 0/1), varint count and indices of additionalCards.
+    std::string toBinary() const;
+    /// nullopt unless the whole frame decodes: truncation, an unknown suit
+    /// or reverse byte, or trailing bytes reject the move.
+    static std::optional<PlayCardPayload> fromBinary(std::string_view data);
 };
 
 struct GameStateUpdatePayload {
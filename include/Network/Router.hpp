@@ -0,0 +1,57 @@
+#ifndef WHOT_NETWORK_ROUTER_HPP
+#define WHOT_NETWORK_ROUTER_HPP
+
+#include "Network/HttpParser.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace whot::network {
+
+/// Trie over '/'-separated pattern segments. A segment is literal text,
+/// ":name" (any non-empty segment), ":name<int>" (optionally signed decimal)
+/// or ":name<uuid>" (8-4-4-4-12 hex). Every node keeps one route id per
+/// method. Lookup walks one node per path segment, trying the literal child
+/// (binary search) before parameter children and backtracking only when a
+/// branch dead-ends, so its cost follows path depth rather than route count.
+class Router {
+public:
+    using RouteId = uint32_t;
+    static constexpr RouteId kNoRoute = UINT32_MAX;
+
+    struct Match {
+        RouteId route = kNoRoute;
+        /// When route is kNoRoute: bit (1 << method) for every method
+        /// registered on a path that matched, for a 405 Allow header.
+        unsigned allowedMethods = 0;
+    };
+
+    Router();
+    ~Router();
+    Router(Router&&) noexcept;
+    Router& operator=(Router&&) noexcept;
+
+    /// Registers `route` for method and pattern, replacing any earlier one;
+    /// returns the replaced id or kNoRoute. Throws std::invalid_argument for
+    /// a malformed pattern or more than PathParams::kCapacity parameters.
+    RouteId add(HttpMethod method, std::string_view pattern, RouteId route);
+    /// Clears `params`, then fills it with views into `path` (values) and
+    /// the router (names). Does not allocate.
+    Match find(HttpMethod method, std::string_view path, PathParams& params) const;
+    /// Number of method and pattern pairs registered.
+    size_t size() const { return size_; }
+
+private:
+    struct Node;
+
+    static bool matchNode(const Node& node, std::string_view rest, bool atEnd, HttpMethod method,
+                          PathParams& params, Match& match);
+
+    std::unique_ptr<Node> root_;
+    size_t size_;
+};
+
+} // namespace whot::network
+
+#endif // WHOT_NETWORK_ROUTER_HPP
@@ -6,6 +6,7 @@
 #include <memory>
 #include <chrono>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 namespace whot::network {
@@ -32,6 +33,9 @@ public:
     // Session data
     Session* getSession(const std::string& sessionId);
     const Session* getSession(const std::string& sessionId) const;
+    /// Copy taken under the lock; use from IO and game threads, where the
+    /// session may be updated or destroyed concurrently.
+    std::optional<Session> getSessionSnapshot(const std::string& sessionId) const;
     
     void setPlayerId(const std::string& sessionId, const std::string& playerId);
     void setGameId(const std::string& sessionId, const std::string& gameId);
@@ -0,0 +1,83 @@
+#ifndef WHOT_NETWORK_STATE_DELTA_HPP
+#define WHOT_NETWORK_STATE_DELTA_HPP
+
+#include "Network/MessageProtocol.hpp"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace whot::network {
+
+/// Patch (JSON text) turning document `from` into `to`. Objects follow JSON
+/// merge patch: changed keys carry the new value or a nested patch, removed
+/// keys are null. Arrays of equal length patch only changed elements as
+/// {"$items":{"<index>":patch}}; otherwise {"$splice":[start, deleteCount,
+/// [items]]} replaces the differing middle. Equal documents give "{}".
+std::string diffJson(std::string_view from, std::string_view to);
+/// Applies a diffJson patch to `base`. game.js mirrors this.
+std::string applyJsonPatch(std::string_view base, std::string_view patch);
+
+/// Per-session GAME_STATE_UPDATE / GAME_STATE_PATCH streams for clients that
+/// apply patches. Each stream remembers the last view it sent and numbers
+/// updates with a sequence that only grows; a client that sees a gap sends
+/// STATE_RESYNC and gets a snapshot. Thread-safe.
+class StateStreams {
+public:
+    struct Update {
+        MessageType type;
+        uint64_t seq;
+        std::string payload;
+    };
+
+    /// Seat of a viewer who holds no hand in the view (a spectator).
+    static constexpr size_t kNoSeat = static_cast<size_t>(-1);
+
+    /// One broadcast's shared view (every hand masked), parsed once. The
+    /// patch from the shared view a stream last saw is diffed once and
+    /// reused by every stream that saw the same one, so a session only
+    /// diffs its own hand. Use for one broadcast, from one thread.
+    class Frame {
+    public:
+        explicit Frame(std::string_view sharedJson);
+        ~Frame();
+
+    private:
+        friend class StateStreams;
+        struct Impl;
+        std::unique_ptr<Impl> impl_;
+    };
+
+    StateStreams();
+    ~StateStreams();
+
+    /// Starts or restarts the stream; its next update is a snapshot.
+    void open(const std::string& sessionId);
+    /// Next update for an open stream is a snapshot.
+    void resync(const std::string& sessionId);
+    void close(const std::string& sessionId);
+    bool isOpen(const std::string& sessionId) const;
+
+    /// Update that brings the session to `viewJson`: {"seq":n,"gameState":view}
+    /// after open/resync, else {"seq":n,"patch":...}. nullopt when the stream
+    /// is not open or the view did not change.
+    std::optional<Update> next(const std::string& sessionId, std::string_view viewJson);
+    /// The same for one viewer of `frame`: `viewJson` is the viewer's full
+    /// view (sent as a snapshot), `handJson` the hand at index `seat` of its
+    /// "players", masked in the frame. A seat that moved or a player list
+    /// that changed length falls back to diffing the whole view.
+    std::optional<Update> next(const std::string& sessionId, Frame& frame, std::string_view viewJson,
+                               size_t seat = kNoSeat, std::string_view handJson = {});
+
+private:
+    struct Stream;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Stream>> streams_;
+};
+
+} // namespace whot::network
+
+#endif // WHOT_NETWORK_STATE_DELTA_HPP
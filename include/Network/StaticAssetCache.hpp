@@ -0,0 +1,59 @@
+#ifndef WHOT_NETWORK_STATIC_ASSET_CACHE_HPP
+#define WHOT_NETWORK_STATIC_ASSET_CACHE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+namespace whot::network {
+
+/// One file held in memory with its validators and encoded variants.
+struct StaticAsset {
+    std::filesystem::path file;
+    std::filesystem::file_time_type mtime;
+    std::string contentType;
+    std::string cacheControl;
+    std::string etag;  // strong, quoted; variants append "-gz" / "-br" inside the quotes
+    std::string body;
+    std::string gzipBody;    // empty when not worth serving
+    std::string brotliBody;  // only from a precompressed "<file>.br" on disk
+    /// Last mtime check, in steady_clock ticks; see StaticAssetCache::lookup.
+    mutable std::atomic<std::chrono::steady_clock::rep> checkedAt{0};
+};
+
+/// In-memory copy of a static root. load() reads every file once; lookup()
+/// serves from memory and re-stats a file at most once per revalidation
+/// interval, reloading it when its mtime changed. Gzip bodies come from a
+/// "<file>.gz" sibling or are compressed at load; brotli bodies only from a
+/// "<file>.br" sibling. Safe to call from any thread.
+class StaticAssetCache {
+public:
+    using AssetPtr = std::shared_ptr<const StaticAsset>;
+
+    explicit StaticAssetCache(std::filesystem::path root);
+
+    void load();
+    /// Asset for a URL path ("/" is index.html); nullptr if missing or the
+    /// path tries to leave the root.
+    AssetPtr lookup(std::string_view urlPath);
+    size_t size() const;
+    void setRevalidateInterval(std::chrono::milliseconds interval);
+
+private:
+    AssetPtr loadFile(const std::string& key, const std::filesystem::path& file) const;
+
+    std::filesystem::path root_;
+    std::chrono::milliseconds revalidateInterval_;
+    mutable std::shared_mutex mutex_;
+    std::map<std::string, AssetPtr, std::less<>> assets_;
+};
+
+} // namespace whot::network
+
+#endif // WHOT_NETWORK_STATIC_ASSET_CACHE_HPP
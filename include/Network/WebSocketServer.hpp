@@ -7,6 +7,7 @@
 #include <functional>
 #include <thread>
 #include <atomic>
+#include <vector>
 
 namespace whot::network {
 
@@ -15,6 +16,10 @@ using MessageHandler = std::function<void(const std::string& sessionId,
 using ConnectionHandler    = std::function<void(const std::string& sessionId)>;
 using DisconnectionHandler = std::function<void(const std::string& sessionId)>;
 
+/// websocketpp over one asio io_service run by a pool of IO threads.
+/// websocketpp wraps each connection's handlers in its own strand, so one
+/// connection's frames and callbacks stay ordered while different
+/// connections are served in parallel. Handlers must be thread-safe.
 class WebSocketServer {
 public:
     explicit WebSocketServer(uint16_t port);
@@ -30,7 +35,10 @@ public:
     void setConnectionHandler(ConnectionHandler handler);
     void setDisconnectionHandler(DisconnectionHandler handler);
     void broadcastMessage(const Message& message);
+    /// Binary frame (Message::encode) if the session negotiated
+    /// kBinarySubprotocol, else a JSON text frame.
     void sendMessage(const std::string& sessionId, const Message& message);
+    bool usesBinaryProtocol(const std::string& sessionId) const;
     void sendToGame(const std::string& gameId, const Message& message);
     
     // Session management
@@ -38,6 +46,8 @@ public:
     
     // Configuration
     void setMaxConnections(size_t max);
+    /// Threads running the io_service (0 = hardware concurrency); set before start().
+    void setIoThreads(size_t count);
     void setHeartbeatInterval(int seconds);
     void setTimeout(int seconds);
     
@@ -55,10 +65,11 @@ private:
     ConnectionHandler connectionHandler_;
     DisconnectionHandler disconnectionHandler_;
 
-    std::thread serverThread_;
+    std::vector<std::thread> ioThreads_;
 
     // Connection tracking
     size_t maxConnections_;
+    size_t ioThreadCount_;
     int heartbeatInterval_;
     int timeout_;
 
@@ -69,7 +80,7 @@ private:
     void handleConnection(const std::string& sessionId);
     void handleDisconnection(const std::string& sessionId);
     void handleIncomingMessage(const std::string& sessionId,
-                               const std::string& data);
+                               const std::string& data, bool binary);
 
     void runHeartbeat();
     void checkTimeouts();
@@ -1,6 +1,8 @@
 #ifndef WHOT_PERSISTENCE_DATABASE_HPP
 #define WHOT_PERSISTENCE_DATABASE_HPP
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <variant>
 #include <vector>
@@ -9,9 +11,16 @@
 
 namespace whot::persistence {
 
-// A typed parameter for parameterised queries.  Only text and 64-bit
-// integer variants are needed; NULLs are represented by an empty text.
-using SqlParam = std::variant<std::string, int64_t>;
+// Binary column value (e.g. a game snapshot); bound as a BLOB, so embedded
+// NUL bytes survive the round trip.
+struct SqlBlob {
+    std::string bytes;
+};
+
+// A typed parameter for parameterised queries: text, 64-bit integer or
+// blob; NULLs are represented by an empty text.  Query results come back as
+// strings, blob columns byte for byte.
+using SqlParam = std::variant<std::string, int64_t, SqlBlob>;
 
 enum class DatabaseType {
     SQLITE,
@@ -29,6 +38,16 @@ struct DatabaseConfig {
     std::string password;
     std::string filepath;  // For SQLite
     int poolSize = 10;
+    /// Prepared statements kept per connection, keyed by SQL text (0 = none).
+    size_t statementCacheSize = 32;
+};
+
+struct StatementCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;     // statements prepared
+    uint64_t evictions = 0;  // least recently used statements finalized
+    std::chrono::nanoseconds prepareTime{0};  // total spent preparing
+    size_t size = 0;
 };
 
 class Database {
@@ -55,15 +74,20 @@ public:
     virtual std::vector<std::string> queryManyBound(
         const std::string& sql, const std::vector<SqlParam>& params) = 0;
     
-    // Transactions
-    virtual void beginTransaction() = 0;
-    virtual void commit() = 0;
-    virtual void rollback() = 0;
+    // Transactions; false if the statement failed. A failed commit leaves
+    // the transaction open, so the caller must roll back.
+    virtual bool beginTransaction() = 0;
+    virtual bool commit() = 0;
+    virtual bool rollback() = 0;
     
     // Schema management
     virtual void initializeSchema() = 0;
     virtual void migrate(int toVersion) = 0;
     virtual int getCurrentSchemaVersion() = 0;
+
+    /// Reuse of the statements behind the *Bound queries; zero for backends
+    /// without a cache.
+    virtual StatementCacheStats getStatementCacheStats() const { return {}; }
     
 protected:
     DatabaseConfig config_;
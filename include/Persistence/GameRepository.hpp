@@ -1,6 +1,7 @@
 #ifndef WHOT_PERSISTENCE_GAME_REPOSITORY_HPP
 #define WHOT_PERSISTENCE_GAME_REPOSITORY_HPP
 
+#include "Game/GameJournal.hpp"
 #include "Game/GameState.hpp"
 #include "Persistence/Database.hpp"
 #include <memory>
@@ -20,15 +21,34 @@ struct GameRecord {
     std::vector<std::string> playerIds;
 };
 
+/// The rows saveGame() writes for one state, captured up front so they can
+/// be written later from another thread (see WriteBehindQueue).
+struct GameWrite {
+    std::string gameId;
+    std::string json;
+    std::string snapshot;
+    std::string status;
+    std::vector<std::string> playerIds;
+    /// New journal bytes, appended at `journal.offset` (0 replaces the
+    /// stored journal); empty if nothing was recorded.
+    game::GameJournal::Suffix journal;
+};
+
 class GameRepository {
 public:
     explicit GameRepository(Database* database);
     
     // CRUD operations
     bool saveGame(const game::GameState& state);
+    /// Serializes `state`; call where the state may be read (its strand).
+    static GameWrite captureGame(const game::GameState& state);
+    bool writeGame(const GameWrite& write);
     std::optional<game::GameState> loadGame(const std::string& gameId);
     bool updateGame(const game::GameState& state);
     bool deleteGame(const std::string& gameId);
+    /// The journal appended by writeGame(); nullopt if there is none, a
+    /// chunk is missing or the bytes do not parse.
+    std::optional<game::GameJournal> loadJournal(const std::string& gameId);
     
     // Queries
     std::vector<GameRecord> getActiveGames();
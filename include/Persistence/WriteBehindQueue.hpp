@@ -0,0 +1,113 @@
+#ifndef WHOT_PERSISTENCE_WRITE_BEHIND_QUEUE_HPP
+#define WHOT_PERSISTENCE_WRITE_BEHIND_QUEUE_HPP
+
+#include "Persistence/Database.hpp"
+#include "Persistence/GameRepository.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace whot::persistence {
+
+struct WriteQueueConfig {
+    /// How long the writer gathers writes before committing them as one
+    /// transaction.
+    std::chrono::milliseconds flushInterval{50};
+    /// Pending games plus tasks; enqueueing beyond this waits for a flush.
+    size_t capacity = 1024;
+};
+
+/// Moves SQLite writes off the game strands onto one writer thread. A
+/// game's pending rows are replaced by its next save or delete (last write
+/// wins), and everything gathered in a flush interval is committed in one
+/// transaction. While the queue is not running every call writes inline on
+/// the calling thread, as WorkerPool and TimerQueue do.
+class WriteBehindQueue {
+public:
+    struct Stats {
+        uint64_t enqueued = 0;   // saves, deletes and tasks accepted
+        uint64_t coalesced = 0;  // game writes replaced before reaching the database
+        uint64_t written = 0;    // game writes, deletes and tasks executed
+        uint64_t failed = 0;     // game writes rejected, or lost to a failed commit
+        uint64_t batches = 0;    // transactions committed by the writer
+        uint64_t rolledBack = 0; // batches whose COMMIT failed
+    };
+
+    WriteBehindQueue(Database& database, GameRepository& games,
+                     const WriteQueueConfig& config = {});
+    ~WriteBehindQueue();
+
+    WriteBehindQueue(const WriteBehindQueue&) = delete;
+    WriteBehindQueue& operator=(const WriteBehindQueue&) = delete;
+
+    void start();
+    /// Commits everything still pending, then joins the writer.
+    void stop();
+    bool isRunning() const;
+
+    /// Captures `state` now (call on its strand) and writes it later, with
+    /// the journal bytes recorded since the previous save. A save that
+    /// replaces a pending one keeps the pending journal bytes, and the
+    /// journal bytes of a write that failed go out with the game's next save.
+    void saveGame(const game::GameState& state, game::GameJournal::Suffix journal = {});
+    /// Drops any pending save of the game and deletes its rows.
+    void deleteGame(const std::string& gameId);
+    /// Any other write (e.g. player rows), run in order on the writer thread
+    /// inside the current batch's transaction.
+    void post(std::function<void()> write);
+
+    /// Blocks until everything enqueued before the call is committed.
+    void flush();
+    size_t pendingCount() const;
+    Stats getStats() const;
+
+private:
+    // One slot per pending game (nullopt write = delete), or a plain task.
+    struct Item {
+        std::string gameId;
+        std::optional<GameWrite> write;
+        std::function<void()> task;
+        bool failed = false;  // set by writeBatch() for a game write
+    };
+
+    void enqueue(Item item, std::unique_lock<std::mutex>& lock);
+    void run();
+    /// One batch in one transaction; marks and counts the game writes that
+    /// failed.
+    uint64_t writeBatch(std::vector<Item>& batch, bool& committed);
+    /// False if the repository rejected a game write.
+    bool execute(Item& item);
+    /// Hands the journal bytes of a failed game write to the game's pending
+    /// or next save, so the stored journal keeps no gap.
+    void keepJournal(Item& item);
+
+    Database& database_;
+    GameRepository& games_;
+    WriteQueueConfig config_;
+
+    std::vector<Item> pending_;
+    std::unordered_map<std::string, size_t> gameSlots_;  // gameId -> index in pending_
+    std::unordered_map<std::string, game::GameJournal::Suffix> unsavedJournals_;  // from failed writes
+    uint64_t enqueuedSeq_ = 0;
+    uint64_t committedSeq_ = 0;
+    bool flushRequested_ = false;
+    Stats stats_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable writerCv_;     // wakes the writer
+    std::condition_variable committedCv_;  // wakes flush() and blocked producers
+    std::thread thread_;
+    bool running_ = false;       // accepting writes for the writer thread
+    bool writerActive_ = false;  // writer thread not finished yet
+};
+
+} // namespace whot::persistence
+
+#endif // WHOT_PERSISTENCE_WRITE_BEHIND_QUEUE_HPP
@@ -2,6 +2,7 @@
 #define WHOT_RULES_NIGERIAN_RULES_HPP
 
 #include "Core/Card.hpp"
+#include "Core/CardMask.hpp"
 #include "Core/Player.hpp"
 #include "Core/Hand.hpp"
 #include <vector>
@@ -67,6 +68,14 @@ public:
      */
     bool canDefendAgainstAttack(const core::Card& attackCard,
                                 const core::Card& defenseCard) const;
+
+    /**
+     * Mask forms of canPlayCard / canDefendAgainstAttack: every card identity
+     * the check accepts, for AND-ing against Hand::getCardMask()
+     */
+    core::CardMask playableMask(const core::Card& callCard,
+                                std::optional<core::Suit> demandedSuit = std::nullopt) const;
+    core::CardMask defenseMask(const core::Card& attackCard) const;
     
     /**
      * Validate double-decking sequence
@@ -76,7 +85,7 @@ public:
      * - First card must match the call card
      * - Cards change the suit to the last card played
      */
-    bool validateDoubleDecking(const std::vector<const core::Card*>& cards,
+    bool validateDoubleDecking(const std::vector<core::Card>& cards,
                                const core::Card& callCard) const;
     
     // ========================================
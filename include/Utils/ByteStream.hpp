@@ -0,0 +1,64 @@
+#ifndef WHOT_UTILS_BYTE_STREAM_HPP
+#define WHOT_UTILS_BYTE_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace whot::utils {
+
+/// Appends compact binary fields to a string: single bytes, fixed-width
+/// little-endian words, LEB128 varints (7 bits per byte, low bits first) and
+/// varint-length-prefixed strings.
+class ByteWriter {
+public:
+    explicit ByteWriter(std::string& out) : out_(out) {}
+
+    void u8(uint8_t value) { out_.push_back(static_cast<char>(value)); }
+    void u64(uint64_t value);
+    void varint(uint64_t value);
+    /// Zigzag-mapped varint, so small negative numbers stay one byte.
+    void svarint(int64_t value);
+    void str(std::string_view value);
+    void bytes(std::string_view value) { out_.append(value); }
+
+private:
+    std::string& out_;
+};
+
+/// Reads what ByteWriter wrote. Reading past the end or a varint longer
+/// than 10 bytes marks the reader failed; later reads then return zero or
+/// empty, so callers check ok() once after decoding a whole record.
+class ByteReader {
+public:
+    explicit ByteReader(std::string_view in) : in_(in) {}
+
+    uint8_t u8();
+    uint64_t u64();
+    uint64_t varint();
+    int64_t svarint();
+    /// View into the input; valid while the input is.
+    std::string_view str();
+    /// The next `size` bytes; empty and failed if fewer remain.
+    std::string_view bytes(size_t size);
+    /// Everything not read yet.
+    std::string_view rest();
+
+    bool ok() const { return ok_; }
+    bool atEnd() const { return pos_ == in_.size(); }
+    /// Bytes not read yet; bounds element counts before reserving.
+    size_t remaining() const { return in_.size() - pos_; }
+
+private:
+    std::string_view in_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+/// FNV-1a over `data`, for detecting damaged records (not tampering).
+uint64_t checksum64(std::string_view data);
+
+} // namespace whot::utils
+
+#endif // WHOT_UTILS_BYTE_STREAM_HPP
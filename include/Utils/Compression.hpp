@@ -0,0 +1,29 @@
+#ifndef WHOT_UTILS_COMPRESSION_HPP
+#define WHOT_UTILS_COMPRESSION_HPP
+
+#include <string>
+#include <string_view>
+
+namespace whot::utils {
+
+/// zlib wrappers. Level follows zlib: 1 (fastest) to 9 (smallest).
+class Compression {
+public:
+    /// GZIP is HTTP "gzip"; ZLIB is HTTP "deflate" (RFC 1950 framing).
+    enum class Format { GZIP, ZLIB };
+
+    /// Whole-buffer, not streaming: `data` is complete and the result is
+    /// returned in one string. Deflates directly into the result through a
+    /// z_stream kept per thread and reset between calls, so repeated small
+    /// bodies skip zlib's setup cost.
+    static std::string compress(std::string_view data, Format format, int level = 6);
+    static std::string gzip(std::string_view data, int level = 9);
+    /// Inverse of gzip(); throws std::runtime_error on corrupt input.
+    static std::string gunzip(std::string_view data);
+    /// Inverse of compress(data, ZLIB); throws std::runtime_error on corrupt input.
+    static std::string inflate(std::string_view data);
+};
+
+} // namespace whot::utils
+
+#endif // WHOT_UTILS_COMPRESSION_HPP
@@ -0,0 +1,80 @@
+#ifndef WHOT_UTILS_EXECUTOR_HPP
+#define WHOT_UTILS_EXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace whot::utils {
+
+using Task = std::function<void()>;
+
+/// Fixed-size pool of worker threads draining a shared FIFO of tasks.
+/// While the pool is not running, submit() executes the task inline on the
+/// calling thread, so code paths that never call start() (tests, tools)
+/// keep fully synchronous behaviour.
+class WorkerPool {
+public:
+    /// threadCount == 0 selects std::thread::hardware_concurrency().
+    explicit WorkerPool(size_t threadCount = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void start();
+    /// Runs every task already queued, then joins the workers.
+    void stop();
+    bool isRunning() const;
+    size_t getThreadCount() const;
+
+    void submit(Task task);
+
+private:
+    void workerLoop();
+
+    size_t threadCount_;
+    std::vector<std::thread> workers_;
+    std::deque<Task> queue_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> running_;
+    bool stopping_;
+};
+
+/// Serialized mailbox on top of a WorkerPool: tasks posted to one strand
+/// never run concurrently and run in posting order, while different strands
+/// proceed in parallel on the pool's workers.
+class Strand : public std::enable_shared_from_this<Strand> {
+public:
+    explicit Strand(WorkerPool& pool);
+
+    Strand(const Strand&) = delete;
+    Strand& operator=(const Strand&) = delete;
+
+    void post(Task task);
+    /// Runs the task immediately when already executing on this strand,
+    /// otherwise behaves like post().
+    void dispatch(Task task);
+    /// True when the calling thread is currently executing a task of this strand.
+    bool runningInThisThread() const;
+    size_t pendingCount() const;
+
+private:
+    void drain();
+
+    WorkerPool& pool_;
+    std::deque<Task> queue_;
+    mutable std::mutex mutex_;
+    bool active_;
+};
+
+} // namespace whot::utils
+
+#endif // WHOT_UTILS_EXECUTOR_HPP
@@ -0,0 +1,63 @@
+#ifndef WHOT_UTILS_FAST_RNG_HPP
+#define WHOT_UTILS_FAST_RNG_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace whot::utils {
+
+/// xoshiro256** generator: 32 bytes of state, a few cycles per draw, and the
+/// same sequence on every platform for a given seed. Satisfies
+/// UniformRandomBitGenerator, but prefer below() over <random> distributions
+/// where results must be reproducible across standard libraries.
+class FastRng {
+public:
+    using result_type = uint64_t;
+
+    explicit FastRng(uint64_t seed = 0);
+
+    /// Expands the 64-bit seed into the full state with splitmix64.
+    void seed(uint64_t seed);
+
+    /// Full generator state, to resume the exact sequence (snapshots).
+    std::array<uint64_t, 4> state() const { return {s_[0], s_[1], s_[2], s_[3]}; }
+    void setState(const std::array<uint64_t, 4>& state) {
+        for (int i = 0; i < 4; ++i) s_[i] = state[i];
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        const uint64_t result = rotl(s_[1] * 5, 7) * 9;
+        const uint64_t t = s_[1] << 17;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = rotl(s_[3], 45);
+        return result;
+    }
+
+    /// Uniform in [0, bound) for bound < 2^32 (multiply-shift, no modulo).
+    uint32_t below(uint32_t bound) {
+        return static_cast<uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+    /// Distinct seed per call: one random_device read per process, then a
+    /// splitmix64 counter, so creating many games costs no syscalls.
+    static uint64_t freshSeed();
+
+private:
+    static constexpr uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t s_[4];
+};
+
+} // namespace whot::utils
+
+#endif // WHOT_UTILS_FAST_RNG_HPP
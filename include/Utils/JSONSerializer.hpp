@@ -2,9 +2,13 @@
 #define WHOT_UTILS_JSON_SERIALIZER_HPP
 
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
 #include <optional>
+#include <charconv>
+#include <cstdint>
+#include <type_traits>
 
 namespace whot::utils {
 
@@ -41,6 +45,47 @@ public:
     static std::string unescape(const std::string& str);
 };
 
+/// Appends JSON to a string without building a DOM. Commas are inserted
+/// automatically; raw() splices an already-serialized value verbatim, so
+/// nested documents are not escaped into strings.
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out) : out_(out) {}
+
+    JsonWriter& beginObject() { separate(); out_.push_back('{'); needComma_ = false; return *this; }
+    JsonWriter& endObject() { out_.push_back('}'); needComma_ = true; return *this; }
+    JsonWriter& beginArray() { separate(); out_.push_back('['); needComma_ = false; return *this; }
+    JsonWriter& endArray() { out_.push_back(']'); needComma_ = true; return *this; }
+    JsonWriter& key(std::string_view name);
+
+    JsonWriter& value(std::string_view str);
+    JsonWriter& value(const char* str) { return value(std::string_view(str)); }
+    JsonWriter& value(const std::string& str) { return value(std::string_view(str)); }
+    JsonWriter& value(bool b) { separate(); out_.append(b ? "true" : "false"); return *this; }
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    JsonWriter& value(T number) {
+        separate();
+        char buf[24];
+        out_.append(buf, std::to_chars(buf, buf + sizeof(buf), number).ptr);
+        return *this;
+    }
+    JsonWriter& null() { separate(); out_.append("null"); return *this; }
+    /// `json` must be one complete JSON value.
+    JsonWriter& raw(std::string_view json) { separate(); out_.append(json); return *this; }
+
+    /// Appends `str` as a quoted JSON string literal.
+    static void appendEscaped(std::string& out, std::string_view str);
+
+private:
+    void separate() {
+        if (needComma_) out_.push_back(',');
+        needComma_ = true;
+    }
+
+    std::string& out_;
+    bool needComma_ = false;
+};
+
 } // namespace whot::utils
 
 #endif // WHOT_UTILS_JSON_SERIALIZER_HPP
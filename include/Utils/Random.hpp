@@ -1,11 +1,16 @@
 #ifndef WHOT_UTILS_RANDOM_HPP
 #define WHOT_UTILS_RANDOM_HPP
 
-#include <random>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace whot::utils {
 
+/// Process-wide facade over thread-local FastRng streams. Every thread draws
+/// from its own generator, so calls never race or contend. Streams are
+/// derived from a base seed: randomSeed() (the default) picks a fresh one;
+/// seed() makes every stream deterministic for tests.
 class Random {
 public:
     static Random& getInstance();
@@ -26,15 +31,18 @@ public:
     std::string generateUUID();
     
     // Seeding
+    /// Deterministic mode: the calling thread restarts on stream 0 of `seed`;
+    /// other threads take streams 1, 2, ... in order of their next draw.
     void seed(unsigned int seed);
+    /// Pins the calling thread to a given stream of the current base seed,
+    /// for tests that need a reproducible sequence on a worker thread.
+    void seedStream(uint64_t streamId);
     void randomSeed();
     
 private:
     Random();
     Random(const Random&) = delete;
     Random& operator=(const Random&) = delete;
-    
-    std::mt19937 generator_;
 };
 
 } // namespace whot::utils
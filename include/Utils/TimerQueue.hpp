@@ -0,0 +1,67 @@
+#ifndef WHOT_UTILS_TIMER_QUEUE_HPP
+#define WHOT_UTILS_TIMER_QUEUE_HPP
+
+#include "Utils/Executor.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace whot::utils {
+
+/// Min-heap of deadlines served by a single timer thread. Callbacks run on
+/// that thread and should only hand work off (e.g. post to a Strand).
+/// While the queue is not running, schedule() fires the task immediately on
+/// the calling thread, mirroring WorkerPool's inline mode.
+class TimerQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+
+    TimerQueue();
+    ~TimerQueue();
+
+    TimerQueue(const TimerQueue&) = delete;
+    TimerQueue& operator=(const TimerQueue&) = delete;
+
+    void start();
+    /// Joins the timer thread; timers that have not fired are dropped.
+    void stop();
+    bool isRunning() const;
+
+    /// Returns 0 when the task fired inline.
+    TimerId schedule(std::chrono::milliseconds delay, Task task);
+    /// False if the timer already fired or was never scheduled.
+    bool cancel(TimerId id);
+    size_t pendingCount() const;
+
+private:
+    struct Entry {
+        Clock::time_point deadline;
+        TimerId id;
+    };
+    struct Later {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return a.deadline != b.deadline ? a.deadline > b.deadline : a.id > b.id;
+        }
+    };
+
+    void run();
+
+    // Cancelled timers leave a stale heap entry that run() skips.
+    std::priority_queue<Entry, std::vector<Entry>, Later> heap_;
+    std::unordered_map<TimerId, Task> tasks_;
+    TimerId nextId_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+    bool running_;
+};
+
+} // namespace whot::utils
+
+#endif // WHOT_UTILS_TIMER_QUEUE_HPP
@@ -2,6 +2,7 @@
 #define WHOT_UTILS_VALIDATION_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <functional>
 
@@ -21,6 +22,8 @@ public:
     static bool hasMaxLength(const std::string& str, size_t maxLength);
     static bool isAlphanumeric(const std::string& str);
     static bool matchesPattern(const std::string& str, const std::string& pattern);
+    /// Well-formed UTF-8: no overlong forms, surrogates or code points above U+10FFFF.
+    static bool isValidUtf8(std::string_view str);
     
     // Numeric validation
     static bool isInRange(int value, int min, int max);
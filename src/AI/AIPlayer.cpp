@@ -1,8 +1,6 @@
 #include "../../include/AI/AIPlayer.hpp"
 #include "../../include/Game/ActionTypes.hpp"
 #include "../../include/Utils/Random.hpp"
-#include <thread>
-#include <chrono>
 
 namespace whot::ai {
 
@@ -15,9 +13,6 @@ AIPlayer::AIPlayer(const std::string& id, const std::string& name, DifficultyLev
 {}
 
 game::GameAction AIPlayer::decideAction(const game::GameState& state) {
-    if (thinkingDelay_ > 0)
-        std::this_thread::sleep_for(std::chrono::milliseconds(thinkingDelay_));
-
     game::GameAction action;
     action.playerId = id_;
     action.type = game::ActionType::DRAW_CARD;
@@ -41,7 +36,7 @@ game::GameAction AIPlayer::decideAction(const game::GameState& state) {
     }
 
     if (state.getActivePickCount() > 0) {
-        const core::Card* call = state.getCallCard();
+        std::optional<core::Card> call = state.getCallCard();
         if (call && shouldDefendAgainstPick(state, *call)) {
             std::vector<size_t> defense;
             const core::Player* cur = state.getCurrentPlayer();
@@ -96,8 +91,10 @@ void AIPlayer::setThinkingDelay(int milliseconds) {
     thinkingDelay_ = milliseconds;
 }
 
+int AIPlayer::getThinkingDelay() const { return thinkingDelay_; }
+
 std::vector<size_t> AIPlayer::getPlayableCards(const game::GameState& state) const {
-    const core::Card* call = state.getCallCard();
+    std::optional<core::Card> call = state.getCallCard();
     const core::Player* cur = state.getCurrentPlayer();
     if (!call || !cur || cur->getId() != id_) return {};
     return cur->getHand().getPlayableCardIndices(*call);
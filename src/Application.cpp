@@ -4,6 +4,7 @@
 #include "../include/Network/MessageProtocol.hpp"
 #include "../include/AI/AIPlayer.hpp"
 #include "../include/AI/DifficultyLevel.hpp"
+#include "Utils/Logger.hpp"
 #include "Utils/Random.hpp"
 #include "Persistence/Database.hpp"
 #include "Game/GameEngine.hpp"
@@ -16,6 +17,7 @@
 #include <nlohmann/json.hpp>
 #include <atomic>
 #include <condition_variable>
+#include <future>
 #include <mutex>
 
 // Set by signal handler to request shutdown.
@@ -28,6 +30,8 @@ constexpr size_t kMaxPlayerNameLength = 30;
 constexpr size_t kMinGameCodeLength = 4;
 constexpr size_t kMaxGameCodeLength = 12;
 constexpr int kDefaultLobbyStaleSeconds = 1800;
+// Bot turns in a row without a human move before bots stop scheduling.
+constexpr int kMaxConsecutiveBotTurns = 50;
 
 std::string trim(const std::string& input) {
     size_t start = 0;
@@ -43,7 +47,12 @@ std::string trim(const std::string& input) {
 
 std::string sanitizePlayerName(const std::string& raw) {
     std::string out = trim(raw);
-    if (out.size() > kMaxPlayerNameLength) out.resize(kMaxPlayerNameLength);
+    if (out.size() > kMaxPlayerNameLength) {
+        // Cut on a character boundary, not through a multi-byte sequence.
+        size_t cut = kMaxPlayerNameLength;
+        while (cut > 0 && (static_cast<unsigned char>(out[cut]) & 0xC0) == 0x80) --cut;
+        out.resize(cut);
+    }
     return out;
 }
 
@@ -59,6 +68,12 @@ std::string normalizeGameCode(const std::string& raw) {
     return out;
 }
 
+ai::DifficultyLevel botDifficulty(core::PlayerType type) {
+    if (type == core::PlayerType::AI_MEDIUM) return ai::DifficultyLevel::MEDIUM;
+    if (type == core::PlayerType::AI_HARD) return ai::DifficultyLevel::HARD;
+    return ai::DifficultyLevel::EASY;
+}
+
 bool isValidGameCode(const std::string& code) {
     if (code.size() < kMinGameCodeLength || code.size() > kMaxGameCodeLength) return false;
     return std::all_of(code.begin(), code.end(), [](unsigned char c) { return std::isalnum(c); });
@@ -67,6 +82,8 @@ bool isValidGameCode(const std::string& code) {
 
 Application::Application(const ApplicationConfig& config)
     : config_(config)
+    , workerPool_(std::make_unique<utils::WorkerPool>(config.gameWorkerThreads))
+    , botTimers_(std::make_unique<utils::TimerQueue>())
 {
 }
 
@@ -82,6 +99,10 @@ void Application::initialize()
 
 void Application::run()
 {
+    // Until the pool runs, strands execute inline on the posting thread.
+    if (writeQueue_) writeQueue_->start();
+    workerPool_->start();
+    botTimers_->start();
     if (wsServer_) wsServer_->start();
     if (httpServer_) httpServer_->start();
 
@@ -103,6 +124,10 @@ void Application::shutdown()
 {
     if (wsServer_ && wsServer_->isRunning()) wsServer_->stop();
     if (httpServer_ && httpServer_->isRunning()) httpServer_->stop();
+    botTimers_->stop();
+    workerPool_->stop();
+    // Strands are done; commit what they queued before closing the database.
+    if (writeQueue_) writeQueue_->stop();
     if (database_ && database_->isConnected()) database_->disconnect();
 }
 
@@ -120,17 +145,20 @@ std::string Application::createGame(const game::GameConfig& gameConfig)
     if (gameCode.empty())
         gameCode = utils::Random::getInstance().generateGameCode(6);
     state->setGameCode(gameCode);
+    GameSummary summary = summarize(*state);
     auto engine = std::make_unique<game::GameEngine>(std::move(state));
     {
         std::lock_guard<std::mutex> lock(gamesMutex_);
         if (activeGames_.size() >= static_cast<size_t>(config_.maxGamesPerServer))
             return {};
         activeGames_[gameId] = std::move(engine);
+        gameSummaries_[gameId] = std::move(summary);
         gameActivity_[gameId] = std::chrono::steady_clock::now();
+        gameStrands_[gameId] = std::make_shared<utils::Strand>(*workerPool_);
     }
-    game::GameEngine* eng = getGame(gameId);
-    if (gameRepo_ && eng)
-        gameRepo_->saveGame(*eng->getState());
+    runOnGame(gameId, [&] {
+        if (game::GameEngine* eng = getGame(gameId)) saveGame(*eng);
+    });
     return gameId;
 }
 
@@ -138,8 +166,8 @@ std::string Application::getGameIdByCode(const std::string& gameCode) const
 {
     if (gameCode.empty()) return {};
     std::lock_guard<std::mutex> lock(gamesMutex_);
-    for (const auto& [gid, engine] : activeGames_) {
-        if (engine && engine->getState() && engine->getState()->getGameCode() == gameCode)
+    for (const auto& [gid, summary] : gameSummaries_) {
+        if (summary.gameCode == gameCode)
             return gid;
     }
     return {};
@@ -147,97 +175,159 @@ std::string Application::getGameIdByCode(const std::string& gameCode) const
 
 void Application::addBotsToGame(const std::string& gameId, int botCount)
 {
+    runOnGame(gameId, [&] {
+        game::GameEngine* engine = getGame(gameId);
+        if (!engine || !engine->getState() || botCount <= 0) return;
+        game::GameState* state = engine->getState();
+        int maxBots = static_cast<int>(state->getConfig().maxPlayers) - static_cast<int>(state->getPlayerCount());
+        if (maxBots <= 0) return;
+        if (botCount > maxBots) botCount = maxBots;
+        for (int i = 0; i < botCount; ++i) {
+            std::ostringstream idSs, nameSs;
+            idSs << "bot-" << gameId << "-" << i;
+            nameSs << "Bot " << (i + 1);
+            auto bot = std::make_unique<core::Player>(idSs.str(), nameSs.str(), core::PlayerType::AI_EASY);
+            state->addPlayer(std::move(bot));
+        }
+        saveGame(*engine);
+    });
+}
+
+void Application::runBotTurnsIfNeeded(const std::string& gameId)
+{
+    runOnGame(gameId, [&] { scheduleBotTurn(gameId, 0); });
+}
+
+void Application::scheduleBotTurn(const std::string& gameId, int streak)
+{
+    if (streak >= kMaxConsecutiveBotTurns) return;
     game::GameEngine* engine = getGame(gameId);
-    if (!engine || !engine->getState() || botCount <= 0) return;
+    if (!engine || !engine->getState()) return;
     game::GameState* state = engine->getState();
-    int maxBots = static_cast<int>(state->getConfig().maxPlayers) - static_cast<int>(state->getPlayerCount());
-    if (maxBots <= 0) return;
-    if (botCount > maxBots) botCount = maxBots;
-    for (int i = 0; i < botCount; ++i) {
-        std::ostringstream idSs, nameSs;
-        idSs << "bot-" << gameId << "-" << i;
-        nameSs << "Bot " << (i + 1);
-        auto bot = std::make_unique<core::Player>(idSs.str(), nameSs.str(), core::PlayerType::AI_EASY);
-        state->addPlayer(std::move(bot));
+    if (state->getPhase() != game::GamePhase::IN_PROGRESS) return;
+    core::Player* current = state->getCurrentPlayer();
+    if (!current || current->getType() == core::PlayerType::HUMAN) return;
+    {
+        std::lock_guard<std::mutex> lock(gamesMutex_);
+        // The turn already scheduled will re-check whose move it is.
+        if (!pendingBotTurns_.emplace(gameId, 0).second) return;
     }
-    if (gameRepo_)
-        gameRepo_->saveGame(*state);
+    const std::string botId = current->getId();
+    const int delayMs = ai::DifficultyConfig::getThinkingDelay(botDifficulty(current->getType()));
+    const utils::TimerQueue::TimerId timerId = botTimers_->schedule(
+        std::chrono::milliseconds(delayMs),
+        [this, gameId, botId, streak] {
+            postToGame(gameId, [this, gameId, botId, streak] { playBotTurn(gameId, botId, streak); });
+        });
+    std::lock_guard<std::mutex> lock(gamesMutex_);
+    auto it = pendingBotTurns_.find(gameId);
+    if (it != pendingBotTurns_.end()) it->second = timerId;
 }
 
-void Application::runBotTurnsIfNeeded(const std::string& gameId)
+void Application::playBotTurn(const std::string& gameId, const std::string& botId, int streak)
 {
-    const int maxIterations = 50;
-    for (int iter = 0; iter < maxIterations; ++iter) {
-        game::GameEngine* engine = getGame(gameId);
-        if (!engine || !engine->getState()) break;
-        game::GameState* state = engine->getState();
-        if (state->getPhase() != game::GamePhase::IN_PROGRESS) break;
-        core::Player* current = state->getCurrentPlayer();
-        if (!current || current->getType() == core::PlayerType::HUMAN) break;
-        ai::DifficultyLevel level = ai::DifficultyLevel::EASY;
-        if (current->getType() == core::PlayerType::AI_MEDIUM) level = ai::DifficultyLevel::MEDIUM;
-        else if (current->getType() == core::PlayerType::AI_HARD) level = ai::DifficultyLevel::HARD;
-        ai::AIPlayer ai(current->getId(), current->getName(), level);
-        game::GameAction action = ai.decideAction(*state);
-        game::ActionResult result = engine->processAction(action);
-        if (!result.success) break;
+    {
+        std::lock_guard<std::mutex> lock(gamesMutex_);
+        pendingBotTurns_.erase(gameId);
+    }
+    game::GameEngine* engine = getGame(gameId);
+    if (!engine || !engine->getState()) return;
+    game::GameState* state = engine->getState();
+    if (state->getPhase() != game::GamePhase::IN_PROGRESS) return;
+    core::Player* current = state->getCurrentPlayer();
+    if (!current || current->getId() != botId) {
+        scheduleBotTurn(gameId, streak);  // turn moved on while the bot was thinking
+        return;
+    }
+    ai::AIPlayer ai(current->getId(), current->getName(), botDifficulty(current->getType()));
+    game::GameAction action = ai.decideAction(*state);
+    game::ActionResult result = engine->processAction(action);
+    if (!result.success) {
+        LOG_WARNING("Bot " + botId + " action rejected in game " + gameId + ": " + result.message);
+        return;
+    }
+    broadcastGameState(gameId);
+    state = engine->getState();
+    if (state->getPhase() == game::GamePhase::ROUND_ENDED && !state->checkGameEnd()) {
+        engine->startNewRound();
         broadcastGameState(gameId);
-        state = engine->getState();
-        if (state->getPhase() == game::GamePhase::ROUND_ENDED && !state->checkGameEnd()) {
-            engine->startNewRound();
-            broadcastGameState(gameId);
-        }
     }
+    saveGame(*engine);
+    scheduleBotTurn(gameId, streak + 1);
 }
 
 bool Application::joinGame(const std::string& gameId, const std::string& playerId,
                            const std::string& playerName)
 {
-    game::GameEngine* engine = getGame(gameId);
-    if (!engine) return false;
-    game::GameState* state = engine->getState();
-    if (!state) return false;
-    if (state->getPhase() != game::GamePhase::LOBBY) return false;
-    if (state->getPlayer(playerId)) return true;  // already in game
-    if (state->getPlayerCount() >= static_cast<size_t>(state->getConfig().maxPlayers))
-        return false;
-    std::string name = playerName.empty() ? playerId : playerName;
-    auto player = std::make_unique<core::Player>(playerId, name, core::PlayerType::HUMAN);
-    state->addPlayer(std::move(player));
-    if (playerRepo_) {
-        core::Player* p = state->getPlayer(playerId);
-        if (p) playerRepo_->savePlayer(*p);
-    }
-    if (gameRepo_)
-        gameRepo_->saveGame(*state);
-    touchGameActivity(gameId);
-    return true;
+    bool joined = false;
+    runOnGame(gameId, [&] {
+        game::GameEngine* engine = getGame(gameId);
+        if (!engine) return;
+        game::GameState* state = engine->getState();
+        if (!state) return;
+        if (state->getPhase() != game::GamePhase::LOBBY) return;
+        if (state->getPlayer(playerId)) {  // already in game
+            joined = true;
+            return;
+        }
+        if (state->getPlayerCount() >= static_cast<size_t>(state->getConfig().maxPlayers))
+            return;
+        std::string name = playerName.empty() ? playerId : playerName;
+        auto player = std::make_unique<core::Player>(playerId, name, core::PlayerType::HUMAN);
+        state->addPlayer(std::move(player));
+        if (writeQueue_ && playerRepo_) {
+            core::Player* p = state->getPlayer(playerId);
+            if (p) writeQueue_->post([this, player = *p] { playerRepo_->savePlayer(player); });
+        }
+        saveGame(*engine);
+        touchGameActivity(gameId);
+        joined = true;
+    });
+    return joined;
 }
 
 bool Application::leaveGame(const std::string& gameId, const std::string& playerId)
 {
-    game::GameEngine* engine = getGame(gameId);
-    if (!engine) return false;
-    engine->getState()->removePlayer(playerId);
-    if (wsServer_ && wsServer_->getSessionManager()) {
-        std::string sid = wsServer_->getSessionManager()->getSessionIdForPlayer(playerId);
-        if (!sid.empty()) {
-            wsServer_->getSessionManager()->setGameId(sid, "");
-            wsServer_->getSessionManager()->setPlayerId(sid, "");
+    bool left = false;
+    runOnGame(gameId, [&] {
+        game::GameEngine* engine = getGame(gameId);
+        if (!engine) return;
+        engine->removePlayer(playerId);
+        saveGame(*engine);
+        if (wsServer_ && wsServer_->getSessionManager()) {
+            std::string sid = wsServer_->getSessionManager()->getSessionIdForPlayer(playerId);
+            if (!sid.empty()) {
+                wsServer_->getSessionManager()->setGameId(sid, "");
+                wsServer_->getSessionManager()->setPlayerId(sid, "");
+            }
         }
-    }
-    broadcastGameState(gameId);
-    return true;
+        broadcastGameState(gameId);
+        left = true;
+    });
+    return left;
 }
 
 void Application::removeGame(const std::string& gameId)
 {
-    std::lock_guard<std::mutex> lock(gamesMutex_);
-    activeGames_.erase(gameId);
-    gameActivity_.erase(gameId);
-    if (gameRepo_) gameRepo_->deleteGame(gameId);
-    if (wsServer_ && wsServer_->getSessionManager())
-        wsServer_->getSessionManager()->removeAllSessionsForGame(gameId);
+    // Erase on the game's own strand so no queued task is mid-flight on the engine;
+    // tasks still queued behind this one find the game gone and return.
+    auto erase = [&] {
+        std::lock_guard<std::mutex> lock(gamesMutex_);
+        activeGames_.erase(gameId);
+        gameActivity_.erase(gameId);
+        gameSummaries_.erase(gameId);
+        gameStrands_.erase(gameId);
+        auto botIt = pendingBotTurns_.find(gameId);
+        if (botIt != pendingBotTurns_.end()) {
+            botTimers_->cancel(botIt->second);
+            pendingBotTurns_.erase(botIt);
+        }
+        if (writeQueue_) writeQueue_->deleteGame(gameId);
+        if (wsServer_ && wsServer_->getSessionManager())
+            wsServer_->getSessionManager()->removeAllSessionsForGame(gameId);
+    };
+    if (!runOnGame(gameId, erase))
+        erase();
 }
 
 void Application::handleClientMessage(const std::string& sessionId,
@@ -261,6 +351,9 @@ void Application::handleClientMessage(const std::string& sessionId,
         case MessageType::CHOOSE_SUIT:
             handleGameAction(sessionId, message);
             break;
+        case MessageType::STATE_RESYNC:
+            handleStateResync(sessionId);
+            break;
         default:
             break;
     }
@@ -279,17 +372,21 @@ network::HttpServer* Application::getHttpServer()
 void Application::setupWebSocketHandlers()
 {
     wsServer_ = std::make_unique<network::WebSocketServer>(config_.websocketPort);
+    wsServer_->setIoThreads(config_.wsIoThreads);
     wsServer_->setMessageHandler([this](const std::string& sessionId, const network::Message& msg) {
         handleClientMessage(sessionId, msg);
     });
     wsServer_->setDisconnectionHandler([this](const std::string& sessionId) {
+        stateStreams_.close(sessionId);
         auto* mgr = wsServer_->getSessionManager();
         if (!mgr) return;
         // Session data is still valid here: handleDisconnection is invoked
         // before destroySession() in the WsServerImpl close path.
-        const auto* sess = mgr->getSession(sessionId);
+        const auto sess = mgr->getSessionSnapshot(sessionId);
         if (!sess || sess->gameId.empty() || sess->playerId.empty()) return;
-        leaveGame(sess->gameId, sess->playerId);
+        const std::string gameId = sess->gameId;
+        const std::string playerId = sess->playerId;
+        postToGame(gameId, [this, gameId, playerId] { leaveGame(gameId, playerId); });
     });
 }
 
@@ -297,6 +394,12 @@ void Application::setupHttpRoutes()
 {
     httpServer_ = std::make_unique<network::HttpServer>(config_.httpPort);
     httpServer_->setStaticRoot(config_.staticFilesPath);
+    httpServer_->setWorkerThreads(config_.httpWorkerThreads);
+    httpServer_->setMaxConnections(config_.httpMaxConnections);
+    httpServer_->setIdleTimeout(std::chrono::seconds(config_.httpIdleTimeoutSeconds));
+    httpServer_->setMaxRequestsPerConnection(config_.httpMaxRequestsPerConnection);
+    httpServer_->addCorsHeaders();
+    if (config_.httpCompression) httpServer_->enableCompression();
     httpServer_->addRoute(network::HttpMethod::GET, "/api/games",
         [this](const network::HttpRequest& r) { return handleGetGames(r); });
     httpServer_->addRoute(network::HttpMethod::POST, "/api/games",
@@ -308,13 +411,13 @@ void Application::setupHttpRoutes()
     httpServer_->addPatternRoute(network::HttpMethod::GET, "/api/games/:id",
         [this](const network::HttpRequest& r) {
             auto it = r.pathParams.find("id");
-            return it != r.pathParams.end() ? handleGetGame(it->second)
+            return it != r.pathParams.end() ? handleGetGame(std::string(it->second))
                 : network::HttpResponse::notFound("");
         });
     httpServer_->addPatternRoute(network::HttpMethod::POST, "/api/games/:id/join",
         [this](const network::HttpRequest& r) {
             auto it = r.pathParams.find("id");
-            return it != r.pathParams.end() ? handleJoinGameHttp(it->second, r)
+            return it != r.pathParams.end() ? handleJoinGameHttp(std::string(it->second), r)
                 : network::HttpResponse::notFound("");
         });
     httpServer_->addRoute(network::HttpMethod::POST, "/api/games/join",
@@ -332,6 +435,8 @@ void Application::setupDatabase()
         database_->initializeSchema();
         gameRepo_ = std::make_unique<persistence::GameRepository>(database_.get());
         playerRepo_ = std::make_unique<persistence::PlayerRepository>(database_.get());
+        writeQueue_ = std::make_unique<persistence::WriteBehindQueue>(*database_, *gameRepo_,
+                                                                      config_.writeQueue);
     }
 }
 
@@ -344,8 +449,14 @@ void Application::loadExistingGames()
         auto state = gameRepo_->loadGame(rec.gameId);
         if (state.has_value()) {
             auto statePtr = std::make_unique<game::GameState>(std::move(state.value()));
-            activeGames_[rec.gameId] = std::make_unique<game::GameEngine>(std::move(statePtr));
+            gameSummaries_[rec.gameId] = summarize(*statePtr);
+            auto engine = std::make_unique<game::GameEngine>(std::move(statePtr));
+            // Keeps appending to the stored journal instead of starting none.
+            if (auto journal = gameRepo_->loadJournal(rec.gameId))
+                engine->restoreJournal(std::move(*journal));
+            activeGames_[rec.gameId] = std::move(engine);
             gameActivity_[rec.gameId] = std::chrono::steady_clock::now();
+            gameStrands_[rec.gameId] = std::make_shared<utils::Strand>(*workerPool_);
         }
     }
 }
@@ -353,7 +464,17 @@ void Application::loadExistingGames()
 void Application::handleJoinGame(const std::string& sessionId,
                                   const network::Message& message)
 {
-    auto payload = network::JoinGamePayload::fromJson(message.payload);
+    auto decoded = network::decodePayload<network::JoinGamePayload>(message);
+    if (!decoded) {
+        network::Message errMsg;
+        errMsg.type = network::MessageType::ERROR;
+        errMsg.gameId = message.gameId;
+        errMsg.playerId = message.playerId;
+        errMsg.payload = network::ErrorPayload{"JOIN_GAME", "Malformed join request", std::nullopt}.toJson();
+        if (wsServer_) wsServer_->sendMessage(sessionId, errMsg);
+        return;
+    }
+    const network::JoinGamePayload& payload = *decoded;
     std::string gameId = payload.gameId.empty() ? message.gameId : payload.gameId;
     if (gameId.empty() && payload.gameCode.has_value() && !payload.gameCode->empty())
         gameId = getGameIdByCode(payload.gameCode.value());
@@ -363,45 +484,52 @@ void Application::handleJoinGame(const std::string& sessionId,
     std::string playerName = sanitizePlayerName(payload.playerName);
     if (playerName.empty()) playerName = "Player";
     if (gameId.empty()) return;
-    game::GameEngine* engine = getGame(gameId);
-    if (!engine || !engine->getState()) return;
-    game::GameState* state = engine->getState();
+    const bool statePatches = payload.statePatches;
+    postToGame(gameId, [this, sessionId, gameId, playerId, playerName, statePatches] {
+        game::GameEngine* engine = getGame(gameId);
+        if (!engine || !engine->getState()) return;
+        game::GameState* state = engine->getState();
 
-    // If the player already exists in the game, treat this as a reconnect/reattach.
-    // This works even when the game is already in progress.
-    core::Player* existing = state->getPlayer(playerId);
-    if (existing) {
-        if (wsServer_ && wsServer_->getSessionManager()) {
-            auto* mgr = wsServer_->getSessionManager();
-            auto oldSessions = mgr->getSessionsForPlayer(playerId);
-            for (const auto& sid : oldSessions)
-                if (sid != sessionId) mgr->destroySession(sid);
-            mgr->setGameId(sessionId, gameId);
-            mgr->setPlayerId(sessionId, playerId);
-        }
-        // Send the current game state to this session only.
-        touchGameActivity(gameId);
-        if (wsServer_ && wsServer_->getSessionManager()) {
-            const std::string stateJson = state->toJsonForPlayer(playerId);
-            network::Message msg;
-            msg.type = network::MessageType::GAME_STATE_UPDATE;
-            msg.gameId = gameId;
-            msg.payload = "{\"gameStateJson\":" + stateJson + "}";
-            msg.timestamp = static_cast<uint64_t>(
-                std::chrono::system_clock::now().time_since_epoch().count());
-            wsServer_->sendMessage(sessionId, msg);
+        // If the player already exists in the game, treat this as a reconnect/reattach.
+        // This works even when the game is already in progress.
+        core::Player* existing = state->getPlayer(playerId);
+        if (existing) {
+            if (wsServer_ && wsServer_->getSessionManager()) {
+                auto* mgr = wsServer_->getSessionManager();
+                auto oldSessions = mgr->getSessionsForPlayer(playerId);
+                for (const auto& sid : oldSessions) {
+                    if (sid == sessionId) continue;
+                    mgr->destroySession(sid);
+                    stateStreams_.close(sid);
+                }
+                mgr->setGameId(sessionId, gameId);
+                mgr->setPlayerId(sessionId, playerId);
+            }
+            if (statePatches) stateStreams_.open(sessionId);
+            else stateStreams_.close(sessionId);
+            // Send the current game state to this session only.
+            touchGameActivity(gameId);
+            if (wsServer_ && wsServer_->getSessionManager()) {
+                const auto ts = static_cast<uint64_t>(
+                    std::chrono::system_clock::now().time_since_epoch().count());
+                StateViews views;
+                if (auto update = makeStateUpdate(*state, views, sessionId, playerId, ts))
+                    wsServer_->sendMessage(sessionId, *update);
+            }
+            return;
         }
-        return;
-    }
 
-    // Fresh join into a lobby game.
-    if (joinGame(gameId, playerId, playerName)) {
-        if (wsServer_ && wsServer_->getSessionManager()) {
-            wsServer_->getSessionManager()->setGameId(sessionId, gameId);
-            wsServer_->getSessionManager()->setPlayerId(sessionId, playerId);
+        // Fresh join into a lobby game.
+        if (joinGame(gameId, playerId, playerName)) {
+            if (wsServer_ && wsServer_->getSessionManager()) {
+                wsServer_->getSessionManager()->setGameId(sessionId, gameId);
+                wsServer_->getSessionManager()->setPlayerId(sessionId, playerId);
+            }
+            if (statePatches) stateStreams_.open(sessionId);
+            else stateStreams_.close(sessionId);
+            broadcastGameState(gameId);
         }
-        broadcastGameState(gameId);
-    }
+    });
 }
 
 void Application::handleLeaveGame(const std::string& sessionId,
@@ -410,14 +538,14 @@ void Application::handleLeaveGame(const std::string& sessionId,
     std::string gameId = message.gameId;
     std::string playerId = message.playerId;
     if (wsServer_ && wsServer_->getSessionManager()) {
-        const auto* sess = wsServer_->getSessionManager()->getSession(sessionId);
+        const auto sess = wsServer_->getSessionManager()->getSessionSnapshot(sessionId);
         if (sess) {
             if (gameId.empty()) gameId = sess->gameId;
             if (playerId.empty()) playerId = sess->playerId;
         }
     }
     if (!gameId.empty() && !playerId.empty())
-        leaveGame(gameId, playerId);
+        postToGame(gameId, [this, gameId, playerId] { leaveGame(gameId, playerId); });
 }
 
 void Application::handleStartGame(const std::string& sessionId,
@@ -426,64 +554,48 @@ void Application::handleStartGame(const std::string& sessionId,
     std::string gameId = message.gameId;
     std::string playerId = message.playerId;
     if (wsServer_ && wsServer_->getSessionManager()) {
-        const auto* sess = wsServer_->getSessionManager()->getSession(sessionId);
+        const auto sess = wsServer_->getSessionManager()->getSessionSnapshot(sessionId);
         if (sess) {
             if (gameId.empty()) gameId = sess->gameId;
             if (playerId.empty()) playerId = sess->playerId;
         }
     }
-    game::GameEngine* engine = getGame(gameId);
-    if (!engine || !engine->getState() || playerId.empty()) {
-        if (wsServer_) {
-            network::Message errMsg;
-            errMsg.type = network::MessageType::ERROR;
-            errMsg.gameId = gameId;
-            errMsg.playerId = playerId;
-            errMsg.payload = network::ErrorPayload{"START_GAME", "Game not found or not in session", std::nullopt}.toJson();
-            wsServer_->sendMessage(sessionId, errMsg);
+    auto sendError = [this, sessionId, gameId, playerId](const std::string& reason) {
+        if (!wsServer_) return;
+        network::Message errMsg;
+        errMsg.type = network::MessageType::ERROR;
+        errMsg.gameId = gameId;
+        errMsg.playerId = playerId;
+        errMsg.payload = network::ErrorPayload{"START_GAME", reason, std::nullopt}.toJson();
+        wsServer_->sendMessage(sessionId, errMsg);
+    };
+    const bool queued = postToGame(gameId, [this, gameId, playerId, sendError] {
+        game::GameEngine* engine = getGame(gameId);
+        if (!engine || !engine->getState() || playerId.empty()) {
+            sendError("Game not found or not in session");
+            return;
         }
-        return;
-    }
-    game::GameState* state = engine->getState();
-    if (state->getPhase() != game::GamePhase::LOBBY) {
-        if (wsServer_) {
-            network::Message errMsg;
-            errMsg.type = network::MessageType::ERROR;
-            errMsg.gameId = gameId;
-            errMsg.playerId = playerId;
-            errMsg.payload = network::ErrorPayload{"START_GAME", "Game already started", std::nullopt}.toJson();
-            wsServer_->sendMessage(sessionId, errMsg);
+        game::GameState* state = engine->getState();
+        if (state->getPhase() != game::GamePhase::LOBBY) {
+            sendError("Game already started");
+            return;
         }
-        return;
-    }
-    if (state->getCreatorPlayerId() != playerId) {
-        if (wsServer_) {
-            network::Message errMsg;
-            errMsg.type = network::MessageType::ERROR;
-            errMsg.gameId = gameId;
-            errMsg.playerId = playerId;
-            errMsg.payload = network::ErrorPayload{"START_GAME", "Only the creator can start the game", std::nullopt}.toJson();
-            wsServer_->sendMessage(sessionId, errMsg);
+        if (state->getCreatorPlayerId() != playerId) {
+            sendError("Only the creator can start the game");
+            return;
         }
-        return;
-    }
-    if (state->getPlayerCount() < static_cast<size_t>(state->getConfig().minPlayers)) {
-        if (wsServer_) {
-            network::Message errMsg;
-            errMsg.type = network::MessageType::ERROR;
-            errMsg.gameId = gameId;
-            errMsg.playerId = playerId;
-            errMsg.payload = network::ErrorPayload{"START_GAME", "Not enough players to start", std::nullopt}.toJson();
-            wsServer_->sendMessage(sessionId, errMsg);
+        if (state->getPlayerCount() < static_cast<size_t>(state->getConfig().minPlayers)) {
+            sendError("Not enough players to start");
+            return;
         }
-        return;
-    }
-    engine->startGame();
-    engine->startNewRound();
-    if (gameRepo_)
-        gameRepo_->saveGame(*state);
-    broadcastGameState(gameId);
-    runBotTurnsIfNeeded(gameId);
+        engine->startGame();
+        engine->startNewRound();
+        saveGame(*engine);
+        broadcastGameState(gameId);
+        runBotTurnsIfNeeded(gameId);
+    });
+    if (!queued)
+        sendError("Game not found or not in session");
 }
 
 void Application::handleGameAction(const std::string& sessionId,
@@ -492,24 +604,36 @@ void Application::handleGameAction(const std::string& sessionId,
     std::string gameId = message.gameId;
     std::string playerId = message.playerId;
     if (wsServer_ && wsServer_->getSessionManager()) {
-        const auto* sess = wsServer_->getSessionManager()->getSession(sessionId);
+        const auto sess = wsServer_->getSessionManager()->getSessionSnapshot(sessionId);
         if (sess) {
             if (gameId.empty()) gameId = sess->gameId;
             if (playerId.empty()) playerId = sess->playerId;
         }
     }
-    game::GameEngine* engine = getGame(gameId);
-    if (!engine || playerId.empty()) return;
+    if (gameId.empty() || playerId.empty()) return;
     game::GameAction action;
     action.playerId = playerId;
     action.type = game::ActionType::FORFEIT_TURN;
+    auto decodeMove = [&]() -> std::optional<network::PlayCardPayload> {
+        auto pl = network::decodePayload<network::PlayCardPayload>(message);
+        if (!pl && wsServer_) {
+            network::Message errMsg;
+            errMsg.type = network::MessageType::ERROR;
+            errMsg.gameId = gameId;
+            errMsg.playerId = playerId;
+            errMsg.payload = network::ErrorPayload{"invalid_action", "Malformed move", std::nullopt}.toJson();
+            wsServer_->sendMessage(sessionId, errMsg);
+        }
+        return pl;
+    };
     using network::MessageType;
     switch (message.type) {
         case MessageType::PLAY_CARD: {
-            auto pl = network::PlayCardPayload::fromJson(message.payload);
+            auto pl = decodeMove();
+            if (!pl) return;
             action.type = game::ActionType::PLAY_CARD;
-            action.cardIndex = pl.cardIndex;
-            action.chosenSuit = pl.chosenSuit;
+            action.cardIndex = pl->cardIndex;
+            action.chosenSuit = pl->chosenSuit;
             break;
         }
         case MessageType::DRAW_CARD:
@@ -521,44 +645,54 @@ void Application::handleGameAction(const std::string& sessionId,
         case MessageType::DECLARE_CHECK_UP:
             action.type = game::ActionType::DECLARE_CHECK_UP;
             break;
-        case MessageType::CHOOSE_SUIT:
+        case MessageType::CHOOSE_SUIT: {
+            auto pl = decodeMove();
+            if (!pl) return;
             action.type = game::ActionType::CHOOSE_SUIT;
-            action.chosenSuit = network::PlayCardPayload::fromJson(message.payload).chosenSuit;
+            action.chosenSuit = pl->chosenSuit;
             break;
+        }
         default:
             return;
     }
-    game::ActionResult result = engine->processAction(action);
-    if (!result.success) {
-        nlohmann::json errPayload;
-        errPayload["message"] = result.message;
-        errPayload["errorCode"] = "invalid_action";
-        network::Message errMsg;
-        errMsg.type = network::MessageType::ERROR;
-        errMsg.gameId = gameId;
-        errMsg.playerId = playerId;
-        errMsg.payload = errPayload.dump();
-        errMsg.timestamp = static_cast<uint64_t>(
-            std::chrono::system_clock::now().time_since_epoch().count());
-        wsServer_->sendMessage(sessionId, errMsg);
-        return;
-    }
-    broadcastGameState(gameId);
-    game::GameState* st = engine->getState();
-    if (gameRepo_) gameRepo_->saveGame(*st);
-    if (st && st->getPhase() == game::GamePhase::GAME_ENDED && playerRepo_) {
-        auto winnerId = st->getWinnerId();
-        for (core::Player* p : st->getAllPlayers()) {
-            if (p)
-                playerRepo_->updateStats(p->getId(), winnerId && *winnerId == p->getId(), p->getCumulativeScore());
+    postToGame(gameId, [this, sessionId, gameId, playerId, action] {
+        game::GameEngine* engine = getGame(gameId);
+        if (!engine) return;
+        game::ActionResult result = engine->processAction(action);
+        if (!result.success) {
+            nlohmann::json errPayload;
+            errPayload["message"] = result.message;
+            errPayload["errorCode"] = "invalid_action";
+            network::Message errMsg;
+            errMsg.type = network::MessageType::ERROR;
+            errMsg.gameId = gameId;
+            errMsg.playerId = playerId;
+            errMsg.payload = errPayload.dump();
+            errMsg.timestamp = static_cast<uint64_t>(
+                std::chrono::system_clock::now().time_since_epoch().count());
+            wsServer_->sendMessage(sessionId, errMsg);
+            return;
         }
-    }
-    if (st && st->getPhase() == game::GamePhase::ROUND_ENDED && !st->checkGameEnd()) {
-        engine->startNewRound();
         broadcastGameState(gameId);
-        if (gameRepo_) gameRepo_->saveGame(*engine->getState());
-    }
-    runBotTurnsIfNeeded(gameId);
+        game::GameState* st = engine->getState();
+        saveGame(*engine);
+        if (st && st->getPhase() == game::GamePhase::GAME_ENDED && writeQueue_ && playerRepo_) {
+            auto winnerId = st->getWinnerId();
+            for (core::Player* p : st->getAllPlayers()) {
+                if (!p) continue;
+                writeQueue_->post([this, id = p->getId(), won = winnerId && *winnerId == p->getId(),
+                                   score = p->getCumulativeScore()] {
+                    playerRepo_->updateStats(id, won, score);
+                });
+            }
+        }
+        if (st && st->getPhase() == game::GamePhase::ROUND_ENDED && !st->checkGameEnd()) {
+            engine->startNewRound();
+            broadcastGameState(gameId);
+            saveGame(*engine);
+        }
+        runBotTurnsIfNeeded(gameId);
+    });
 }
 
 game::GameEngine* Application::getGame(const std::string& gameId)
@@ -577,9 +711,71 @@ const game::GameEngine* Application::getGame(const std::string& gameId) const
 
 std::string Application::getGameCode(const std::string& gameId) const
 {
-    const game::GameEngine* eng = getGame(gameId);
-    if (!eng || !eng->getState()) return {};
-    return eng->getState()->getGameCode();
+    std::lock_guard<std::mutex> lock(gamesMutex_);
+    auto it = gameSummaries_.find(gameId);
+    return it != gameSummaries_.end() ? it->second.gameCode : std::string();
+}
+
+std::shared_ptr<utils::Strand> Application::getGameStrand(const std::string& gameId) const
+{
+    std::lock_guard<std::mutex> lock(gamesMutex_);
+    auto it = gameStrands_.find(gameId);
+    return it != gameStrands_.end() ? it->second : nullptr;
+}
+
+bool Application::postToGame(const std::string& gameId, utils::Task task)
+{
+    auto strand = getGameStrand(gameId);
+    if (!strand) return false;
+    strand->post([this, gameId, task = std::move(task)] {
+        task();
+        publishGameSummary(gameId);
+    });
+    return true;
+}
+
+bool Application::runOnGame(const std::string& gameId, const utils::Task& task)
+{
+    auto strand = getGameStrand(gameId);
+    if (!strand) return false;
+    if (strand->runningInThisThread()) {
+        task();
+        publishGameSummary(gameId);
+        return true;
+    }
+    std::promise<void> done;
+    std::future<void> finished = done.get_future();
+    strand->post([this, &gameId, &task, &done] {
+        try {
+            task();
+            publishGameSummary(gameId);
+            done.set_value();
+        } catch (...) {
+            done.set_exception(std::current_exception());
+        }
+    });
+    finished.get();
+    return true;
+}
+
+Application::GameSummary Application::summarize(const game::GameState& state)
+{
+    GameSummary summary;
+    summary.phase = state.getPhase();
+    summary.playerCount = state.getPlayerCount();
+    summary.maxPlayers = state.getConfig().maxPlayers;
+    summary.gameCode = state.getGameCode();
+    return summary;
+}
+
+void Application::publishGameSummary(const std::string& gameId)
+{
+    game::GameEngine* engine = getGame(gameId);
+    if (!engine || !engine->getState()) return;
+    GameSummary summary = summarize(*engine->getState());
+    std::lock_guard<std::mutex> lock(gamesMutex_);
+    if (activeGames_.find(gameId) == activeGames_.end()) return;  // removed meanwhile
+    gameSummaries_[gameId] = std::move(summary);
 }
 
 void Application::broadcastGameState(const std::string& gameId)
@@ -595,7 +791,7 @@ void Application::broadcastGameState(const std::string& gameId)
     std::vector<std::string> sessionPlayerIds;
     sessionPlayerIds.reserve(sessionIds.size());
     for (const std::string& sessionId : sessionIds) {
-        const auto* sess = sessionMgr->getSession(sessionId);
+        const auto sess = sessionMgr->getSessionSnapshot(sessionId);
         sessionPlayerIds.push_back(sess ? sess->playerId : std::string{});
     }
 
@@ -606,35 +802,82 @@ void Application::broadcastGameState(const std::string& gameId)
     std::vector<PendingSend> pending;
     pending.reserve(sessionIds.size());
 
-    // Phase 1: Serialize under gamesMutex_ and build pending websocket messages.
-    // This prevents deadlocks from holding gamesMutex_ while calling wsServer_->sendMessage().
+    // Phase 1: Serialize and build pending websocket messages. Callers run on the
+    // game's strand, so the state cannot change underneath us and gamesMutex_
+    // is only needed for the lookup, not while other games serialize. The
+    // shared part of the view is rendered once; sessions only splice in a hand.
     {
-        std::lock_guard<std::mutex> lock(gamesMutex_);
-        auto it = activeGames_.find(gameId);
-        if (it == activeGames_.end()) return;
-        if (!it->second || !it->second->getState()) return;
+        const game::GameEngine* engine = getGame(gameId);
+        if (!engine || !engine->getState()) return;
 
-        const game::GameState* state = it->second->getState();
+        const game::GameState* state = engine->getState();
         const uint64_t ts = static_cast<uint64_t>(
             std::chrono::system_clock::now().time_since_epoch().count());
 
+        StateViews views;
         for (size_t i = 0; i < sessionIds.size(); ++i) {
-            std::string stateJson = state->toJsonForPlayer(sessionPlayerIds[i]);
-            network::Message msg;
-            msg.type = network::MessageType::GAME_STATE_UPDATE;
-            msg.gameId = gameId;
-            msg.payload = "{\"gameStateJson\":" + stateJson + "}";
-            msg.timestamp = ts;
-            pending.push_back(PendingSend{sessionIds[i], std::move(msg)});
+            if (auto update = makeStateUpdate(*state, views, sessionIds[i], sessionPlayerIds[i], ts))
+                pending.push_back(PendingSend{sessionIds[i], std::move(*update)});
         }
     }
 
-    // Phase 2: Send after unlock.
+    // Phase 2: Send.
     for (const auto& item : pending) {
         server->sendMessage(item.sessionId, item.msg);
     }
 }
 
+std::optional<network::Message> Application::makeStateUpdate(const game::GameState& state,
+                                                             StateViews& views,
+                                                             const std::string& sessionId,
+                                                             const std::string& playerId,
+                                                             uint64_t timestamp)
+{
+    network::Message msg;
+    msg.type = network::MessageType::GAME_STATE_UPDATE;
+    msg.gameId = state.getGameId();
+    msg.timestamp = timestamp;
+    if (wsServer_ && wsServer_->usesBinaryProtocol(sessionId)) {
+        if (!views.binary) views.binary = &state.renderView(game::StateView::Format::BINARY);
+        msg.payloadFormat = network::PayloadFormat::BINARY;
+        msg.payload = views.binary->forPlayer(playerId);
+        return msg;
+    }
+    if (!views.json) views.json = &state.renderView(game::StateView::Format::JSON);
+    if (stateStreams_.isOpen(sessionId)) {
+        if (!views.frame) views.frame.emplace(views.json->shared());
+        const auto seat = views.json->seatOf(playerId);
+        auto update = seat
+            ? stateStreams_.next(sessionId, *views.frame, views.json->forPlayer(playerId), seat->index, seat->hand)
+            : stateStreams_.next(sessionId, *views.frame, views.json->forPlayer(playerId));
+        if (!update) return std::nullopt;
+        msg.type = update->type;
+        msg.payload = std::move(update->payload);
+    } else {
+        msg.payload = "{\"gameState\":" + views.json->forPlayer(playerId) + "}";
+    }
+    return msg;
+}
+
+void Application::handleStateResync(const std::string& sessionId)
+{
+    if (!wsServer_ || !wsServer_->getSessionManager()) return;
+    const auto sess = wsServer_->getSessionManager()->getSessionSnapshot(sessionId);
+    if (!sess || sess->gameId.empty() || sess->playerId.empty()) return;
+    const std::string gameId = sess->gameId;
+    const std::string playerId = sess->playerId;
+    postToGame(gameId, [this, sessionId, gameId, playerId] {
+        const game::GameEngine* engine = getGame(gameId);
+        if (!engine || !engine->getState()) return;
+        stateStreams_.resync(sessionId);
+        const auto ts = static_cast<uint64_t>(
+            std::chrono::system_clock::now().time_since_epoch().count());
+        StateViews views;
+        if (auto update = makeStateUpdate(*engine->getState(), views, sessionId, playerId, ts))
+            wsServer_->sendMessage(sessionId, *update);
+    });
+}
+
 void Application::cleanupInactiveGames()
 {
     std::vector<std::string> staleGameIds;
@@ -642,9 +885,8 @@ void Application::cleanupInactiveGames()
     const auto staleFor = std::chrono::seconds(kDefaultLobbyStaleSeconds);
     {
         std::lock_guard<std::mutex> lock(gamesMutex_);
-        for (const auto& [gid, engine] : activeGames_) {
-            if (!engine || !engine->getState()) continue;
-            if (engine->getState()->getPhase() != game::GamePhase::LOBBY) continue;
+        for (const auto& [gid, summary] : gameSummaries_) {
+            if (summary.phase != game::GamePhase::LOBBY) continue;
             auto it = gameActivity_.find(gid);
             if (it == gameActivity_.end()) continue;
             if (now - it->second >= staleFor)
@@ -660,16 +902,14 @@ network::HttpResponse Application::handleGetGames(const network::HttpRequest&)
     std::vector<nlohmann::json> arr;
     {
         std::lock_guard<std::mutex> lock(gamesMutex_);
-        for (const auto& [gid, engine] : activeGames_) {
-            if (!engine || !engine->getState()) continue;
-            const game::GameState* s = engine->getState();
+        for (const auto& [gid, s] : gameSummaries_) {
             nlohmann::json o;
             o["gameId"] = gid;
-            o["phase"] = static_cast<int>(s->getPhase());
-            o["playerCount"] = static_cast<int>(s->getPlayerCount());
-            o["maxPlayers"] = s->getConfig().maxPlayers;
-            o["joinable"] = (s->getPhase() == game::GamePhase::LOBBY &&
-                s->getPlayerCount() < static_cast<size_t>(s->getConfig().maxPlayers));
+            o["phase"] = static_cast<int>(s.phase);
+            o["playerCount"] = static_cast<int>(s.playerCount);
+            o["maxPlayers"] = s.maxPlayers;
+            o["joinable"] = (s.phase == game::GamePhase::LOBBY &&
+                s.playerCount < static_cast<size_t>(s.maxPlayers));
             arr.push_back(std::move(o));
         }
     }
@@ -707,21 +947,26 @@ network::HttpResponse Application::handleCreateGame(const network::HttpRequest&
         return network::HttpResponse::json(500, "{\"error\":\"Could not join game\"}");
     if (botCount > 0)
         addBotsToGame(gameId, botCount);
-    game::GameEngine* eng = getGame(gameId);
     nlohmann::json out;
     out["gameId"] = gameId;
     out["playerId"] = playerId;
-    if (eng && eng->getState())
-        out["gameCode"] = eng->getState()->getGameCode();
+    const std::string gameCode = getGameCode(gameId);
+    if (!gameCode.empty())
+        out["gameCode"] = gameCode;
     return network::HttpResponse::json(201, out.dump());
 }
 
 network::HttpResponse Application::handleGetGame(const std::string& gameId)
 {
-    game::GameEngine* engine = getGame(gameId);
-    if (!engine || !engine->getState())
+    std::string stateJson;
+    runOnGame(gameId, [&] {
+        game::GameEngine* engine = getGame(gameId);
+        if (engine && engine->getState())
+            stateJson = engine->getState()->toJson();
+    });
+    if (stateJson.empty())
         return network::HttpResponse::notFound("{\"error\":\"Game not found\"}");
-    return network::HttpResponse::json(200, engine->getState()->toJson());
+    return network::HttpResponse::json(200, stateJson);
 }
 
 network::HttpResponse Application::handleJoinGameHttp(const std::string& gameId,
@@ -772,6 +1017,12 @@ network::HttpResponse Application::handleJoinByCode(const network::HttpRequest&
     return network::HttpResponse::json(200, out.dump());
 }
 
+void Application::saveGame(game::GameEngine& engine)
+{
+    if (writeQueue_ && engine.getState())
+        writeQueue_->saveGame(*engine.getState(), engine.takeUnsavedJournal());
+}
+
 void Application::touchGameActivity(const std::string& gameId)
 {
     if (gameId.empty()) return;
@@ -786,7 +1037,7 @@ network::HttpResponse Application::handleCleanupStaleLobbies(const network::Http
     auto qIt = request.queryParams.find("maxIdleSeconds");
     if (qIt != request.queryParams.end()) {
         try {
-            maxIdleSeconds = std::stoi(qIt->second);
+            maxIdleSeconds = std::stoi(std::string(qIt->second));
         } catch (...) {}
     }
     if (maxIdleSeconds < 60) maxIdleSeconds = 60;
@@ -796,9 +1047,8 @@ network::HttpResponse Application::handleCleanupStaleLobbies(const network::Http
     const auto staleFor = std::chrono::seconds(maxIdleSeconds);
     {
         std::lock_guard<std::mutex> lock(gamesMutex_);
-        for (const auto& [gid, engine] : activeGames_) {
-            if (!engine || !engine->getState()) continue;
-            if (engine->getState()->getPhase() != game::GamePhase::LOBBY) continue;
+        for (const auto& [gid, summary] : gameSummaries_) {
+            if (summary.phase != game::GamePhase::LOBBY) continue;
             auto it = gameActivity_.find(gid);
             if (it == gameActivity_.end()) continue;
             if (now - it->second >= staleFor)
@@ -821,7 +1071,7 @@ network::HttpResponse Application::handleLeaderboard(const network::HttpRequest&
     auto qIt = request.queryParams.find("limit");
     if (qIt != request.queryParams.end()) {
         try {
-            limit = std::stoi(qIt->second);
+            limit = std::stoi(std::string(qIt->second));
         } catch (...) {}
     }
     if (limit < 1) limit = 1;
@@ -1,30 +1,28 @@
 #include "../../include/Core/Card.hpp"
-#include <memory>
+#include "Utils/JSONSerializer.hpp"
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
 namespace whot::core {
-    Card::Card(Suit suit, CardValue value) : suit_(suit)
-                                           , value_(value)
-                                           , specialAbility_(determineSpecialAbility()) {}
+    Card::Card(Suit suit, CardValue value)
+        : packed_(static_cast<uint8_t>((static_cast<uint8_t>(suit) << 5) | static_cast<uint8_t>(value)))
+        , identity_(static_cast<uint8_t>(cardIdentity(suit, value))) {}
 
-    Suit Card::getSuit() const { return suit_; }
+    Suit Card::getSuit() const { return static_cast<Suit>(packed_ >> 5); }
     
-    CardValue Card::getValue() const { return value_; }
+    CardValue Card::getValue() const { return static_cast<CardValue>(packed_ & 0x1F); }
     
-    int Card::getNumericValue() const { return static_cast<int>(value_); }
+    int Card::getNumericValue() const { return packed_ & 0x1F; }
     
-    int Card::getScoreValue() const 
-    {
-        if (isStarCard()) { return getInnerStarValue(); }
-        return getNumericValue();
-    }
+    int Card::getScoreValue() const { return CARD_SCORE[identity_]; }
     
-    SpecialAbility Card::getSpecialAbility() const { return specialAbility_; }
+    SpecialAbility Card::getSpecialAbility() const { return abilityForValue(getValue()); }
     
-    bool Card::isWhotCard() const { return specialAbility_ == SpecialAbility::WHOT_CARD; }
+    bool Card::isWhotCard() const { return getValue() == CardValue::TWENTY; }
     
-    bool Card::isStarCard() const { return suit_ == Suit::STAR; }
+    bool Card::isStarCard() const { return getSuit() == Suit::STAR; }
+
+    size_t Card::getIdentity() const { return identity_; }
 
     int Card::getOuterStarValue() const { return getNumericValue(); }
     
@@ -32,68 +30,63 @@ namespace whot::core {
 
     bool Card::canPlayOn(const Card& callCard) const
     {
-        // Whot cards can play on anything (guide: "Whot cards can play on anything")
-        if (isWhotCard()) return true;
-        // Otherwise match suit OR number (guide: "Match suit OR match number")
-        return matchesSuit(callCard.suit_) || matchesValue(callCard.value_);
+        // Whot cards play on anything, otherwise match suit OR number
+        return PLAYABLE_ON[identity_][callCard.identity_];
     }
     
-    bool Card::matchesSuit(Suit suit) const { return suit_ == suit;}
+    bool Card::matchesSuit(Suit suit) const { return getSuit() == suit;}
     
-    bool Card::matchesValue(CardValue value) const { return value_ == value; }
+    bool Card::matchesValue(CardValue value) const { return getValue() == value; }
 
     std::string Card::toString() const 
     {
-        std::string card = suitToString(suit_) + " " + cardValueToString(value_);
+        std::string card = suitToString(getSuit()) + " " + cardValueToString(getValue());
         return card;
     }
 
     std::string Card::toJson() const 
     {
-        json j;
-        j["suit"] = suitToString(suit_);
-        j["value"] = cardValueToString(value_);
+        std::string out;
+        utils::JsonWriter w(out);
+        writeJson(w);
+        return out;
+    }
 
-        std::string jsonString = j.dump();
-        return jsonString;
+    void Card::writeJson(utils::JsonWriter& w) const
+    {
+        w.beginObject();
+        w.key("suit").value(suitToString(getSuit()));
+        w.key("value").value(cardValueToString(getValue()));
+        w.endObject();
     }
     
-    std::unique_ptr<Card> Card::fromJson(const std::string& jsonStr) 
+    Card Card::fromJson(const std::string& jsonStr) 
     {
         json j = json::parse(jsonStr);
         
         Suit suit = stringToSuit(j.at("suit").get<std::string>());
         CardValue value = stringToCardValue(j.at("value").get<std::string>());
-        auto card = std::make_unique<Card>(suit, value);
-        
-        return card;
+        return Card(suit, value);
     }
     
-    bool Card::operator==(const Card& other) const 
+    std::optional<Card> Card::fromByte(uint8_t byte)
     {
-        return getSuit() == other.getSuit() && getValue() == other.getValue();
+        const uint8_t suit = byte >> 5;
+        const uint8_t value = byte & 0x1F;
+        if (suit >= SUIT_COUNT || value == 0 || value > 20 ||
+            SLOT_VALUE[VALUE_SLOT[value]] != static_cast<CardValue>(value))
+            return std::nullopt;
+        return Card(static_cast<Suit>(suit), static_cast<CardValue>(value));
     }
 
-    bool Card::operator!=(const Card& other) const 
+    bool Card::operator==(const Card& other) const 
     {
-        return !(*this == other);
+        return packed_ == other.packed_;
     }
 
-    SpecialAbility Card::determineSpecialAbility() const
+    bool Card::operator!=(const Card& other) const 
     {
-        CardValue cv = getValue();
-        switch (cv) {
-        case CardValue::ONE:
-            return SpecialAbility::HOLD_ON;
-        case CardValue::TWO:
-            return SpecialAbility::PICK_TWO;
-        case CardValue::FOURTEEN:
-            return SpecialAbility::GENERAL_MARKET;
-        case CardValue::TWENTY:
-            return SpecialAbility::WHOT_CARD;
-        default:
-            return SpecialAbility::NONE;
-        }
+        return !(*this == other);
     }
 
 } // namespace whot::core
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "../../include/Core/CardMask.hpp"
+
+namespace whot::core {
+
+namespace {
+struct MaskTables {
+    std::array<CardMask, SUIT_COUNT> bySuit;
+    std::array<CardMask, VALUE_SLOT.size()> byValue;
+
+    MaskTables() {
+        for (size_t id = 0; id < CARD_IDENTITY_COUNT; ++id) {
+            bySuit[static_cast<size_t>(identitySuit(id))].set(id);
+            byValue[static_cast<size_t>(identityValue(id))].set(id);
+        }
+    }
+};
+
+const MaskTables& tables() {
+    static const MaskTables t;
+    return t;
+}
+}  // namespace
+
+const CardMask& suitMask(Suit suit) {
+    return tables().bySuit[static_cast<size_t>(suit)];
+}
+
+const CardMask& valueMask(CardValue value) {
+    return tables().byValue[static_cast<size_t>(value)];
+}
+
+const CardMask& whotMask() {
+    return valueMask(CardValue::TWENTY);
+}
+
+CardMask playableOnMask(const Card& callCard, std::optional<Suit> demandedSuit) {
+    if (demandedSuit.has_value())
+        return suitMask(*demandedSuit) | whotMask();
+    return suitMask(callCard.getSuit()) | valueMask(callCard.getValue()) | whotMask();
+}
+
+} // namespace whot::core
@@ -1,118 +1,76 @@
 #include "../../include/Core/Deck.hpp"
-#include <algorithm>
-#include <random>
+#include "Utils/ByteStream.hpp"
+#include "Utils/JSONSerializer.hpp"
+#include <utility>
 #include <nlohmann/json.hpp>
 
 namespace whot::core {
 
-    Deck::Deck()
-    {
-        cards_.reserve(STANDARD_DECK_SIZE);
-        std::random_device rd;
-        rng_.seed(rd());
-        createDeck();
-        shuffle();
-    }
+    Deck::Deck() : Deck(1, utils::FastRng::freshSeed()) {}
+
+    Deck::Deck(int numberOfDecks) : Deck(numberOfDecks, utils::FastRng::freshSeed()) {}
 
-    Deck::Deck(int numberOfDecks)
+    Deck::Deck(int numberOfDecks, uint64_t seed) : rng_(seed)
     {
-        cards_.reserve(numberOfDecks * STANDARD_DECK_SIZE);
-        std::random_device rd;
-        rng_.seed(rd());
+        if (numberOfDecks <= 0) return;
+        cards_.reserve(static_cast<size_t>(numberOfDecks) * STANDARD_DECK_SIZE);
         for (int i = 0; i < numberOfDecks; ++i) createDeck();
         shuffle();
     }
+
     void Deck::createDeck()
     {
-        createCircleCards();
-        createTriangleCards();
-        createCrossCards();
-        createBlockCards();
-        createStarCards();
-        createWhotCards();
-    }
-    void Deck::createCircleCards()
-    {
-        // valid card values = 1, 2, 3, 4, 5, 7, 8, 10, 11, 12, 13, 14
-        for (int i{1}; i <= 14; i++)
-        {
-            if (i == 6 || i == 9) { continue; }
-            cards_.push_back(std::make_unique<Card>(Suit::CIRCLE, static_cast<CardValue>(i)));
-        }
-    }
-    void Deck::createTriangleCards() 
-    {
-        // valid card values = 1, 2, 3, 4, 5, 7, 8, 10, 11, 12, 13, 14
-        for (int i{1}; i <= 14; i++)
-        {
-            if (i == 6 || i == 9) { continue; }
-            cards_.push_back(std::make_unique<Card>(Suit::TRIANGLE, static_cast<CardValue>(i)));
-        }
-    }
-    void Deck::createCrossCards() 
-    {
-        // valid card values = 1, 2, 3, 5, 7, 10, 11, 13, 14
-        for (int i{1}; i <= 14; i++)
-        {
-            if (i == 4 || i == 6 || i == 8 || i == 9 || i == 12) { continue; }
-            cards_.push_back(std::make_unique<Card>(Suit::CROSS, static_cast<CardValue>(i)));
-        }
-    }
-    void Deck::createBlockCards() 
-    {
-        // valid card values = 1, 2, 3, 5, 7, 10, 11, 13, 14
-        for (int i{1}; i <= 14; i++)
-        {
-            if (i == 4 || i == 6 || i == 8 || i == 9 || i == 12) { continue; }
-            cards_.push_back(std::make_unique<Card>(Suit::BLOCK, static_cast<CardValue>(i)));
-        }
+        ++version_;
+        for (const CardSpec& spec : STANDARD_DECK)
+            cards_.emplace_back(spec.suit, spec.value);
     }
-    void Deck::createStarCards() 
-    {
-        // valid card values = 1, 2, 3, 4, 5, 7, 8
-        for (int i{1}; i <= 8; i++)
-        {
-            if (i == 6) { continue; }
-            cards_.push_back(std::make_unique<Card>(Suit::STAR, static_cast<CardValue>(i)));
-        }
-    }
-    void Deck::createWhotCards() 
+
+    void Deck::shuffle()
     {
-        for (int i = 0; i < WHOT_CARDS_COUNT; ++i)
-        {
-            cards_.push_back(std::make_unique<Card>(Suit::WHOT, CardValue::TWENTY));
+        ++version_;
+        // Fisher-Yates on our own bounded draw rather than std::shuffle, whose
+        // output differs between standard libraries for the same engine.
+        for (size_t i = cards_.size(); i > 1; --i) {
+            const size_t j = rng_.below(static_cast<uint32_t>(i));
+            std::swap(cards_[i - 1], cards_[j]);
         }
     }
 
-    void Deck::shuffle()
+    void Deck::seed(uint64_t seed)
     {
-        std::shuffle(cards_.begin(), cards_.end(), rng_);
+        ++version_;
+        rng_.seed(seed);
     }
 
-    std::unique_ptr<Card> Deck::draw()
+    std::optional<Card> Deck::draw()
     {
-        if (cards_.empty()) return nullptr;
-        std::unique_ptr<Card> top = std::move(cards_.back());
+        ++version_;
+        if (cards_.empty()) return std::nullopt;
+        Card top = cards_.back();
         cards_.pop_back();
         return top;
     }
 
-    void Deck::addCard(std::unique_ptr<Card> card)
+    void Deck::addCard(const Card& card)
     {
-        if (card) cards_.push_back(std::move(card));
+        ++version_;
+        cards_.push_back(card);
     }
 
-    void Deck::addCards(std::vector<std::unique_ptr<Card>> cards)
+    void Deck::addCards(const std::vector<Card>& cards)
     {
-        for (auto& card : cards) addCard(std::move(card));
+        ++version_;
+        cards_.insert(cards_.end(), cards.begin(), cards.end());
     }
 
     size_t Deck::size() const { return cards_.size(); }
+    uint64_t Deck::getVersion() const { return version_; }
     bool Deck::isEmpty() const { return cards_.empty(); }
 
-    const Card* Deck::peek() const
+    std::optional<Card> Deck::peek() const
     {
-        return cards_.empty() ? nullptr : cards_.back().get();
+        if (cards_.empty()) return std::nullopt;
+        return cards_.back();
     }
 
     void Deck::initializeStandardDeck()
@@ -130,40 +88,70 @@ namespace whot::core {
 
     void Deck::clear()
     {
+        ++version_;
         cards_.clear();
     }
 
-    void Deck::reshuffleFromDiscardPile(std::vector<std::unique_ptr<Card>> discardPile,
+    void Deck::reshuffleFromDiscardPile(const std::vector<Card>& discardPile,
                                         const Card& currentCallCard)
     {
-        for (auto& card : discardPile) {
-            if (card && !(*card == currentCallCard))
-                cards_.push_back(std::move(card));
+        ++version_;
+        for (const Card& card : discardPile) {
+            if (card != currentCallCard)
+                cards_.push_back(card);
         }
         shuffle();
     }
 
     std::string Deck::toJson() const
     {
-        using json = nlohmann::json;
-        json j = json::array();
-        for (const auto& card : cards_)
-            if (card) j.push_back(json::parse(card->toJson()));
-        return j.dump();
+        std::string out;
+        out.reserve(2 + cards_.size() * 40);
+        utils::JsonWriter w(out);
+        writeJson(w);
+        return out;
+    }
+
+    void Deck::writeJson(utils::JsonWriter& w) const
+    {
+        w.beginArray();
+        for (const Card& card : cards_) card.writeJson(w);
+        w.endArray();
     }
 
     Deck Deck::fromJson(const std::string& jsonStr)
     {
         using json = nlohmann::json;
-        Deck d;
-        d.cards_.clear();
+        Deck d(0, utils::FastRng::freshSeed());
         json j = json::parse(jsonStr);
         if (!j.is_array()) return d;
-        for (const auto& item : j) {
-            std::string cardStr = item.dump();
-            auto card = Card::fromJson(cardStr);
-            if (card) d.cards_.push_back(std::move(card));
+        for (const auto& item : j)
+            d.cards_.push_back(Card::fromJson(item.dump()));
+        return d;
+    }
+
+    void Deck::writeSnapshot(utils::ByteWriter& w) const
+    {
+        for (uint64_t word : rng_.state()) w.u64(word);
+        w.varint(cards_.size());
+        for (const Card& card : cards_) w.u8(card.toByte());
+    }
+
+    std::optional<Deck> Deck::readSnapshot(utils::ByteReader& r)
+    {
+        std::array<uint64_t, 4> state;
+        for (uint64_t& word : state) word = r.u64();
+        const uint64_t count = r.varint();
+        if (!r.ok() || count > 16 * STANDARD_DECK_SIZE) return std::nullopt;
+        Deck d(0, 0);
+        d.rng_.setState(state);
+        d.cards_.reserve(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            auto card = Card::fromByte(r.u8());
+            if (!card) return std::nullopt;
+            d.cards_.push_back(*card);
         }
+        if (!r.ok()) return std::nullopt;
         return d;
     }
 
@@ -1,123 +1,171 @@
 #include "../../include/Core/Hand.hpp"
+#include "Utils/JSONSerializer.hpp"
 #include <algorithm>
 #include <utility>
 #include <nlohmann/json.hpp>
 
 namespace whot::core {
 
-    Hand::Hand() : size_(0) {}
+    Hand::Hand() : size_(0), counts_{} {}
 
-    Hand::Hand(int numberOfCards) : size_(0)
+    Hand::Hand(int numberOfCards) : size_(0), counts_{}
     {
         cards_.reserve(static_cast<size_t>(numberOfCards));
     }
 
-    void Hand::addCard(std::unique_ptr<Card> card)
+    void Hand::addCard(const Card& card)
     {
-        if (card) {
-            cards_.push_back(std::move(card));
-            size_ = cards_.size();
-        }
+        cards_.push_back(card);
+        track(card);
+        size_ = cards_.size();
     }
 
-    void Hand::addCards(std::vector<std::unique_ptr<Card>> cards)
+    void Hand::addCards(const std::vector<Card>& cards)
     {
-        for (auto& card : cards) addCard(std::move(card));
+        cards_.insert(cards_.end(), cards.begin(), cards.end());
+        for (const Card& c : cards) track(c);
+        size_ = cards_.size();
     }
 
-    std::unique_ptr<Card> Hand::playCard(size_t index)
+    std::optional<Card> Hand::playCard(size_t index)
     {
-        if (index >= cards_.size()) return nullptr;
-        std::unique_ptr<Card> c = std::move(cards_[index]);
+        if (index >= cards_.size()) return std::nullopt;
+        Card c = cards_[index];
         cards_.erase(cards_.begin() + static_cast<std::ptrdiff_t>(index));
+        untrack(c);
         size_ = cards_.size();
         return c;
     }
 
-    std::unique_ptr<Card> Hand::playCard(const Card& card)
+    std::optional<Card> Hand::playCard(const Card& card)
     {
+        if (countOf(card) == 0) return std::nullopt;
         for (size_t i = 0; i < cards_.size(); ++i) {
-            if (*cards_[i] == card) return playCard(i);
+            if (cards_[i] == card) return playCard(i);
         }
-        return nullptr;
+        return std::nullopt;
+    }
+
+    void Hand::track(const Card& card)
+    {
+        ++version_;
+        const size_t id = cardIdentity(card);
+        ++counts_[id];
+        mask_.set(id);
+    }
+
+    void Hand::untrack(const Card& card)
+    {
+        ++version_;
+        const size_t id = cardIdentity(card);
+        if (--counts_[id] == 0) mask_.reset(id);
     }
 
     void Hand::sortCards()
     {
-        std::sort(cards_.begin(), cards_.end(), [](const std::unique_ptr<Card>& a, const std::unique_ptr<Card>& b) {
-            if (static_cast<int>(a->getSuit()) != static_cast<int>(b->getSuit()))
-                return static_cast<int>(a->getSuit()) < static_cast<int>(b->getSuit());
-            return a->getNumericValue() < b->getNumericValue();
+        ++version_;
+        std::sort(cards_.begin(), cards_.end(), [](const Card& a, const Card& b) {
+            if (static_cast<int>(a.getSuit()) != static_cast<int>(b.getSuit()))
+                return static_cast<int>(a.getSuit()) < static_cast<int>(b.getSuit());
+            return a.getNumericValue() < b.getNumericValue();
         });
     }
 
     size_t Hand::size() const { return cards_.size(); }
 
+    uint64_t Hand::getVersion() const { return version_; }
+
     bool Hand::isEmpty() const { return cards_.empty(); }
 
     bool Hand::hasCard(const Card& card) const
     {
-        for (const auto& c : cards_)
-            if (*c == card) return true;
-        return false;
+        return countOf(card) > 0;
     }
 
     const Card& Hand::getCard(size_t index) const
     {
-        return *cards_.at(index);
+        return cards_.at(index);
     }
 
     std::vector<size_t> Hand::getPlayableCardIndices(const Card& callCard) const
     {
         std::vector<size_t> indices;
+        if (!hasPlayableCard(callCard)) return indices;
         for (size_t i = 0; i < cards_.size(); ++i)
-            if (cards_[i]->canPlayOn(callCard)) indices.push_back(i);
+            if (cards_[i].canPlayOn(callCard)) indices.push_back(i);
         return indices;
     }
 
     bool Hand::hasPlayableCard(const Card& callCard) const
     {
-        return !getPlayableCardIndices(callCard).empty();
+        return getPlayableMask(callCard).any();
     }
 
-    std::vector<const Card*> Hand::getCardsBySuit(Suit suit) const
+    std::vector<Card> Hand::getCardsBySuit(Suit suit) const
     {
-        std::vector<const Card*> out;
-        for (const auto& c : cards_)
-            if (c->matchesSuit(suit)) out.push_back(c.get());
+        std::vector<Card> out;
+        if ((mask_ & suitMask(suit)).none()) return out;
+        for (const Card& c : cards_)
+            if (c.matchesSuit(suit)) out.push_back(c);
         return out;
     }
 
-    std::vector<const Card*> Hand::getCardsByValue(CardValue value) const
+    std::vector<Card> Hand::getCardsByValue(CardValue value) const
     {
-        std::vector<const Card*> out;
-        for (const auto& c : cards_)
-            if (c->matchesValue(value)) out.push_back(c.get());
+        std::vector<Card> out;
+        if ((mask_ & valueMask(value)).none()) return out;
+        for (const Card& c : cards_)
+            if (c.matchesValue(value)) out.push_back(c);
         return out;
     }
 
-    std::vector<const Card*> Hand::getWhotCards() const
+    std::vector<Card> Hand::getWhotCards() const
     {
-        std::vector<const Card*> out;
-        for (const auto& c : cards_)
-            if (c->isWhotCard()) out.push_back(c.get());
+        std::vector<Card> out;
+        if ((mask_ & whotMask()).none()) return out;
+        for (const Card& c : cards_)
+            if (c.isWhotCard()) out.push_back(c);
         return out;
     }
 
     int Hand::calculateTotalScore() const
     {
         int score = 0;
-        for (const auto& card : cards_) score += card->getScoreValue();
+        for (const Card& card : cards_) score += card.getScoreValue();
         return score;
     }
 
+    const CardMask& Hand::getCardMask() const { return mask_; }
+
+    CardMask Hand::getPlayableMask(const Card& callCard,
+                                   std::optional<Suit> demandedSuit) const
+    {
+        return mask_ & playableOnMask(callCard, demandedSuit);
+    }
+
+    CardMask Hand::getSuitMask(Suit suit) const { return mask_ & suitMask(suit); }
+
+    CardMask Hand::getValueMask(CardValue value) const { return mask_ & valueMask(value); }
+
+    size_t Hand::countOf(const Card& card) const
+    {
+        return counts_[cardIdentity(card)];
+    }
+
     std::string Hand::toJson() const
     {
-        using json = nlohmann::json;
-        json j = json::array();
-        for (const auto& card : cards_)
-            if (card) j.push_back(json::parse(card->toJson()));
-        return j.dump();
+        std::string out;
+        out.reserve(2 + cards_.size() * 40);
+        utils::JsonWriter w(out);
+        writeJson(w);
+        return out;
+    }
+
+    void Hand::writeJson(utils::JsonWriter& w) const
+    {
+        w.beginArray();
+        for (const Card& card : cards_) card.writeJson(w);
+        w.endArray();
     }
 
     Hand Hand::fromJson(const std::string& jsonStr)
@@ -126,11 +174,8 @@ namespace whot::core {
         Hand h;
         json j = json::parse(jsonStr);
         if (!j.is_array()) return h;
-        for (const auto& item : j) {
-            std::string cardStr = item.dump();
-            auto card = Card::fromJson(cardStr);
-            if (card) h.addCard(std::move(card));
-        }
+        for (const auto& item : j)
+            h.addCard(Card::fromJson(item.dump()));
         return h;
     }
 
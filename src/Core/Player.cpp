@@ -1,4 +1,6 @@
 #include "../../include/Core/Player.hpp"
+#include "Utils/ByteStream.hpp"
+#include "Utils/JSONSerializer.hpp"
 #include <chrono>
 #include <nlohmann/json.hpp>
 
@@ -22,34 +24,37 @@ Player::Player(const std::string& id, const std::string& name, PlayerType type)
 std::string Player::getId() const { return id_; }
 std::string Player::getName() const { return name_; }
 PlayerType Player::getType() const { return type_; }
-void Player::setName(const std::string& name) { name_ = name; }
+void Player::setName(const std::string& name) { ++version_; name_ = name; }
 
 Hand& Player::getHand() { return hand_; }
 const Hand& Player::getHand() const { return hand_; }
 
 PlayerStatus Player::getStatus() const { return status_; }
-void Player::setStatus(PlayerStatus status) { status_ = status; }
+void Player::setStatus(PlayerStatus status) { ++version_; status_ = status; }
 
 int Player::getCurrentScore() const { return currentScore_; }
 int Player::getCumulativeScore() const { return cumulativeScore_; }
 void Player::addToScore(int points)
 {
+    ++version_;
     currentScore_ += points;
     cumulativeScore_ += points;
 }
-void Player::resetCurrentScore() { currentScore_ = 0; }
+void Player::resetCurrentScore() { ++version_; currentScore_ = 0; }
 void Player::resetAllScores()
 {
+    ++version_;
     currentScore_ = 0;
     cumulativeScore_ = 0;
 }
 
 bool Player::hasSaidLastCard() const { return saidLastCard_; }
-void Player::setSaidLastCard(bool said) { saidLastCard_ = said; }
+void Player::setSaidLastCard(bool said) { ++version_; saidLastCard_ = said; }
 bool Player::hasSaidCheckUp() const { return saidCheckUp_; }
-void Player::setSaidCheckUp(bool said) { saidCheckUp_ = said; }
+void Player::setSaidCheckUp(bool said) { ++version_; saidCheckUp_ = said; }
 void Player::resetTurnFlags()
 {
+    ++version_;
     saidLastCard_ = false;
     saidCheckUp_ = false;
 }
@@ -66,28 +71,45 @@ bool Player::hasExceededTurnTime(int maxSeconds) const
 
 int Player::getGamesWon() const { return gamesWon_; }
 int Player::getGamesPlayed() const { return gamesPlayed_; }
-void Player::incrementGamesPlayed() { ++gamesPlayed_; }
-void Player::incrementGamesWon() { ++gamesWon_; }
-void Player::setGamesPlayed(int n) { gamesPlayed_ = n; }
-void Player::setGamesWon(int n) { gamesWon_ = n; }
-void Player::setCumulativeScore(int n) { cumulativeScore_ = n; }
+void Player::incrementGamesPlayed() { ++version_; ++gamesPlayed_; }
+void Player::incrementGamesWon() { ++version_; ++gamesWon_; }
+void Player::setGamesPlayed(int n) { ++version_; gamesPlayed_ = n; }
+void Player::setGamesWon(int n) { ++version_; gamesWon_ = n; }
+void Player::setCumulativeScore(int n) { ++version_; cumulativeScore_ = n; }
+
+uint64_t Player::getVersion() const { return version_ + hand_.getVersion(); }
 
 std::string Player::toJson() const
 {
-    using json = nlohmann::json;
-    json j;
-    j["id"] = id_;
-    j["name"] = name_;
-    j["type"] = static_cast<int>(type_);
-    j["status"] = static_cast<int>(status_);
-    j["hand"] = json::parse(hand_.toJson());
-    j["currentScore"] = currentScore_;
-    j["cumulativeScore"] = cumulativeScore_;
-    j["saidLastCard"] = saidLastCard_;
-    j["saidCheckUp"] = saidCheckUp_;
-    j["gamesPlayed"] = gamesPlayed_;
-    j["gamesWon"] = gamesWon_;
-    return j.dump();
+    std::string out;
+    out.reserve(224 + hand_.size() * 40);
+    utils::JsonWriter w(out);
+    writeJson(w);
+    return out;
+}
+
+void Player::writeJson(utils::JsonWriter& w) const
+{
+    writeJson(w, [this](utils::JsonWriter& hw) { hand_.writeJson(hw); });
+}
+
+void Player::writeJson(utils::JsonWriter& w,
+                       const std::function<void(utils::JsonWriter&)>& writeHand) const
+{
+    // Sorted keys, byte-identical to the nlohmann::json output saved games hold.
+    w.beginObject();
+    w.key("cumulativeScore").value(cumulativeScore_);
+    w.key("currentScore").value(currentScore_);
+    w.key("gamesPlayed").value(gamesPlayed_);
+    w.key("gamesWon").value(gamesWon_);
+    writeHand(w.key("hand"));
+    w.key("id").value(id_);
+    w.key("name").value(name_);
+    w.key("saidCheckUp").value(saidCheckUp_);
+    w.key("saidLastCard").value(saidLastCard_);
+    w.key("status").value(static_cast<int>(status_));
+    w.key("type").value(static_cast<int>(type_));
+    w.endObject();
 }
 
 std::unique_ptr<Player> Player::fromJson(const std::string& jsonStr)
@@ -110,4 +132,46 @@ std::unique_ptr<Player> Player::fromJson(const std::string& jsonStr)
     return p;
 }
 
+void Player::writeSnapshot(utils::ByteWriter& w) const
+{
+    w.str(id_);
+    w.str(name_);
+    w.u8(static_cast<uint8_t>(type_));
+    w.u8(static_cast<uint8_t>(status_));
+    w.svarint(currentScore_);
+    w.svarint(cumulativeScore_);
+    w.svarint(gamesPlayed_);
+    w.svarint(gamesWon_);
+    w.u8((saidLastCard_ ? 1 : 0) | (saidCheckUp_ ? 2 : 0));
+    w.varint(hand_.size());
+    for (size_t i = 0; i < hand_.size(); ++i) w.u8(hand_.getCard(i).toByte());
+}
+
+std::unique_ptr<Player> Player::readSnapshot(utils::ByteReader& r)
+{
+    std::string id(r.str());
+    std::string name(r.str());
+    auto p = std::make_unique<Player>(id, name, static_cast<PlayerType>(r.u8()));
+    p->status_ = static_cast<PlayerStatus>(r.u8());
+    p->currentScore_ = static_cast<int>(r.svarint());
+    p->cumulativeScore_ = static_cast<int>(r.svarint());
+    p->gamesPlayed_ = static_cast<int>(r.svarint());
+    p->gamesWon_ = static_cast<int>(r.svarint());
+    const uint8_t flags = r.u8();
+    p->saidLastCard_ = flags & 1;
+    p->saidCheckUp_ = flags & 2;
+    const uint64_t count = r.varint();
+    if (!r.ok() || count > 16 * STANDARD_DECK_SIZE) return nullptr;
+    std::vector<Card> cards;
+    cards.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        auto card = Card::fromByte(r.u8());
+        if (!card) return nullptr;
+        cards.push_back(*card);
+    }
+    if (!r.ok()) return nullptr;
+    p->hand_.addCards(cards);
+    return p;
+}
+
 } // namespace whot::core
@@ -2,8 +2,8 @@
 #include "../../include/Game/ScoreCalculator.hpp"
 #include "../../include/Core/GameConstants.hpp"
 #include "../../include/Core/Card.hpp"
-#include <nlohmann/json.hpp>
 #include <algorithm>
+#include <utility>
 
 namespace whot::game {
 
@@ -19,10 +19,12 @@ void GameEngine::startGame() {
     if (!state_) return;
     state_->initialize();
     state_->setPhase(GamePhase::STARTING);
+    journal_ = GameJournal(*state_);
 }
 
 void GameEngine::startNewRound() {
     if (!state_) return;
+    journal_.recordRoundStart();
     state_->startRound();
     // Deal starting cards to each active player
     int nCards = state_->getConfig().startingCards;
@@ -32,16 +34,16 @@ void GameEngine::startNewRound() {
             if (state_->getDeck().isEmpty() && state_->needsReshufffle())
                 state_->reshuffleDiscardPile();
             auto card = state_->getDeck().draw();
-            if (card) p->getHand().addCard(std::move(card));
+            if (card) p->getHand().addCard(*card);
         }
     }
     // Flip first call card from deck
     if (!state_->getDeck().isEmpty()) {
         auto first = state_->getDeck().draw();
-        if (first) state_->setCallCard(std::move(first));
+        if (first) state_->setCallCard(*first);
     }
     if (turnManager_) turnManager_->startTurn();
-    emitEvent("round_started", state_->toJson());
+    emitEvent(GameEventType::ROUND_STARTED, RoundStartedEvent{state_->getCallCard(), state_->getPlayerCount()});
 }
 
 ActionResult GameEngine::processAction(const GameAction& action) {
@@ -51,32 +53,84 @@ ActionResult GameEngine::processAction(const GameAction& action) {
         r.message = "Invalid action";
         return r;
     }
+    ActionResult r;
     switch (action.type) {
-        case ActionType::PLAY_CARD: return handlePlayCard(action);
-        case ActionType::DRAW_CARD: return handleDrawCard(action);
+        case ActionType::PLAY_CARD: r = handlePlayCard(action); break;
+        case ActionType::DRAW_CARD: r = handleDrawCard(action); break;
         case ActionType::DECLARE_LAST_CARD:
-        case ActionType::DECLARE_CHECK_UP: return handleDeclaration(action);
-        case ActionType::CHOOSE_SUIT: return handleSuitChoice(action);
-        default: {
-            ActionResult r; r.success = false; r.message = "Unhandled action"; return r;
-        }
+        case ActionType::DECLARE_CHECK_UP: r = handleDeclaration(action); break;
+        case ActionType::CHOOSE_SUIT: r = handleSuitChoice(action); break;
+        default: r.success = false; r.message = "Unhandled action"; return r;
+    }
+    if (r.success) {
+        journal_.recordAction(action);
+        turnManager_->recordAction({action.playerId, action.type, std::chrono::system_clock::now(), true});
     }
+    return r;
 }
 
 void GameEngine::endGame() {
+    journal_.recordGameEnd();
     if (state_) state_->endGame();
-    emitEvent("game_ended", state_ ? state_->toJson() : "{}");
+    emitEvent(GameEventType::GAME_ENDED, GameEndedEvent{state_ ? state_->getWinnerId() : std::nullopt});
+}
+
+void GameEngine::removePlayer(const std::string& playerId) {
+    if (!state_) return;
+    journal_.recordPlayerRemoved(playerId);
+    state_->removePlayer(playerId);
 }
 
 GameState* GameEngine::getState() { return state_.get(); }
 const GameState* GameEngine::getState() const { return state_.get(); }
+const GameJournal& GameEngine::getJournal() const { return journal_; }
+GameJournal::Suffix GameEngine::takeUnsavedJournal() { return journal_.takeUnsaved(); }
+void GameEngine::restoreJournal(GameJournal journal) { journal_ = std::move(journal); }
+const TurnManager* GameEngine::getTurnManager() const { return turnManager_.get(); }
+
+SubscriptionId GameEngine::subscribe(GameEventType type, GameEventHandler handler) {
+    const SubscriptionId id = nextSubscriptionId_++;
+    subscribers_[static_cast<size_t>(type)].push_back({id, std::move(handler)});
+    return id;
+}
 
-void GameEngine::registerEventCallback(const std::string& eventType, GameEventCallback callback) {
-    eventCallbacks_[eventType].push_back(std::move(callback));
+SubscriptionId GameEngine::subscribeAll(GameEventHandler handler) {
+    const SubscriptionId id = nextSubscriptionId_++;
+    subscribers_[kGameEventTypeCount].push_back({id, std::move(handler)});
+    return id;
+}
+
+void GameEngine::unsubscribe(SubscriptionId id) {
+    for (auto& list : subscribers_) {
+        list.erase(std::remove_if(list.begin(), list.end(),
+                                  [id](const Subscriber& s) { return s.id == id; }),
+                   list.end());
+    }
+}
+
+bool GameEngine::registerEventCallback(const std::string& eventType, GameEventCallback callback) {
+    GameEventHandler handler = [callback = std::move(callback)](const GameEvent& event) {
+        callback(gameEventName(event.type), event.stateJson());
+    };
+    if (eventType == "*") {
+        namedSubscriptions_[eventType].push_back(subscribeAll(std::move(handler)));
+        return true;
+    }
+    for (size_t i = 0; i < kGameEventTypeCount; ++i) {
+        const auto type = static_cast<GameEventType>(i);
+        if (eventType == gameEventName(type)) {
+            namedSubscriptions_[eventType].push_back(subscribe(type, std::move(handler)));
+            return true;
+        }
+    }
+    return false;
 }
 
 void GameEngine::unregisterEventCallback(const std::string& eventType) {
-    eventCallbacks_.erase(eventType);
+    auto it = namedSubscriptions_.find(eventType);
+    if (it == namedSubscriptions_.end()) return;
+    for (SubscriptionId id : it->second) unsubscribe(id);
+    namedSubscriptions_.erase(it);
 }
 
 bool GameEngine::isValidAction(const GameAction& action) const {
@@ -105,13 +159,7 @@ std::vector<ActionType> GameEngine::getValidActionsForCurrentPlayer() const {
     if (!state_ || !turnManager_) return out;
     core::Player* p = state_->getCurrentPlayer();
     if (!p) return out;
-    bool canPlay = false;
-    for (size_t i = 0; i < p->getHand().size(); ++i) {
-        if (ruleEngine_->canPlayCard(*state_, *p, p->getHand().getCard(i))) {
-            canPlay = true; break;
-        }
-    }
-    if (canPlay) out.push_back(ActionType::PLAY_CARD);
+    if (ruleEngine_->hasPlayableCard(*state_, *p)) out.push_back(ActionType::PLAY_CARD);
     if (ruleEngine_->mustDrawCard(*state_, *p))
         out.push_back(ActionType::DRAW_CARD);
     if (ruleEngine_->requiresLastCardDeclaration(*p))
@@ -141,22 +189,21 @@ ActionResult GameEngine::handlePlayCard(const GameAction& action) {
     if (!player) { r.message = "Player not found"; return r; }
     size_t idx = action.cardIndex.value();
     if (idx >= player->getHand().size()) { r.message = "Invalid card index"; return r; }
-    const core::Card& card = player->getHand().getCard(idx);
+    const core::Card card = player->getHand().getCard(idx);
     if (!validateCardPlay(player, card)) { r.message = "Card cannot be played"; return r; }
 
-    std::unique_ptr<core::Card> played = player->getHand().playCard(idx);
-    if (!played) { r.message = "Failed to play card"; return r; }
+    if (!player->getHand().playCard(idx)) { r.message = "Failed to play card"; return r; }
 
-    state_->addToDiscardPile(std::move(played));
-    state_->setCallCard(std::make_unique<core::Card>(card.getSuit(), card.getValue()));
+    state_->addToDiscardPile(card);
+    state_->setCallCard(card);
     state_->clearDemandedSuit();
 
     executeSpecialCard(card, player);
 
     r.affectedPlayerIds.push_back(action.playerId);
     r.success = true;
-    r.newStateJson = state_->toJson();
-    emitEvent("card_played", r.newStateJson);
+    r.state = state_.get();
+    emitEvent(GameEventType::CARD_PLAYED, CardPlayedEvent{action.playerId, card});
 
     if (state_->checkRoundEnd()) {
         auto winnerId = state_->getWinnerId();
@@ -171,7 +218,7 @@ ActionResult GameEngine::handlePlayCard(const GameAction& action) {
             }
         }
         state_->endRound();
-        emitEvent("round_ended", state_->toJson());
+        emitEvent(GameEventType::ROUND_ENDED, RoundEndedEvent{winnerId});
     } else if (!turnManager_->canPlayAgain()) {
         turnManager_->endTurn();
     }
@@ -187,16 +234,20 @@ ActionResult GameEngine::handleDrawCard(const GameAction& action) {
     if (!player) return r;
     int count = ruleEngine_->calculateDrawCount(*state_, *player);
     if (state_->needsReshufffle()) state_->reshuffleDiscardPile();
+    int drawn = 0;
     for (int i = 0; i < count && !state_->getDeck().isEmpty(); ++i) {
         auto card = state_->getDeck().draw();
-        if (card) player->getHand().addCard(std::move(card));
+        if (card) {
+            player->getHand().addCard(*card);
+            ++drawn;
+        }
     }
     state_->resetActivePickCount();
     r.success = true;
     r.affectedPlayerIds.push_back(action.playerId);
-    r.newStateJson = state_->toJson();
+    r.state = state_.get();
     turnManager_->endTurn();
-    emitEvent("card_drawn", r.newStateJson);
+    emitEvent(GameEventType::CARD_DRAWN, CardDrawnEvent{action.playerId, drawn});
     return r;
 }
 
@@ -208,7 +259,7 @@ ActionResult GameEngine::handleDeclaration(const GameAction& action) {
         if (action.type == ActionType::DECLARE_LAST_CARD) p->setSaidLastCard(true);
         if (action.type == ActionType::DECLARE_CHECK_UP) p->setSaidCheckUp(true);
     }
-    r.newStateJson = state_ ? state_->toJson() : "{}";
+    r.state = state_.get();
     return r;
 }
 
@@ -220,17 +271,21 @@ ActionResult GameEngine::handleSuitChoice(const GameAction& action) {
     if (action.chosenDirection.has_value() && state_ && state_->getConfig().allowDirectionChange)
         state_->reverseDirection();
     r.success = true;
-    r.newStateJson = state_ ? state_->toJson() : "{}";
+    r.state = state_.get();
+    emitEvent(GameEventType::SUIT_CHOSEN, SuitChosenEvent{action.playerId, action.chosenSuit.value()});
     return r;
 }
 
-void GameEngine::emitEvent(const std::string& eventType, const std::string& eventData) {
-    auto it = eventCallbacks_.find(eventType);
-    if (it != eventCallbacks_.end())
-        for (const auto& cb : it->second) cb(eventType, eventData);
-    it = eventCallbacks_.find("*");
-    if (it != eventCallbacks_.end())
-        for (const auto& cb : it->second) cb(eventType, eventData);
+bool GameEngine::hasSubscribers(GameEventType type) const {
+    return !subscribers_[static_cast<size_t>(type)].empty() ||
+           !subscribers_[kGameEventTypeCount].empty();
+}
+
+void GameEngine::emitEvent(GameEventType type, GameEventData data) {
+    if (!hasSubscribers(type)) return;
+    const GameEvent event{type, std::move(data), state_.get()};
+    for (const auto& s : subscribers_[static_cast<size_t>(type)]) s.handler(event);
+    for (const auto& s : subscribers_[kGameEventTypeCount]) s.handler(event);
 }
 
 void GameEngine::executeSpecialCard(const core::Card& card, core::Player* player) {
@@ -260,7 +315,7 @@ void GameEngine::executeSpecialCard(const core::Card& card, core::Player* player
             if (!p || p->getId() == player->getId()) continue;
             if (state_->getDeck().isEmpty() && state_->needsReshufffle()) state_->reshuffleDiscardPile();
             auto c = state_->getDeck().draw();
-            if (c) p->getHand().addCard(std::move(c));
+            if (c) p->getHand().addCard(*c);
         }
         return;
     }
@@ -272,8 +327,7 @@ void GameEngine::executeSpecialCard(const core::Card& card, core::Player* player
 
 bool GameEngine::validateCardPlay(const core::Player* player, const core::Card& card) const {
     if (!state_ || !player) return false;
-    const core::Card* call = state_->getCallCard();
-    if (!call) return false;
+    if (!state_->getCallCard()) return false;
     return ruleEngine_->canPlayCard(*state_, *player, card);
 }
 
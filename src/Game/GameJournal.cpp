@@ -0,0 +1,223 @@
+#include "../../include/Game/GameJournal.hpp"
+#include "../../include/Game/GameEngine.hpp"
+#include "Core/GameConstants.hpp"
+#include "Utils/ByteStream.hpp"
+#include <algorithm>
+
+namespace whot::game {
+
+namespace {
+
+constexpr uint8_t kMagic0 = 'W';
+constexpr uint8_t kMagic1 = 'J';
+constexpr uint8_t kJournalVersion = 1;
+
+enum class Entry : uint8_t {
+    ROUND_STARTED = 1,
+    ACTION = 2,
+    PLAYER_REMOVED = 3,
+    GAME_ENDED = 4
+};
+
+// GameAction field bits
+constexpr uint8_t kHasCardIndex = 1;
+constexpr uint8_t kHasSuit = 2;
+constexpr uint8_t kHasDirection = 4;
+
+struct Seat {
+    std::string id;
+    std::string name;
+    core::PlayerType type;
+};
+
+struct Header {
+    std::string gameId;
+    std::string gameCode;
+    std::string creatorPlayerId;
+    uint64_t seed = 0;
+    GameConfig config;
+    std::vector<Seat> seats;
+};
+
+struct DecodedEntry {
+    Entry type;
+    size_t seat = 0;
+    GameAction action;
+};
+
+bool readHeader(utils::ByteReader& r, Header& h) {
+    if (r.u8() != kMagic0 || r.u8() != kMagic1 || r.u8() != kJournalVersion) return false;
+    h.gameId = std::string(r.str());
+    h.gameCode = std::string(r.str());
+    h.creatorPlayerId = std::string(r.str());
+    h.seed = r.varint();
+    h.config = readConfig(r);
+    const uint64_t count = r.varint();
+    if (!r.ok() || count > 255) return false;
+    for (uint64_t i = 0; i < count; ++i) {
+        Seat seat;
+        seat.id = std::string(r.str());
+        seat.name = std::string(r.str());
+        const uint8_t type = r.u8();
+        if (type > static_cast<uint8_t>(core::PlayerType::AI_HARD)) return false;
+        seat.type = static_cast<core::PlayerType>(type);
+        h.seats.push_back(std::move(seat));
+    }
+    return r.ok();
+}
+
+/// False at a truncated or unknown entry, or one naming a seat past
+/// `seatCount` or a value outside its enum.
+bool readEntry(utils::ByteReader& r, size_t seatCount, DecodedEntry& e) {
+    const uint8_t tag = r.u8();
+    if (tag < static_cast<uint8_t>(Entry::ROUND_STARTED) || tag > static_cast<uint8_t>(Entry::GAME_ENDED))
+        return false;
+    e.type = static_cast<Entry>(tag);
+    if (e.type == Entry::PLAYER_REMOVED || e.type == Entry::ACTION) {
+        e.seat = r.varint();
+        if (e.seat >= seatCount) return false;
+    }
+    if (e.type == Entry::ACTION) {
+        e.action = GameAction{};
+        const uint8_t type = r.u8();
+        const uint8_t fields = r.u8();
+        if (type > static_cast<uint8_t>(ActionType::FORFEIT_TURN) ||
+            (fields & ~(kHasCardIndex | kHasSuit | kHasDirection)) != 0)
+            return false;
+        e.action.type = static_cast<ActionType>(type);
+        if (fields & kHasCardIndex) e.action.cardIndex = r.varint();
+        if (fields & kHasSuit) {
+            const uint8_t suit = r.u8();
+            if (suit >= core::SUIT_COUNT) return false;
+            e.action.chosenSuit = static_cast<core::Suit>(suit);
+        }
+        if (fields & kHasDirection) {
+            const uint8_t direction = r.u8();
+            if (direction > static_cast<uint8_t>(PlayDirection::COUNTER_CLOCKWISE)) return false;
+            e.action.chosenDirection = static_cast<PlayDirection>(direction);
+        }
+    }
+    return r.ok();
+}
+
+}  // namespace
+
+GameJournal::GameJournal(const GameState& state) {
+    utils::ByteWriter w(bytes_);
+    w.u8(kMagic0);
+    w.u8(kMagic1);
+    w.u8(kJournalVersion);
+    w.str(state.getGameId());
+    w.str(state.getGameCode());
+    w.str(state.getCreatorPlayerId());
+    w.varint(state.getSeed());
+    writeConfig(w, state.getConfig());
+    const auto players = state.getAllPlayers();
+    w.varint(players.size());
+    for (const core::Player* p : players) {
+        w.str(p->getId());
+        w.str(p->getName());
+        w.u8(static_cast<uint8_t>(p->getType()));
+        seats_.push_back(p->getId());
+    }
+}
+
+void GameJournal::recordRoundStart() {
+    if (!isOpen()) return;
+    bytes_.push_back(static_cast<char>(Entry::ROUND_STARTED));
+    ++entryCount_;
+}
+
+void GameJournal::recordAction(const GameAction& action) {
+    const size_t seat = seatOf(action.playerId);
+    if (!isOpen() || seat == seats_.size()) return;
+    utils::ByteWriter w(bytes_);
+    w.u8(static_cast<uint8_t>(Entry::ACTION));
+    w.varint(seat);
+    w.u8(static_cast<uint8_t>(action.type));
+    w.u8((action.cardIndex ? kHasCardIndex : 0) | (action.chosenSuit ? kHasSuit : 0) |
+         (action.chosenDirection ? kHasDirection : 0));
+    if (action.cardIndex) w.varint(*action.cardIndex);
+    if (action.chosenSuit) w.u8(static_cast<uint8_t>(*action.chosenSuit));
+    if (action.chosenDirection) w.u8(static_cast<uint8_t>(*action.chosenDirection));
+    ++entryCount_;
+}
+
+void GameJournal::recordPlayerRemoved(const std::string& playerId) {
+    const size_t seat = seatOf(playerId);
+    if (!isOpen() || seat == seats_.size()) return;
+    utils::ByteWriter w(bytes_);
+    w.u8(static_cast<uint8_t>(Entry::PLAYER_REMOVED));
+    w.varint(seat);
+    ++entryCount_;
+}
+
+void GameJournal::recordGameEnd() {
+    if (!isOpen()) return;
+    bytes_.push_back(static_cast<char>(Entry::GAME_ENDED));
+    ++entryCount_;
+}
+
+size_t GameJournal::seatOf(const std::string& playerId) const {
+    return static_cast<size_t>(std::find(seats_.begin(), seats_.end(), playerId) - seats_.begin());
+}
+
+GameJournal::Suffix GameJournal::takeUnsaved() {
+    Suffix suffix{savedSize_, bytes_.substr(savedSize_)};
+    savedSize_ = bytes_.size();
+    return suffix;
+}
+
+std::optional<GameJournal> GameJournal::fromBytes(std::string_view bytes) {
+    utils::ByteReader r(bytes);
+    Header header;
+    if (!readHeader(r, header)) return std::nullopt;
+    GameJournal journal;
+    for (const Seat& seat : header.seats) journal.seats_.push_back(seat.id);
+    DecodedEntry entry;
+    while (!r.atEnd()) {
+        if (!readEntry(r, header.seats.size(), entry)) return std::nullopt;
+        ++journal.entryCount_;
+    }
+    journal.bytes_ = std::string(bytes);
+    journal.savedSize_ = journal.bytes_.size();
+    return journal;
+}
+
+std::unique_ptr<GameEngine> GameJournal::replay() const {
+    utils::ByteReader r(bytes_);
+    Header header;
+    if (!readHeader(r, header)) return nullptr;
+    auto state = std::make_unique<GameState>(header.config);
+    state->gameId_ = header.gameId;
+    state->setGameCode(header.gameCode);
+    state->setSeed(header.seed);
+    for (const Seat& seat : header.seats)
+        state->addPlayer(std::make_unique<core::Player>(seat.id, seat.name, seat.type));
+    state->setCreatorPlayerId(header.creatorPlayerId);
+
+    auto engine = std::make_unique<GameEngine>(std::move(state));
+    engine->startGame();
+    DecodedEntry entry;
+    while (!r.atEnd()) {
+        if (!readEntry(r, header.seats.size(), entry)) return nullptr;
+        switch (entry.type) {
+            case Entry::ROUND_STARTED:
+                engine->startNewRound();
+                break;
+            case Entry::ACTION:
+                entry.action.playerId = header.seats[entry.seat].id;
+                if (!engine->processAction(entry.action).success) return nullptr;
+                break;
+            case Entry::PLAYER_REMOVED:
+                engine->removePlayer(header.seats[entry.seat].id);
+                break;
+            case Entry::GAME_ENDED:
+                engine->endGame();
+                break;
+        }
+    }
+    return engine;
+}
+
+} // namespace whot::game
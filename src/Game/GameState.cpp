@@ -1,5 +1,8 @@
 #include "../../include/Game/GameState.hpp"
 #include "../../include/Core/GameConstants.hpp"
+#include "Utils/ByteStream.hpp"
+#include "Utils/FastRng.hpp"
+#include "Utils/JSONSerializer.hpp"
 #include <nlohmann/json.hpp>
 #include <algorithm>
 #include <sstream>
@@ -13,30 +16,91 @@ std::string generateGameId() {
     oss << "game-" << std::chrono::system_clock::now().time_since_epoch().count() << "-" << (counter++);
     return oss.str();
 }
+
+constexpr uint8_t kStateViewVersion = 1;
+constexpr uint8_t kNone = 0xFF;
+constexpr uint8_t kSaidLastCard = 1;
+constexpr uint8_t kSaidCheckUp = 2;
+constexpr uint8_t kHandVisible = 4;
+
+constexpr uint8_t kSnapshotMagic0 = 'W';
+constexpr uint8_t kSnapshotMagic1 = 'S';
+constexpr uint8_t kSnapshotVersion = 1;
+constexpr size_t kSnapshotHeaderSize = 3 + 8;  // magic, version, checksum
+
+// GameConfig flag bits
+constexpr uint8_t kDoubleDecking = 1;
+constexpr uint8_t kDirectionChange = 2;
+constexpr uint8_t kTurnTimer = 4;
+
+/// Binary player record from the flags byte on; cards only when visible.
+void writeBinaryPlayerTail(utils::ByteWriter& w, const core::Player& p, bool handVisible) {
+    w.u8((p.hasSaidLastCard() ? kSaidLastCard : 0) | (p.hasSaidCheckUp() ? kSaidCheckUp : 0) |
+         (handVisible ? kHandVisible : 0));
+    w.varint(static_cast<uint64_t>(std::max(p.getGamesPlayed(), 0)));
+    w.varint(static_cast<uint64_t>(std::max(p.getGamesWon(), 0)));
+    const core::Hand& hand = p.getHand();
+    w.varint(hand.size());
+    if (handVisible) {
+        for (size_t i = 0; i < hand.size(); ++i) w.u8(hand.getCard(i).toByte());
+    }
+}
 } // namespace
 
+void writeConfig(utils::ByteWriter& w, const GameConfig& config) {
+    w.varint(config.seed);
+    w.svarint(config.minPlayers);
+    w.svarint(config.maxPlayers);
+    w.svarint(config.startingCards);
+    w.svarint(config.turnTimeSeconds);
+    w.svarint(config.eliminationScore);
+    w.u8((config.allowDoubleDecking ? kDoubleDecking : 0) |
+         (config.allowDirectionChange ? kDirectionChange : 0) |
+         (config.enforceTurnTimer ? kTurnTimer : 0));
+}
+
+GameConfig readConfig(utils::ByteReader& r) {
+    GameConfig config;
+    config.seed = r.varint();
+    config.minPlayers = static_cast<int>(r.svarint());
+    config.maxPlayers = static_cast<int>(r.svarint());
+    config.startingCards = static_cast<int>(r.svarint());
+    config.turnTimeSeconds = static_cast<int>(r.svarint());
+    config.eliminationScore = static_cast<int>(r.svarint());
+    const uint8_t flags = r.u8();
+    config.allowDoubleDecking = flags & kDoubleDecking;
+    config.allowDirectionChange = flags & kDirectionChange;
+    config.enforceTurnTimer = flags & kTurnTimer;
+    return config;
+}
+
 GameState::GameState(const GameConfig& config)
     : config_(config)
     , phase_(GamePhase::LOBBY)
     , currentPlayerIndex_(0)
     , direction_(PlayDirection::CLOCKWISE)
+    , seed_(config.seed != 0 ? config.seed : utils::FastRng::freshSeed())
+    , deck_(0, seed_)
     , activePickCount_(0)
     , gameId_(generateGameId())
     , createdAt_(std::chrono::system_clock::now())
 {}
 
 void GameState::initialize() {
+    ++version_;
     phase_ = GamePhase::LOBBY;
     currentPlayerIndex_ = 0;
     direction_ = PlayDirection::CLOCKWISE;
     activePickCount_ = 0;
     demandedSuit_.reset();
     deck_.clear();
+    deck_.seed(seed_);
     discardPile_.clear();
     callCard_.reset();
 }
 
 void GameState::startRound() {
+    ++version_;
     phase_ = GamePhase::IN_PROGRESS;
     currentPlayerIndex_ = 0;
     direction_ = PlayDirection::CLOCKWISE;
@@ -51,10 +115,11 @@ void GameState::startRound() {
     }
 }
 
-void GameState::endRound() { phase_ = GamePhase::ROUND_ENDED; }
-void GameState::endGame() { phase_ = GamePhase::GAME_ENDED; }
+void GameState::endRound() { ++version_; phase_ = GamePhase::ROUND_ENDED; }
+void GameState::endGame() { ++version_; phase_ = GamePhase::GAME_ENDED; }
 
 void GameState::addPlayer(std::unique_ptr<core::Player> player) {
+    ++version_;
     if (player && players_.size() < static_cast<size_t>(config_.maxPlayers)) {
         if (players_.empty())
             creatorPlayerId_ = player->getId();
@@ -63,6 +128,10 @@ void GameState::addPlayer(std::unique_ptr<core::Player> player) {
 }
 
 void GameState::removePlayer(const std::string& playerId) {
+    // Keep getVersion() growing when the player's counters leave the sum.
+    for (const auto& p : players_)
+        if (p && p->getId() == playerId) version_ += p->getVersion();
+    ++version_;
     players_.erase(
         std::remove_if(players_.begin(), players_.end(),
             [&playerId](const std::unique_ptr<core::Player>& p) {
@@ -141,6 +210,7 @@ int GameState::getNextPlayerIndex() const {
 }
 
 void GameState::advanceTurn() {
+    ++version_;
     if (players_.empty()) return;
     currentPlayerIndex_ = getNextPlayerIndex();
 }
@@ -150,6 +220,7 @@ void GameState::skipNextPlayer() {
 }
 
 void GameState::reverseDirection() {
+    ++version_;
     direction_ = (direction_ == PlayDirection::CLOCKWISE)
         ? PlayDirection::COUNTER_CLOCKWISE
         : PlayDirection::CLOCKWISE;
@@ -159,40 +230,51 @@ int GameState::getCurrentPlayerIndex() const { return currentPlayerIndex_; }
 PlayDirection GameState::getPlayDirection() const { return direction_; }
 
 core::Deck& GameState::getDeck() { return deck_; }
-const core::Card* GameState::getCallCard() const { return callCard_.get(); }
 
-void GameState::setCallCard(std::unique_ptr<core::Card> card) {
-    callCard_ = std::move(card);
+uint64_t GameState::getSeed() const { return seed_; }
+
+void GameState::setSeed(uint64_t seed) {
+    ++version_;
+    seed_ = seed;
+    deck_.seed(seed_);
+}
+std::optional<core::Card> GameState::getCallCard() const { return callCard_; }
+
+void GameState::setCallCard(const core::Card& card) {
+    ++version_;
+    callCard_ = card;
 }
 
-void GameState::addToDiscardPile(std::unique_ptr<core::Card> card) {
-    if (card) discardPile_.push_back(std::move(card));
+void GameState::addToDiscardPile(const core::Card& card) {
+    ++version_;
+    discardPile_.push_back(card);
 }
 
-void GameState::setActivePickCount(int count) { activePickCount_ = count; }
+void GameState::setActivePickCount(int count) { ++version_; activePickCount_ = count; }
 int GameState::getActivePickCount() const { return activePickCount_; }
-void GameState::resetActivePickCount() { activePickCount_ = 0; }
+void GameState::resetActivePickCount() { ++version_; activePickCount_ = 0; }
 
-void GameState::setDemandedSuit(std::optional<core::Suit> suit) { demandedSuit_ = suit; }
+void GameState::setDemandedSuit(std::optional<core::Suit> suit) { ++version_; demandedSuit_ = suit; }
 std::optional<core::Suit> GameState::getDemandedSuit() const { return demandedSuit_; }
-void GameState::clearDemandedSuit() { demandedSuit_.reset(); }
+void GameState::clearDemandedSuit() { ++version_; demandedSuit_.reset(); }
 
 GamePhase GameState::getPhase() const { return phase_; }
-void GameState::setPhase(GamePhase phase) { phase_ = phase; }
+void GameState::setPhase(GamePhase phase) { ++version_; phase_ = phase; }
 const GameConfig& GameState::getConfig() const { return config_; }
 const std::string& GameState::getGameId() const { return gameId_; }
 const std::string& GameState::getGameCode() const { return gameCode_; }
-void GameState::setGameCode(const std::string& code) { gameCode_ = code; }
+void GameState::setGameCode(const std::string& code) { ++version_; gameCode_ = code; }
 const std::string& GameState::getCreatorPlayerId() const { return creatorPlayerId_; }
-void GameState::setCreatorPlayerId(const std::string& playerId) { creatorPlayerId_ = playerId; }
+void GameState::setCreatorPlayerId(const std::string& playerId) { ++version_; creatorPlayerId_ = playerId; }
 
 bool GameState::needsReshufffle() const {
     return deck_.isEmpty() && !discardPile_.empty();
 }
 
 void GameState::reshuffleDiscardPile() {
+    ++version_;
     if (callCard_ && !discardPile_.empty()) {
-        deck_.reshuffleFromDiscardPile(std::move(discardPile_), *callCard_);
+        deck_.reshuffleFromDiscardPile(discardPile_, *callCard_);
         discardPile_.clear();
     }
 }
@@ -220,59 +302,164 @@ void GameState::eliminatePlayers() {
     }
 }
 
+uint64_t GameState::getVersion() const {
+    uint64_t version = version_ + deck_.getVersion();
+    for (const auto& p : players_)
+        if (p) version += p->getVersion();
+    return version;
+}
+
 std::string GameState::toJson() const {
-    using json = nlohmann::json;
-    json j;
-    j["gameId"] = gameId_;
-    j["gameCode"] = gameCode_;
-    j["creatorPlayerId"] = creatorPlayerId_;
-    j["phase"] = static_cast<int>(phase_);
-    j["currentPlayerIndex"] = currentPlayerIndex_;
-    j["direction"] = (direction_ == PlayDirection::CLOCKWISE ? "clockwise" : "counter_clockwise");
-    j["activePickCount"] = activePickCount_;
-    if (demandedSuit_.has_value())
-        j["demandedSuit"] = core::suitToString(demandedSuit_.value());
-    j["players"] = json::array();
+    const uint64_t version = getVersion();
+    if (!jsonCache_.valid || jsonCache_.version != version) {
+        jsonCache_.text = buildJson();
+        jsonCache_.version = version;
+        jsonCache_.valid = true;
+    }
+    return jsonCache_.text;
+}
+
+std::string GameState::buildJson() const {
+    std::string out;
+    out.reserve(256 + players_.size() * 224 + deck_.size());
+    utils::JsonWriter w(out);
+    writeJson(w);
+    return out;
+}
+
+void GameState::writeJson(utils::JsonWriter& w) const {
+    writeJson(w, [](utils::JsonWriter& hw, const core::Player& p) { p.getHand().writeJson(hw); });
+}
+
+void GameState::writeJson(utils::JsonWriter& w,
+                          const std::function<void(utils::JsonWriter&, const core::Player&)>& writeHand) const {
+    // Keys in sorted order, as the nlohmann::json rendering this replaced.
+    w.beginObject();
+    w.key("activePickCount").value(activePickCount_);
+    if (callCard_) callCard_->writeJson(w.key("callCard"));
+    w.key("creatorPlayerId").value(creatorPlayerId_);
+    w.key("currentPlayerIndex").value(currentPlayerIndex_);
+    w.key("deckSize").value(deck_.size());
+    if (demandedSuit_.has_value()) w.key("demandedSuit").value(core::suitToString(*demandedSuit_));
+    w.key("direction").value(direction_ == PlayDirection::CLOCKWISE ? "clockwise" : "counter_clockwise");
+    w.key("discardPileSize").value(discardPile_.size());
+    w.key("gameCode").value(gameCode_);
+    w.key("gameId").value(gameId_);
+    w.key("phase").value(static_cast<int>(phase_));
+    w.key("players").beginArray();
     for (const auto& p : players_)
-        if (p) j["players"].push_back(json::parse(p->toJson()));
-    if (callCard_) j["callCard"] = json::parse(callCard_->toJson());
-    j["deckSize"] = deck_.size();
-    j["discardPileSize"] = discardPile_.size();
-    auto winnerId = getWinnerId();
-    if (winnerId.has_value()) j["winnerId"] = winnerId.value();
-    return j.dump();
+        if (p) p->writeJson(w, [&](utils::JsonWriter& hw) { writeHand(hw, *p); });
+    w.endArray();
+    if (auto winnerId = getWinnerId()) w.key("winnerId").value(*winnerId);
+    w.endObject();
 }
 
 std::string GameState::toJsonForPlayer(const std::string& viewerPlayerId) const {
-    using json = nlohmann::json;
-    json j;
-    j["gameId"] = gameId_;
-    j["gameCode"] = gameCode_;
-    j["creatorPlayerId"] = creatorPlayerId_;
-    j["phase"] = static_cast<int>(phase_);
-    j["currentPlayerIndex"] = currentPlayerIndex_;
-    j["direction"] = (direction_ == PlayDirection::CLOCKWISE ? "clockwise" : "counter_clockwise");
-    j["activePickCount"] = activePickCount_;
-    if (demandedSuit_.has_value())
-        j["demandedSuit"] = core::suitToString(demandedSuit_.value());
-    j["players"] = json::array();
-    for (const auto& p : players_) {
-        if (!p) continue;
-        if (p->getId() == viewerPlayerId) {
-            j["players"].push_back(json::parse(p->toJson()));
-        } else {
-            json pj = json::parse(p->toJson());
-            pj["hand"] = json::object();
-            pj["hand"]["count"] = p->getHand().size();
-            j["players"].push_back(std::move(pj));
+    return renderView(StateView::Format::JSON).forPlayer(viewerPlayerId);
+}
+
+std::string GameState::toBinaryForPlayer(const std::string& viewerPlayerId) const {
+    return renderView(StateView::Format::BINARY).forPlayer(viewerPlayerId);
+}
+
+const StateView& GameState::renderView(StateView::Format format) const {
+    CachedView& cache = viewCache_[static_cast<size_t>(format)];
+    const uint64_t version = getVersion();
+    if (!cache.valid || cache.version != version) {
+        cache.view = buildView(format);
+        cache.version = version;
+        cache.valid = true;
+    }
+    return cache.view;
+}
+
+StateView GameState::buildView(StateView::Format format) const {
+    StateView view;
+    view.format_ = format;
+    std::string& out = view.shared_;
+    view.hands_.reserve(players_.size());
+
+    if (format == StateView::Format::BINARY) {
+        out.reserve(96 + players_.size() * 48);
+        utils::ByteWriter w(out);
+        w.u8(kStateViewVersion);
+        w.str(gameId_);
+        w.str(gameCode_);
+        w.str(creatorPlayerId_);
+        w.u8(static_cast<uint8_t>(phase_));
+        w.svarint(currentPlayerIndex_);
+        w.u8(direction_ == PlayDirection::CLOCKWISE ? 0 : 1);
+        w.varint(static_cast<uint64_t>(std::max(activePickCount_, 0)));
+        w.u8(demandedSuit_ ? static_cast<uint8_t>(*demandedSuit_) : kNone);
+        w.u8(callCard_ ? callCard_->toByte() : kNone);
+        w.varint(deck_.size());
+        w.varint(discardPile_.size());
+        w.str(getWinnerId().value_or(""));
+        size_t playerCount = 0;
+        for (const auto& p : players_) playerCount += p != nullptr;
+        w.varint(playerCount);
+        for (const auto& p : players_) {
+            if (!p) continue;
+            w.str(p->getId());
+            w.str(p->getName());
+            w.u8(static_cast<uint8_t>(p->getType()));
+            w.u8(static_cast<uint8_t>(p->getStatus()));
+            w.svarint(p->getCurrentScore());
+            w.svarint(p->getCumulativeScore());
+            const size_t begin = out.size();
+            writeBinaryPlayerTail(w, *p, false);
+            view.hands_.push_back({p.get(), begin, out.size()});
         }
+        return view;
     }
-    if (callCard_) j["callCard"] = json::parse(callCard_->toJson());
-    j["deckSize"] = deck_.size();
-    j["discardPileSize"] = discardPile_.size();
-    auto winnerId = getWinnerId();
-    if (winnerId.has_value()) j["winnerId"] = winnerId.value();
-    return j.dump();
+
+    out.reserve(256 + players_.size() * 224);
+    utils::JsonWriter w(out);
+    writeJson(w, [&](utils::JsonWriter& hw, const core::Player& p) {
+        const size_t begin = out.size();
+        hw.beginObject().key("count").value(p.getHand().size()).endObject();
+        view.hands_.push_back({&p, begin, out.size()});
+    });
+    return view;
+}
+
+const StateView::HandSlot* StateView::slotOf(const std::string& viewerPlayerId) const {
+    auto slot = std::find_if(hands_.begin(), hands_.end(), [&](const HandSlot& h) {
+        return h.player->getId() == viewerPlayerId;
+    });
+    return slot != hands_.end() ? &*slot : nullptr;
+}
+
+std::string StateView::forPlayer(const std::string& viewerPlayerId) const {
+    const HandSlot* slot = slotOf(viewerPlayerId);
+    if (!slot) return shared_;
+    const core::Hand& hand = slot->player->getHand();
+    std::string out;
+    out.reserve(shared_.size() + hand.size() * (format_ == Format::JSON ? 40 : 1));
+    out.append(shared_, 0, slot->begin);
+    if (format_ == Format::JSON) {
+        utils::JsonWriter w(out);
+        hand.writeJson(w);
+    } else {
+        utils::ByteWriter w(out);
+        writeBinaryPlayerTail(w, *slot->player, true);
+    }
+    out.append(shared_, slot->end, std::string::npos);
+    return out;
+}
+
+std::optional<StateView::Seat> StateView::seatOf(const std::string& viewerPlayerId) const {
+    const HandSlot* slot = slotOf(viewerPlayerId);
+    if (!slot) return std::nullopt;
+    Seat seat{static_cast<size_t>(slot - hands_.data()), {}};
+    if (format_ == Format::JSON) {
+        utils::JsonWriter w(seat.hand);
+        slot->player->getHand().writeJson(w);
+    } else {
+        utils::ByteWriter w(seat.hand);
+        writeBinaryPlayerTail(w, *slot->player, true);
+    }
+    return seat;
 }
 
 std::unique_ptr<GameState> GameState::fromJson(const std::string& jsonStr) {
@@ -304,4 +491,110 @@ std::unique_ptr<GameState> GameState::fromJson(const std::string& jsonStr) {
     return state;
 }
 
+std::string GameState::toSnapshot() const {
+    std::string out(kSnapshotHeaderSize, '\0');
+    out.reserve(256 + (deck_.size() + discardPile_.size()) + players_.size() * 48);
+    utils::ByteWriter w(out);
+    w.str(gameId_);
+    w.str(gameCode_);
+    w.str(creatorPlayerId_);
+    writeConfig(w, config_);
+    w.varint(seed_);
+    w.u8(static_cast<uint8_t>(phase_));
+    w.svarint(currentPlayerIndex_);
+    w.u8(static_cast<uint8_t>(direction_));
+    w.svarint(activePickCount_);
+    w.u8(demandedSuit_ ? static_cast<uint8_t>(*demandedSuit_) : kNone);
+    w.u8(callCard_ ? callCard_->toByte() : kNone);
+    w.svarint(std::chrono::duration_cast<std::chrono::milliseconds>(
+                  createdAt_.time_since_epoch()).count());
+    deck_.writeSnapshot(w);
+    w.varint(discardPile_.size());
+    for (const core::Card& card : discardPile_) w.u8(card.toByte());
+    size_t playerCount = 0;
+    for (const auto& p : players_) playerCount += p != nullptr;
+    w.varint(playerCount);
+    for (const auto& p : players_) {
+        if (p) p->writeSnapshot(w);
+    }
+
+    // Header last: the checksum covers the body written above.
+    std::string header;
+    utils::ByteWriter h(header);
+    h.u8(kSnapshotMagic0);
+    h.u8(kSnapshotMagic1);
+    h.u8(kSnapshotVersion);
+    h.u64(utils::checksum64(std::string_view(out).substr(kSnapshotHeaderSize)));
+    out.replace(0, kSnapshotHeaderSize, header);
+    return out;
+}
+
+std::unique_ptr<GameState> GameState::fromSnapshot(std::string_view bytes) {
+    utils::ByteReader header(bytes);
+    if (header.u8() != kSnapshotMagic0 || header.u8() != kSnapshotMagic1 ||
+        header.u8() != kSnapshotVersion)
+        return nullptr;
+    const uint64_t checksum = header.u64();
+    const std::string_view body = header.rest();
+    if (!header.ok() || checksum != utils::checksum64(body)) return nullptr;
+
+    utils::ByteReader r(body);
+
+    std::string gameId(r.str());
+    std::string gameCode(r.str());
+    std::string creatorPlayerId(r.str());
+    auto state = std::make_unique<GameState>(readConfig(r));
+    state->gameId_ = std::move(gameId);
+    state->gameCode_ = std::move(gameCode);
+    state->creatorPlayerId_ = std::move(creatorPlayerId);
+    state->seed_ = r.varint();
+    const uint8_t phase = r.u8();
+    state->currentPlayerIndex_ = static_cast<int>(r.svarint());
+    const uint8_t direction = r.u8();
+    state->activePickCount_ = static_cast<int>(r.svarint());
+    const uint8_t demandedSuit = r.u8();
+    const uint8_t callCard = r.u8();
+    state->createdAt_ = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::milliseconds(r.svarint())));
+    if (!r.ok() || phase > static_cast<uint8_t>(GamePhase::GAME_ENDED) ||
+        direction > static_cast<uint8_t>(PlayDirection::COUNTER_CLOCKWISE))
+        return nullptr;
+    state->phase_ = static_cast<GamePhase>(phase);
+    state->direction_ = static_cast<PlayDirection>(direction);
+    if (demandedSuit != kNone) {
+        if (demandedSuit >= core::SUIT_COUNT) return nullptr;
+        state->demandedSuit_ = static_cast<core::Suit>(demandedSuit);
+    }
+    if (callCard != kNone) {
+        state->callCard_ = core::Card::fromByte(callCard);
+        if (!state->callCard_) return nullptr;
+    }
+
+    auto deck = core::Deck::readSnapshot(r);
+    if (!deck) return nullptr;
+    state->deck_ = std::move(*deck);
+    const uint64_t discardCount = r.varint();
+    if (!r.ok() || discardCount > r.remaining()) return nullptr;
+    state->discardPile_.reserve(discardCount);
+    for (uint64_t i = 0; i < discardCount; ++i) {
+        auto card = core::Card::fromByte(r.u8());
+        if (!card) return nullptr;
+        state->discardPile_.push_back(*card);
+    }
+    const uint64_t playerCount = r.varint();
+    if (!r.ok() || playerCount > r.remaining()) return nullptr;
+    for (uint64_t i = 0; i < playerCount; ++i) {
+        auto p = core::Player::readSnapshot(r);
+        if (!p) return nullptr;
+        state->players_.push_back(std::move(p));
+    }
+    if (!r.ok() || !r.atEnd()) return nullptr;
+    if (state->currentPlayerIndex_ < 0 ||
+        (!state->players_.empty() &&
+         static_cast<size_t>(state->currentPlayerIndex_) >= state->players_.size()))
+        return nullptr;
+    return state;
+}
+
 } // namespace whot::game
@@ -10,32 +10,25 @@ const rules::NigerianRules& RuleEngine::getRules() const { return *rules_; }
 
 bool RuleEngine::hasPlayableCard(const GameState& state,
                                  const core::Player& player) const {
-    const core::Card* call = state.getCallCard();
+    std::optional<core::Card> call = state.getCallCard();
     if (!call) return false;
-    std::optional<core::Suit> demanded = state.getDemandedSuit();
-    for (size_t i = 0; i < player.getHand().size(); ++i) {
-        const core::Card& c = player.getHand().getCard(i);
-        if (rules_->canPlayCard(c, *call, player, demanded)) return true;
-    }
-    return false;
+    const core::CardMask playable =
+        rules_->playableMask(*call, state.getDemandedSuit());
+    return (player.getHand().getCardMask() & playable).any();
 }
 
 bool RuleEngine::hasDefenseCard(const GameState& state,
                                 const core::Player& player) const {
     if (state.getActivePickCount() <= 0) return false;
-    const core::Card* call = state.getCallCard();
+    std::optional<core::Card> call = state.getCallCard();
     if (!call) return false;
-    for (size_t i = 0; i < player.getHand().size(); ++i) {
-        const core::Card& c = player.getHand().getCard(i);
-        if (rules_->canDefendAgainstAttack(*call, c)) return true;
-    }
-    return false;
+    return (player.getHand().getCardMask() & rules_->defenseMask(*call)).any();
 }
 
 bool RuleEngine::canPlayCard(const GameState& state,
                              const core::Player& player,
                              const core::Card& card) const {
-    const core::Card* call = state.getCallCard();
+    std::optional<core::Card> call = state.getCallCard();
     if (!call) return false;
     return rules_->canPlayCard(card, *call, player, state.getDemandedSuit());
 }
@@ -64,9 +57,9 @@ bool RuleEngine::canDefendAgainstPick(const GameState& state,
 
 bool RuleEngine::canDoubleDesk(const GameState& state,
                               const core::Player& player,
-                              const std::vector<const core::Card*>& cards) const {
+                              const std::vector<core::Card>& cards) const {
     (void)player;
-    const core::Card* call = state.getCallCard();
+    std::optional<core::Card> call = state.getCallCard();
     if (!call) return false;
     return rules_->validateDoubleDecking(cards, *call);
 }
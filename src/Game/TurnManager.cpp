@@ -38,23 +38,27 @@ bool TurnManager::isPlayerTurn(const std::string& playerId) const {
 }
 
 void TurnManager::recordAction(const TurnAction& action) {
-    actionHistory_.push(action);
-    while (actionHistory_.size() > 100) actionHistory_.pop();
+    if (actionHistory_.size() < kHistoryCapacity) {
+        actionHistory_.push_back(action);
+        return;
+    }
+    actionHistory_[historyStart_] = action;
+    historyStart_ = (historyStart_ + 1) % kHistoryCapacity;
 }
 
 std::vector<TurnAction> TurnManager::getTurnHistory(int count) const {
+    const size_t size = actionHistory_.size();
+    const size_t n = std::min(size, static_cast<size_t>(std::max(count, 0)));
     std::vector<TurnAction> out;
-    std::queue<TurnAction> q = actionHistory_;
-    while (!q.empty() && out.size() < static_cast<size_t>(count)) {
-        out.push_back(q.front());
-        q.pop();
-    }
+    out.reserve(n);
+    for (size_t i = size - n; i < size; ++i)
+        out.push_back(actionHistory_[(historyStart_ + i) % size]);
     return out;
 }
 
 const TurnAction* TurnManager::getLastAction() const {
     if (actionHistory_.empty()) return nullptr;
-    return &actionHistory_.back();
+    return &actionHistory_[(historyStart_ + actionHistory_.size() - 1) % actionHistory_.size()];
 }
 
 void TurnManager::enableMultipleActions() { allowMultipleActions_ = true; }
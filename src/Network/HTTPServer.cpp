@@ -1,10 +1,17 @@
 #include "../../include/Network/HTTPServer.hpp"
+#include "Utils/Compression.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <string_view>
 #include <thread>
-#include <sstream>
-#include <fstream>
 #include <cstring>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -30,31 +37,159 @@ HttpResponse HttpResponse::json(int statusCode, const std::string& jsonBody) {
     HttpResponse r; r.statusCode = statusCode; r.body = jsonBody; r.headers["Content-Type"] = "application/json"; return r;
 }
 
-static HttpMethod parseMethod(const std::string& s) {
-    if (s == "GET") return HttpMethod::GET;
-    if (s == "POST") return HttpMethod::POST;
-    if (s == "PUT") return HttpMethod::PUT;
-    if (s == "DELETE") return HttpMethod::DELETE;
-    if (s == "OPTIONS") return HttpMethod::OPTIONS;
-    return HttpMethod::GET;
-}
-
 static std::string statusLine(int code) {
     if (code == 200) return "200 OK";
     if (code == 201) return "201 Created";
     if (code == 204) return "204 No Content";
+    if (code == 304) return "304 Not Modified";
     if (code == 400) return "400 Bad Request";
     if (code == 404) return "404 Not Found";
+    if (code == 405) return "405 Method Not Allowed";
     if (code == 500) return "500 Internal Server Error";
+    if (code == 503) return "503 Service Unavailable";
     return "200 OK";
 }
 
+namespace {
+constexpr size_t kMaxHeaderBytes = 16 * 1024;
+constexpr int kMaxEpollEvents = 256;
+constexpr size_t kDefaultMaxConnections = 4096;
+// Longer than nginx's default upstream keepalive_timeout (60s), so the proxy
+// retires pooled connections before we close them under it.
+constexpr std::chrono::milliseconds kDefaultIdleTimeout{65000};
+constexpr size_t kDefaultMaxRequestsPerConnection = 1000;
+constexpr std::chrono::milliseconds kIdleSweepInterval{1000};
+
+constexpr size_t kDefaultCompressionMinBytes = 1024;
+constexpr int kDefaultCompressionLevel = 6;
+
+const char kCorsHeaders[] =
+    "Access-Control-Allow-Origin: *\r\n"
+    "Access-Control-Allow-Methods: GET, POST, PUT, DELETE, OPTIONS\r\n"
+    "Access-Control-Allow-Headers: Content-Type\r\n";
+
+const char kBusyResponse[] =
+    "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+/// If-None-Match uses weak comparison: "W/" prefixes are ignored.
+bool etagListMatches(std::string_view ifNoneMatch, std::string_view etag) {
+    while (!ifNoneMatch.empty()) {
+        const size_t comma = ifNoneMatch.find(',');
+        std::string_view tag = ifNoneMatch.substr(0, comma);
+        while (!tag.empty() && tag.front() == ' ') tag.remove_prefix(1);
+        while (!tag.empty() && tag.back() == ' ') tag.remove_suffix(1);
+        if (tag == "*") return true;
+        if (tag.substr(0, 2) == "W/") tag.remove_prefix(2);
+        if (tag == etag) return true;
+        if (comma == std::string_view::npos) break;
+        ifNoneMatch.remove_prefix(comma + 1);
+    }
+    return false;
+}
+
+bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+std::string renderResponse(const HttpResponse& resp, bool keepAlive,
+                           std::chrono::milliseconds idleTimeout, bool cors) {
+    std::string out;
+    out.reserve(256 + resp.body.size());
+    out += "HTTP/1.1 ";
+    out += statusLine(resp.statusCode);
+    out += "\r\n";
+    for (const auto& [k, v] : resp.headers) {
+        out += k;
+        out += ": ";
+        out += v;
+        out += "\r\n";
+    }
+    if (cors && resp.headers.find("Access-Control-Allow-Origin") == resp.headers.end())
+        out += kCorsHeaders;
+    // 204 and 304 carry no body, and a 304's length would describe the
+    // cached representation rather than this message.
+    if (resp.statusCode != 204 && resp.statusCode != 304 &&
+        resp.headers.find("Content-Length") == resp.headers.end()) {
+        out += "Content-Length: ";
+        out += std::to_string(resp.body.size());
+        out += "\r\n";
+    }
+    if (keepAlive) {
+        out += "Connection: keep-alive\r\nKeep-Alive: timeout=";
+        out += std::to_string(std::chrono::duration_cast<std::chrono::seconds>(idleTimeout).count());
+        out += "\r\n\r\n";
+    } else {
+        out += "Connection: close\r\n\r\n";
+    }
+    out += resp.body;
+    return out;
+}
+
+/// Value for a 405's Allow header from Router::Match::allowedMethods.
+std::string allowHeader(unsigned allowedMethods) {
+    static constexpr const char* kNames[] = {"GET", "POST", "PUT", "DELETE", "OPTIONS"};
+    std::string allow;
+    for (size_t m = 0; m < std::size(kNames); ++m) {
+        if (!(allowedMethods & (1u << m))) continue;
+        if (!allow.empty()) allow += ", ";
+        allow += kNames[m];
+    }
+    return allow;
+}
+
+/// Types worth deflating; a missing Content-Type is treated as text.
+bool isCompressibleType(const HttpResponse& resp) {
+    auto it = resp.headers.find("Content-Type");
+    if (it == resp.headers.end()) return true;
+    const std::string& type = it->second;
+    return type.rfind("text/", 0) == 0 || type.rfind("application/json", 0) == 0 ||
+           type.rfind("application/javascript", 0) == 0 || type.rfind("image/svg+xml", 0) == 0;
+}
+}  // namespace
+
+struct HttpServer::Connection {
+    enum class State { READING, HANDLING, WRITING };
+
+    Connection(int socketFd, size_t maxBodyBytes)
+        : fd(socketFd), lastActivity(std::chrono::steady_clock::now()),
+          parser(kMaxHeaderBytes, maxBodyBytes) {}
+
+    int fd;
+    State state = State::READING;
+    bool closed = false;
+    bool peerClosed = false;
+    bool keepAlive = false;  // of the response in flight
+    size_t requestCount = 0;
+    std::chrono::steady_clock::time_point lastActivity;
+    std::string in;  // unparsed bytes; may hold several pipelined requests
+    HttpRequestParser parser;  // reactor only, while READING
+    // The request in flight: its bytes and the views into them. Owned by the
+    // handler while HANDLING; both keep their capacity across requests.
+    std::string current;
+    HttpRequest request;
+    std::string out;
+    size_t outPos = 0;
+};
+
 HttpServer::HttpServer(uint16_t port)
     : port_(port)
     , running_(false)
     , maxBodySize_(1024 * 1024)
+    , workerThreads_(0)
+    , maxConnections_(kDefaultMaxConnections)
+    , idleTimeout_(kDefaultIdleTimeout)
+    , maxRequestsPerConnection_(kDefaultMaxRequestsPerConnection)
+    , corsEnabled_(false)
+    , compressionEnabled_(false)
+    , compressionMinBytes_(kDefaultCompressionMinBytes)
+    , compressionLevel_(kDefaultCompressionLevel)
     , listenFd_(-1)
+    , epollFd_(-1)
+    , wakeFd_(-1)
+    , spareFd_(-1)
     , serverThread_()
+    , connectionCount_(0)
 {}
 
 HttpServer::~HttpServer() { stop(); }
@@ -69,92 +204,324 @@ void HttpServer::start() {
     addr.sin_family = AF_INET;
     addr.sin_addr.s_addr = INADDR_ANY;
     addr.sin_port = htons(port_);
-    if (bind(listenFd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+    if (bind(listenFd_, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        listen(listenFd_, SOMAXCONN) < 0 || !setNonBlocking(listenFd_)) {
         close(listenFd_); listenFd_ = -1; return;
     }
-    if (listen(listenFd_, 64) < 0) {
-        close(listenFd_); listenFd_ = -1; return;
+    socklen_t addrLen = sizeof(addr);
+    if (getsockname(listenFd_, reinterpret_cast<struct sockaddr*>(&addr), &addrLen) == 0)
+        port_ = ntohs(addr.sin_port);
+
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    spareFd_ = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    acceptStalled_ = false;
+    if (epollFd_ < 0 || wakeFd_ < 0) {
+        closeAll();
+        return;
     }
+    struct epoll_event ev {};
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.fd = listenFd_;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, listenFd_, &ev);
+    ev.data.fd = wakeFd_;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeFd_, &ev);
+
+    if (staticAssets_) staticAssets_->load();
+    workers_ = std::make_unique<utils::WorkerPool>(workerThreads_);
+    workers_->start();
     running_ = true;
-    serverThread_ = std::thread([this]() {
-        while (running_ && listenFd_ >= 0) {
-            struct sockaddr_in clientAddr {};
-            socklen_t len = sizeof(clientAddr);
-            int fd = accept(listenFd_, reinterpret_cast<struct sockaddr*>(&clientAddr), &len);
-            if (fd < 0) continue;
-            std::thread([this, fd]() {
-                char buf[8192];
-                ssize_t n = recv(fd, buf, sizeof(buf) - 1, 0);
-                if (n > 0) {
-                    buf[n] = '\0';
-                    std::istringstream iss(buf);
-                    std::string methodStr, path, proto;
-                    iss >> methodStr >> path >> proto;
-                    HttpRequest req;
-                    req.method = parseMethod(methodStr);
-                    size_t q = path.find('?');
-                    if (q != std::string::npos) {
-                        req.path = path.substr(0, q);
-                        std::string qs = path.substr(q + 1);
-                        for (size_t i = 0; i < qs.size(); ) {
-                            size_t amp = qs.find('&', i);
-                            std::string pair = (amp == std::string::npos) ? qs.substr(i) : qs.substr(i, amp - i);
-                            size_t eq = pair.find('=');
-                            if (eq != std::string::npos)
-                                req.queryParams[pair.substr(0, eq)] = pair.substr(eq + 1);
-                            i = (amp == std::string::npos) ? qs.size() : amp + 1;
-                        }
-                    } else req.path = path;
-                    std::string line;
-                    while (std::getline(iss, line) && line != "\r" && line != "") {
-                        size_t colon = line.find(':');
-                        if (colon != std::string::npos)
-                            req.headers[line.substr(0, colon)] = line.substr(colon + 1);
-                    }
-                    const char* bodyStart = std::strstr(buf, "\r\n\r\n");
-                    if (bodyStart && bodyStart + 4 <= buf + n)
-                        req.body.assign(bodyStart + 4, static_cast<size_t>((buf + n) - (bodyStart + 4)));
-                    HttpResponse resp;
-                    if (req.body.size() > maxBodySize_) {
-                        resp = HttpResponse::badRequest("Request body too large");
-                    } else {
-                        resp = handleRequest(req);
-                    }
-                    resp.headers["Access-Control-Allow-Origin"] = "*";
-                    resp.headers["Access-Control-Allow-Methods"] = "GET, POST, PUT, DELETE, OPTIONS";
-                    resp.headers["Access-Control-Allow-Headers"] = "Content-Type";
-                    std::ostringstream oss;
-                    oss << "HTTP/1.1 " << statusLine(resp.statusCode) << "\r\n";
-                    for (const auto& [k, v] : resp.headers) oss << k << ": " << v << "\r\n";
-                    if (resp.headers.find("Content-Length") == resp.headers.end())
-                        oss << "Content-Length: " << resp.body.size() << "\r\n";
-                    oss << "Connection: close\r\n\r\n" << resp.body;
-                    std::string out = oss.str();
-                    send(fd, out.data(), out.size(), 0);
-                }
-                close(fd);
-            }).detach();
-        }
-    });
+    serverThread_ = std::thread([this]() { reactorLoop(); });
 }
 
 void HttpServer::stop() {
-    running_ = false;
-    if (listenFd_ >= 0) {
-        close(listenFd_);
-        listenFd_ = -1;
-    }
+    if (!running_.exchange(false)) return;
+    uint64_t one = 1;
+    if (write(wakeFd_, &one, sizeof(one)) < 0) { /* reactor also polls running_ */ }
     if (serverThread_.joinable()) serverThread_.join();
+    workers_->stop();
+    closeAll();
 }
 
 bool HttpServer::isRunning() const { return running_; }
 
-void HttpServer::addRoute(HttpMethod method, const std::string& path, RouteHandler handler) {
-    routes_[path][method] = std::move(handler);
+uint16_t HttpServer::getPort() const { return port_; }
+
+void HttpServer::setWorkerThreads(size_t count) { workerThreads_ = count; }
+
+void HttpServer::setMaxConnections(size_t count) { maxConnections_ = count > 0 ? count : 1; }
+
+size_t HttpServer::getConnectionCount() const { return connectionCount_; }
+
+void HttpServer::setIdleTimeout(std::chrono::milliseconds timeout) { idleTimeout_ = timeout; }
+
+void HttpServer::setMaxRequestsPerConnection(size_t count) {
+    maxRequestsPerConnection_ = count > 0 ? count : 1;
+}
+
+void HttpServer::reactorLoop() {
+    struct epoll_event events[kMaxEpollEvents];
+    const auto sweepInterval = std::max(std::chrono::milliseconds(1),
+                                        std::min(kIdleSweepInterval, idleTimeout_));
+    auto nextSweep = std::chrono::steady_clock::now() + sweepInterval;
+    while (running_) {
+        int n = epoll_wait(epollFd_, events, kMaxEpollEvents,
+                           static_cast<int>(sweepInterval.count()));
+        for (int i = 0; i < n && running_; ++i) {
+            const int fd = events[i].data.fd;
+            const uint32_t ev = events[i].events;
+            if (fd == listenFd_) {
+                acceptConnections();
+                continue;
+            }
+            if (fd == wakeFd_) {
+                uint64_t count;
+                while (read(wakeFd_, &count, sizeof(count)) > 0) {}
+                drainCompleted();
+                continue;
+            }
+            auto it = connections_.find(fd);
+            if (it == connections_.end()) continue;
+            ConnectionPtr conn = it->second;
+            if (ev & (EPOLLERR | EPOLLHUP)) {
+                closeConnection(conn);
+                continue;
+            }
+            if (ev & (EPOLLIN | EPOLLRDHUP)) readFrom(conn);
+            if (!conn->closed && (ev & EPOLLOUT) && conn->state == Connection::State::WRITING)
+                flush(conn);
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= nextSweep) {
+            closeIdleConnections(now);
+            nextSweep = now + sweepInterval;
+        }
+    }
+}
+
+void HttpServer::closeIdleConnections(std::chrono::steady_clock::time_point now) {
+    std::vector<ConnectionPtr> idle;
+    for (const auto& [fd, conn] : connections_) {
+        // Only waiting-for-request connections time out; a slow handler does not.
+        if (conn->state == Connection::State::READING && now - conn->lastActivity >= idleTimeout_)
+            idle.push_back(conn);
+    }
+    for (const ConnectionPtr& conn : idle) closeConnection(conn);
+}
+
+void HttpServer::acceptConnections() {
+    for (;;) {
+        int fd = accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno == EMFILE || errno == ENFILE) {
+                // The connection stays queued, and the edge-triggered
+                // listener will not report it again: shed it, or re-arm
+                // once a connection closes and frees a descriptor.
+                if (shedConnection()) continue;
+                acceptStalled_ = true;
+            }
+            return;  // EAGAIN: backlog drained (edge-triggered)
+        }
+        if (connectionCount_ >= maxConnections_) {
+            if (send(fd, kBusyResponse, sizeof(kBusyResponse) - 1, MSG_NOSIGNAL) < 0) {}
+            close(fd);
+            continue;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        struct epoll_event ev {};
+        ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        ev.data.fd = fd;
+        if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            continue;
+        }
+        connections_[fd] = std::make_shared<Connection>(fd, maxBodySize_);
+        ++connectionCount_;
+    }
+}
+
+bool HttpServer::shedConnection() {
+    if (spareFd_ < 0) return false;
+    close(spareFd_);
+    const int fd = accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd >= 0) {
+        if (send(fd, kBusyResponse, sizeof(kBusyResponse) - 1, MSG_NOSIGNAL) < 0) {}
+        close(fd);
+    }
+    spareFd_ = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    return fd >= 0 && spareFd_ >= 0;
+}
+
+void HttpServer::readFrom(const ConnectionPtr& conn) {
+    char buf[8192];
+    for (;;) {
+        ssize_t n = recv(conn->fd, buf, sizeof(buf), 0);
+        if (n > 0) {
+            conn->in.append(buf, static_cast<size_t>(n));
+            continue;
+        }
+        if (n == 0) {
+            conn->peerClosed = true;
+            break;
+        }
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            closeConnection(conn);
+            return;
+        }
+        break;
+    }
+    conn->lastActivity = std::chrono::steady_clock::now();
+    // Pipelined requests queue up in conn->in while one is in flight, bounded
+    // by one maximal request beyond the one being handled.
+    if (conn->in.size() > 2 * (kMaxHeaderBytes + maxBodySize_)) {
+        closeConnection(conn);
+        return;
+    }
+    if (conn->state == Connection::State::READING) dispatchRequest(conn);
+    // A half-closed peer still gets responses to requests already read.
+    if (!conn->closed && conn->peerClosed && conn->state == Connection::State::READING)
+        closeConnection(conn);
 }
 
-void HttpServer::addPatternRoute(HttpMethod method, const std::string& pattern, RouteHandler handler) {
-    patternRoutes_.emplace_back(pattern, method, std::move(handler));
+void HttpServer::dispatchRequest(const ConnectionPtr& conn) {
+    const HttpRequestParser::Status status = conn->parser.parse(conn->in);
+    if (status == HttpRequestParser::Status::INCOMPLETE) return;
+    if (status == HttpRequestParser::Status::ERROR) {
+        rejectRequest(conn, HttpResponse::badRequest(conn->parser.error()));
+        return;
+    }
+
+    conn->state = Connection::State::HANDLING;
+    conn->keepAlive = conn->parser.keepAlive() && ++conn->requestCount < maxRequestsPerConnection_;
+    // Hand the request's bytes to the handler; anything after them is the
+    // next pipelined request and stays in conn->in.
+    const size_t size = conn->parser.requestSize();
+    conn->current.clear();
+    if (conn->in.size() == size) {
+        conn->current.swap(conn->in);
+    } else {
+        conn->current.append(conn->in, 0, size);
+        conn->in.erase(0, size);
+    }
+    conn->parser.build(conn->current, conn->request);
+    conn->parser.reset();
+    workers_->submit([this, conn] {
+        HttpResponse resp;
+        try {
+            resp = handleRequest(conn->request);
+        } catch (const std::exception& e) {
+            resp = HttpResponse::serverError(e.what());
+        }
+        finishRequest(conn, resp);
+    });
+}
+
+void HttpServer::finishRequest(const ConnectionPtr& conn, const HttpResponse& response) {
+    conn->out = renderResponse(response, conn->keepAlive, idleTimeout_, corsEnabled_);
+    {
+        std::lock_guard<std::mutex> lock(completedMutex_);
+        completed_.push_back(conn);
+    }
+    uint64_t one = 1;
+    if (write(wakeFd_, &one, sizeof(one)) < 0) { /* counter saturated: reactor is already due to wake */ }
+}
+
+void HttpServer::rejectRequest(const ConnectionPtr& conn, const HttpResponse& response) {
+    conn->keepAlive = false;
+    conn->out = renderResponse(response, false, idleTimeout_, corsEnabled_);
+    conn->state = Connection::State::WRITING;
+    flush(conn);
+}
+
+void HttpServer::drainCompleted() {
+    std::vector<ConnectionPtr> ready;
+    {
+        std::lock_guard<std::mutex> lock(completedMutex_);
+        ready.swap(completed_);
+    }
+    for (const ConnectionPtr& conn : ready) {
+        if (conn->closed) continue;  // peer went away while the handler ran
+        conn->state = Connection::State::WRITING;
+        flush(conn);
+    }
+}
+
+void HttpServer::flush(const ConnectionPtr& conn) {
+    while (conn->outPos < conn->out.size()) {
+        ssize_t n = send(conn->fd, conn->out.data() + conn->outPos,
+                         conn->out.size() - conn->outPos, MSG_NOSIGNAL);
+        if (n > 0) {
+            conn->outPos += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;  // resume on EPOLLOUT
+        closeConnection(conn);
+        return;
+    }
+    if (!conn->keepAlive) {
+        closeConnection(conn);
+        return;
+    }
+    conn->out.clear();
+    conn->outPos = 0;
+    conn->state = Connection::State::READING;
+    conn->lastActivity = std::chrono::steady_clock::now();
+    dispatchRequest(conn);  // next pipelined request, if already buffered
+    if (!conn->closed && conn->peerClosed && conn->state == Connection::State::READING)
+        closeConnection(conn);
+}
+
+void HttpServer::closeConnection(const ConnectionPtr& conn) {
+    if (conn->closed) return;
+    conn->closed = true;
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, conn->fd, nullptr);
+    close(conn->fd);
+    connections_.erase(conn->fd);
+    --connectionCount_;
+    if (acceptStalled_) {
+        acceptStalled_ = false;
+        if (spareFd_ < 0) spareFd_ = open("/dev/null", O_RDONLY | O_CLOEXEC);
+        // MOD re-evaluates readiness, so a still-queued connection is
+        // reported again.
+        struct epoll_event ev {};
+        ev.events = EPOLLIN | EPOLLET;
+        ev.data.fd = listenFd_;
+        epoll_ctl(epollFd_, EPOLL_CTL_MOD, listenFd_, &ev);
+    }
+}
+
+void HttpServer::closeAll() {
+    for (auto& [fd, conn] : connections_) {
+        conn->closed = true;
+        close(fd);
+    }
+    connections_.clear();
+    connectionCount_ = 0;
+    {
+        std::lock_guard<std::mutex> lock(completedMutex_);
+        completed_.clear();
+    }
+    for (int* fd : {&listenFd_, &epollFd_, &wakeFd_, &spareFd_}) {
+        if (*fd >= 0) close(*fd);
+        *fd = -1;
+    }
+}
+
+void HttpServer::addRoute(HttpMethod method, const std::string& path, RouteHandler handler,
+                          RouteOptions options) {
+    // A replaced route's entry stays in the table unreferenced; registration
+    // happens once at startup.
+    router_.add(method, path, static_cast<Router::RouteId>(routeTable_.size()));
+    routeTable_.push_back(Route{std::move(handler), options});
+}
+
+void HttpServer::addPatternRoute(HttpMethod method, const std::string& pattern, RouteHandler handler,
+                                 RouteOptions options) {
+    addRoute(method, pattern, std::move(handler), options);
 }
 
 void HttpServer::addStaticDirectory(const std::string& urlPath, const std::string& fsPath) {
@@ -162,11 +529,16 @@ void HttpServer::addStaticDirectory(const std::string& urlPath, const std::strin
 }
 
 void HttpServer::setStaticRoot(const std::string& fsPath) {
-    staticRoot_ = fsPath;
+    staticAssets_ = std::make_unique<StaticAssetCache>(fsPath);
 }
 
-void HttpServer::addCorsHeaders() {}
-void HttpServer::enableCompression() {}
+void HttpServer::addCorsHeaders() { corsEnabled_ = true; }
+
+void HttpServer::enableCompression(size_t minBytes, int level) {
+    compressionEnabled_ = true;
+    compressionMinBytes_ = minBytes;
+    compressionLevel_ = level;
+}
 void HttpServer::setMaxBodySize(size_t bytes) { maxBodySize_ = bytes; }
 
 void HttpServer::setupGameApi() {
@@ -181,88 +553,87 @@ void HttpServer::setupGameApi() {
     });
 }
 
-HttpResponse HttpServer::handleRequest(const HttpRequest& request) {
+HttpResponse HttpServer::handleRequest(HttpRequest& request) {
     if (request.method == HttpMethod::OPTIONS) {
         HttpResponse preflight;
         preflight.statusCode = 204;
-        preflight.headers["Access-Control-Allow-Origin"] = "*";
-        preflight.headers["Access-Control-Allow-Methods"] = "GET, POST, PUT, DELETE, OPTIONS";
-        preflight.headers["Access-Control-Allow-Headers"] = "Content-Type";
-        preflight.headers["Access-Control-Max-Age"] = "86400";
+        if (corsEnabled_) preflight.headers["Access-Control-Max-Age"] = "86400";
         return preflight;
     }
-    auto it = routes_.find(request.path);
-    if (it != routes_.end()) {
-        auto jt = it->second.find(request.method);
-        if (jt != it->second.end())
-            return jt->second(request);
+    const Router::Match match = router_.find(request.method, request.path, request.pathParams);
+    if (match.route != Router::kNoRoute)
+        return runRoute(routeTable_[match.route], request);
+    if (request.method == HttpMethod::GET && staticAssets_)
+        return serveStaticFile(request);
+    if (match.allowedMethods != 0) {
+        HttpResponse r = HttpResponse::json(405, "{\"error\":\"Method Not Allowed\"}");
+        r.headers["Allow"] = allowHeader(match.allowedMethods);
+        return r;
     }
-    for (const auto& [pattern, method, handler] : patternRoutes_) {
-        if (method != request.method) continue;
-        std::map<std::string, std::string> params;
-        if (matchRoute(pattern, request.path, params)) {
-            HttpRequest req = request;
-            req.pathParams = std::move(params);
-            return handler(req);
-        }
+    return HttpResponse::notFound("Not Found: " + std::string(request.path));
+}
+
+HttpResponse HttpServer::runRoute(const Route& route, const HttpRequest& request) const {
+    HttpResponse response = route.handler(request);
+    if (compressionEnabled_ && route.options.compress) compressResponse(request, response);
+    return response;
+}
+
+void HttpServer::compressResponse(const HttpRequest& request, HttpResponse& response) const {
+    if (response.body.size() < compressionMinBytes_ || response.statusCode == 204 ||
+        response.statusCode == 304 || response.headers.count("Content-Encoding") ||
+        !isCompressibleType(response)) {
+        return;
     }
-    if (request.method == HttpMethod::GET && !staticRoot_.empty())
-        return serveStaticFile(request.path);
-    return HttpResponse::notFound("Not Found: " + request.path);
-}
-
-HttpResponse HttpServer::serveStaticFile(const std::string& urlPath) {
-    std::string path = urlPath;
-    if (path.empty() || path == "/") path = "/index.html";
-    if (path.front() == '/') path = path.substr(1);
-    std::string fullPath = staticRoot_;
-    if (fullPath.empty() || fullPath.back() != '/') fullPath += '/';
-    fullPath += path;
-    std::ifstream f(fullPath, std::ios::binary);
-    if (!f) return HttpResponse::notFound("");
-    std::string body((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
-    f.close();
-    HttpResponse r;
-    r.statusCode = 200;
-    r.body = std::move(body);
-    size_t dot = urlPath.rfind('.');
-    if (dot != std::string::npos) {
-        std::string ext = urlPath.substr(dot + 1);
-        if (ext == "html") r.headers["Content-Type"] = "text/html; charset=utf-8";
-        else if (ext == "css") r.headers["Content-Type"] = "text/css; charset=utf-8";
-        else if (ext == "js") r.headers["Content-Type"] = "application/javascript; charset=utf-8";
-        else if (ext == "json") r.headers["Content-Type"] = "application/json";
-        else if (ext == "png") r.headers["Content-Type"] = "image/png";
-        else if (ext == "svg") r.headers["Content-Type"] = "image/svg+xml";
-        else if (ext == "ico") r.headers["Content-Type"] = "image/x-icon";
+    response.headers["Vary"] = "Accept-Encoding";
+    auto acceptEncoding = request.headers.find("accept-encoding");
+    if (acceptEncoding == request.headers.end()) return;
+    utils::Compression::Format format;
+    if (acceptsEncoding(acceptEncoding->second, "gzip")) {
+        format = utils::Compression::Format::GZIP;
+        response.headers["Content-Encoding"] = "gzip";
+    } else if (acceptsEncoding(acceptEncoding->second, "deflate")) {
+        format = utils::Compression::Format::ZLIB;
+        response.headers["Content-Encoding"] = "deflate";
     } else {
-        r.headers["Content-Type"] = "text/html; charset=utf-8";
+        return;
     }
-    return r;
+    response.body = utils::Compression::compress(response.body, format, compressionLevel_);
 }
 
-bool HttpServer::matchRoute(const std::string& pattern, const std::string& path,
-                            std::map<std::string, std::string>& params) {
-    params.clear();
-    size_t pi = 0, qi = 0;
-    while (pi < pattern.size() && qi < path.size()) {
-        if (pattern[pi] == ':') {
-            size_t nameStart = pi + 1;
-            size_t nameEnd = pattern.find('/', nameStart);
-            if (nameEnd == std::string::npos) nameEnd = pattern.size();
-            std::string name = pattern.substr(nameStart, nameEnd - nameStart);
-            size_t valueEnd = path.find('/', qi);
-            if (valueEnd == std::string::npos) valueEnd = path.size();
-            params[name] = path.substr(qi, valueEnd - qi);
-            pi = nameEnd;
-            qi = valueEnd;
-            continue;
-        }
-        if (pattern[pi] != path[qi]) return false;
-        ++pi; ++qi;
+HttpResponse HttpServer::serveStaticFile(const HttpRequest& request) {
+    StaticAssetCache::AssetPtr asset = staticAssets_->lookup(request.path);
+    if (!asset) return HttpResponse::notFound("");
+    HttpResponse r;
+    r.headers["Cache-Control"] = asset->cacheControl;
+    if (!asset->gzipBody.empty() || !asset->brotliBody.empty()) r.headers["Vary"] = "Accept-Encoding";
+
+    auto acceptEncoding = request.headers.find("accept-encoding");
+    const std::string_view accepted =
+        acceptEncoding != request.headers.end() ? acceptEncoding->second : std::string_view();
+    const std::string* body = &asset->body;
+    std::string etag = asset->etag;
+    if (!asset->brotliBody.empty() && acceptsEncoding(accepted, "br")) {
+        body = &asset->brotliBody;
+        r.headers["Content-Encoding"] = "br";
+        etag.insert(etag.size() - 1, "-br");
+    } else if (!asset->gzipBody.empty() && acceptsEncoding(accepted, "gzip")) {
+        body = &asset->gzipBody;
+        r.headers["Content-Encoding"] = "gzip";
+        etag.insert(etag.size() - 1, "-gz");
     }
-    if (pi != pattern.size() || qi != path.size()) return false;
-    return true;
+    r.headers["ETag"] = etag;
+
+    auto ifNoneMatch = request.headers.find("if-none-match");
+    if (ifNoneMatch != request.headers.end() && etagListMatches(ifNoneMatch->second, etag)) {
+        r.statusCode = 304;
+        r.headers.erase("Content-Encoding");
+        return r;
+    }
+    r.statusCode = 200;
+    r.headers["Content-Type"] = asset->contentType;
+    r.body = *body;
+    return r;
 }
 
 } // namespace whot::network
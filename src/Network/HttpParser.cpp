@@ -0,0 +1,215 @@
+#include "../../include/Network/HttpParser.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <limits>
+
+namespace whot::network {
+
+namespace {
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+               return std::tolower(static_cast<unsigned char>(x)) ==
+                      std::tolower(static_cast<unsigned char>(y));
+           });
+}
+
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) s.remove_suffix(1);
+    return s;
+}
+
+bool parseMethod(std::string_view s, HttpMethod& method) {
+    if (s == "GET") method = HttpMethod::GET;
+    else if (s == "POST") method = HttpMethod::POST;
+    else if (s == "PUT") method = HttpMethod::PUT;
+    else if (s == "DELETE") method = HttpMethod::DELETE;
+    else if (s == "OPTIONS") method = HttpMethod::OPTIONS;
+    else return false;
+    return true;
+}
+
+/// True if the comma-separated header value lists `token`.
+bool hasToken(std::string_view value, std::string_view token) {
+    while (!value.empty()) {
+        size_t comma = value.find(',');
+        if (equalsIgnoreCase(trim(value.substr(0, comma)), token)) return true;
+        if (comma == std::string_view::npos) break;
+        value.remove_prefix(comma + 1);
+    }
+    return false;
+}
+}  // namespace
+
+bool acceptsEncoding(std::string_view acceptEncoding, std::string_view coding) {
+    bool wildcard = false;
+    while (!acceptEncoding.empty()) {
+        const size_t comma = acceptEncoding.find(',');
+        std::string_view item = acceptEncoding.substr(0, comma);
+        acceptEncoding.remove_prefix(comma == std::string_view::npos ? acceptEncoding.size() : comma + 1);
+        const size_t semi = item.find(';');
+        const std::string_view name = trim(item.substr(0, semi));
+        bool allowed = true;
+        if (semi != std::string_view::npos) {
+            // Only "q=0" (any number of zero decimals) disables a coding.
+            std::string_view q = trim(item.substr(semi + 1));
+            if (q.size() >= 2 && (q[0] == 'q' || q[0] == 'Q') && q[1] == '=') {
+                q.remove_prefix(2);
+                allowed = q.find_first_not_of("0.") != std::string_view::npos;
+            }
+        }
+        if (equalsIgnoreCase(name, coding)) return allowed;
+        if (name == "*") wildcard = allowed;
+    }
+    return wildcard;
+}
+
+HttpFields::const_iterator HttpFields::find(std::string_view name) const {
+    return std::find_if(fields_.begin(), fields_.end(),
+                        [name](const Field& f) { return f.first == name; });
+}
+
+bool PathParams::add(std::string_view name, std::string_view value) {
+    if (size_ == kCapacity) return false;
+    fields_[size_++] = Field(name, value);
+    return true;
+}
+
+PathParams::const_iterator PathParams::find(std::string_view name) const {
+    return std::find_if(begin(), end(), [name](const Field& f) { return f.first == name; });
+}
+
+std::optional<int64_t> PathParams::getInt(std::string_view name) const {
+    auto it = find(name);
+    if (it == end()) return std::nullopt;
+    const std::string_view v = it->second;
+    int64_t value = 0;
+    auto [ptr, ec] = std::from_chars(v.data(), v.data() + v.size(), value);
+    if (ec != std::errc() || ptr != v.data() + v.size()) return std::nullopt;
+    return value;
+}
+
+HttpRequestParser::HttpRequestParser(size_t maxHeaderBytes, size_t maxBodyBytes)
+    : maxHeaderBytes_(maxHeaderBytes), maxBodyBytes_(maxBodyBytes)
+{
+    reset();
+}
+
+void HttpRequestParser::reset() {
+    stage_ = Stage::HEAD;
+    scanned_ = 0;
+    bodyStart_ = 0;
+    contentLength_ = 0;
+    keepAlive_ = false;
+    method_ = HttpMethod::GET;
+    target_ = {0, 0};
+    fields_.clear();
+    error_ = nullptr;
+}
+
+HttpRequestParser::Status HttpRequestParser::fail(const char* message) {
+    stage_ = Stage::FAILED;
+    error_ = message;
+    return Status::ERROR;
+}
+
+HttpRequestParser::Status HttpRequestParser::parse(std::string& buffer) {
+    if (stage_ == Stage::FAILED) return Status::ERROR;
+    if (stage_ == Stage::HEAD) {
+        const size_t headerEnd = buffer.find("\r\n\r\n", scanned_);
+        if (headerEnd == std::string::npos) {
+            if (buffer.size() > maxHeaderBytes_) return fail("Request headers too large");
+            // The terminator may straddle this read and the next.
+            scanned_ = buffer.size() >= 3 ? buffer.size() - 3 : 0;
+            return Status::INCOMPLETE;
+        }
+        if (headerEnd + 4 > maxHeaderBytes_) return fail("Request headers too large");
+        Status head = parseHead(buffer, headerEnd);
+        if (head == Status::ERROR) return head;
+        stage_ = Stage::BODY;
+    }
+    if (buffer.size() < requestSize()) return Status::INCOMPLETE;
+    stage_ = Stage::DONE;
+    return Status::COMPLETE;
+}
+
+HttpRequestParser::Status HttpRequestParser::parseHead(std::string& buffer, size_t headerEnd) {
+    const std::string_view raw(buffer.data(), headerEnd);
+    const size_t lineEnd = std::min(raw.find("\r\n"), raw.size());
+    const std::string_view line = raw.substr(0, lineEnd);
+    const size_t sp1 = line.find(' ');
+    const size_t sp2 = sp1 == std::string_view::npos ? sp1 : line.find(' ', sp1 + 1);
+    if (sp2 == std::string_view::npos || sp2 == sp1 + 1) return fail("Malformed request line");
+    if (!parseMethod(line.substr(0, sp1), method_)) return fail("Unsupported method");
+    const std::string_view version = line.substr(sp2 + 1);
+    if (version != "HTTP/1.1" && version != "HTTP/1.0") return fail("Unsupported HTTP version");
+    target_ = {sp1 + 1, sp2 - sp1 - 1};
+    keepAlive_ = version == "HTTP/1.1";
+
+    bool sawLength = false;
+    size_t pos = lineEnd + 2;
+    while (pos < headerEnd) {
+        size_t end = std::min(raw.find("\r\n", pos), raw.size());
+        const size_t colon = raw.find(':', pos);
+        if (colon >= end || colon == pos || raw[pos] == ' ' || raw[pos] == '\t')
+            return fail("Malformed header");
+        for (size_t i = pos; i < colon; ++i)
+            buffer[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(buffer[i])));
+        const std::string_view name = raw.substr(pos, colon - pos);
+        const std::string_view value = trim(raw.substr(colon + 1, end - colon - 1));
+        const size_t valuePos = static_cast<size_t>(value.data() - buffer.data());
+        fields_.push_back({{pos, name.size()}, {valuePos, value.size()}});
+
+        if (name == "content-length") {
+            if (value.empty()) return fail("Malformed Content-Length");
+            size_t len = 0;
+            for (char c : value) {
+                if (!std::isdigit(static_cast<unsigned char>(c))) return fail("Malformed Content-Length");
+                if (len > (std::numeric_limits<size_t>::max() - 9) / 10) return fail("Request body too large");
+                len = len * 10 + static_cast<size_t>(c - '0');
+            }
+            if (sawLength && len != contentLength_) return fail("Conflicting Content-Length");
+            if (len > maxBodyBytes_) return fail("Request body too large");
+            contentLength_ = len;
+            sawLength = true;
+        } else if (name == "transfer-encoding") {
+            // Chunked bodies are not supported; guessing the framing would
+            // desynchronise the pipelined requests behind this one.
+            return fail("Transfer-Encoding not supported");
+        } else if (name == "connection") {
+            if (hasToken(value, "close")) keepAlive_ = false;
+            else if (hasToken(value, "keep-alive")) keepAlive_ = true;
+        }
+        pos = end + 2;
+    }
+    bodyStart_ = headerEnd + 4;
+    return Status::COMPLETE;
+}
+
+void HttpRequestParser::build(std::string_view buffer, HttpRequest& request) const {
+    request.method = method_;
+    request.headers.clear();
+    request.queryParams.clear();
+    request.pathParams.clear();
+    for (const auto& [name, value] : fields_)
+        request.headers.add(buffer.substr(name.pos, name.len), buffer.substr(value.pos, value.len));
+    std::string_view target = buffer.substr(target_.pos, target_.len);
+    const size_t q = target.find('?');
+    request.path = target.substr(0, q);
+    if (q != std::string_view::npos) {
+        std::string_view query = target.substr(q + 1);
+        while (!query.empty()) {
+            const size_t amp = query.find('&');
+            std::string_view pair = query.substr(0, amp);
+            const size_t eq = pair.find('=');
+            if (eq != std::string_view::npos) request.queryParams.add(pair.substr(0, eq), pair.substr(eq + 1));
+            if (amp == std::string_view::npos) break;
+            query.remove_prefix(amp + 1);
+        }
+    }
+    request.body = buffer.substr(bodyStart_, contentLength_);
+}
+
+} // namespace whot::network
@@ -1,5 +1,8 @@
 #include "../../include/Network/MessageProtocol.hpp"
 #include "../../include/Core/GameConstants.hpp"
+#include "Utils/ByteStream.hpp"
+#include "Utils/JSONSerializer.hpp"
+#include "Utils/Validation.hpp"
 #include <nlohmann/json.hpp>
 #include <chrono>
 
@@ -7,14 +10,33 @@ namespace whot::network {
 
 using json = nlohmann::json;
 
+namespace {
+constexpr uint8_t kNone = 0xFF;
+constexpr uint8_t kHasGameCode = 1;
+constexpr uint8_t kHasPassword = 2;
+
+/// Payloads that are JSON objects or arrays are spliced into the frame as-is.
+bool isJsonContainer(std::string_view text) {
+    const size_t first = text.find_first_not_of(" \t\r\n");
+    return first != std::string_view::npos && (text[first] == '{' || text[first] == '[');
+}
+
+}  // namespace
+
 std::string Message::serialize() const {
-    json j;
-    j["type"] = static_cast<uint16_t>(type);
-    j["playerId"] = playerId;
-    j["gameId"] = gameId;
-    j["payload"] = payload;
-    j["timestamp"] = timestamp;
-    return j.dump();
+    std::string out;
+    out.reserve(80 + playerId.size() + gameId.size() + payload.size());
+    utils::JsonWriter w(out);
+    w.beginObject();
+    w.key("type").value(static_cast<uint16_t>(type));
+    w.key("playerId").value(playerId);
+    w.key("gameId").value(gameId);
+    w.key("payload");
+    if (isJsonContainer(payload)) w.raw(payload);
+    else w.value(payload);
+    w.key("timestamp").value(timestamp);
+    w.endObject();
+    return out;
 }
 
 Message Message::deserialize(const std::string& data) {
@@ -32,11 +54,45 @@ Message Message::deserialize(const std::string& data) {
     return m;
 }
 
+std::string Message::encode() const {
+    std::string out;
+    out.reserve(16 + playerId.size() + gameId.size() + payload.size());
+    utils::ByteWriter w(out);
+    w.varint(static_cast<uint16_t>(type));
+    w.u8(static_cast<uint8_t>(payloadFormat));
+    w.varint(timestamp);
+    w.str(playerId);
+    w.str(gameId);
+    w.bytes(payload);
+    return out;
+}
+
+Message Message::decode(std::string_view frame) {
+    Message m;
+    utils::ByteReader r(frame);
+    const uint64_t type = r.varint();
+    const uint8_t format = r.u8();
+    m.timestamp = r.varint();
+    m.playerId = std::string(r.str());
+    m.gameId = std::string(r.str());
+    m.payload = std::string(r.rest());
+    if (!r.ok() || format > static_cast<uint8_t>(PayloadFormat::BINARY) || type > UINT16_MAX) {
+        m = Message{};
+        m.type = MessageType::ERROR;
+        m.timestamp = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+        return m;
+    }
+    m.type = static_cast<MessageType>(type);
+    m.payloadFormat = static_cast<PayloadFormat>(format);
+    return m;
+}
+
 std::string JoinGamePayload::toJson() const {
     json j;
     j["playerName"] = playerName;
     j["gameId"] = gameId;
     if (password.has_value()) j["password"] = password.value();
+    if (statePatches) j["statePatches"] = true;
     return j.dump();
 }
 
@@ -48,10 +104,42 @@ JoinGamePayload JoinGamePayload::fromJson(const std::string& jsonStr) {
         if (j.contains("gameId")) p.gameId = j["gameId"].get<std::string>();
         if (j.contains("gameCode")) p.gameCode = j["gameCode"].get<std::string>();
         if (j.contains("password")) p.password = j["password"].get<std::string>();
+        p.statePatches = j.value("statePatches", false);
     } catch (...) {}
     return p;
 }
 
+std::string JoinGamePayload::toBinary() const {
+    std::string out;
+    utils::ByteWriter w(out);
+    w.str(playerName);
+    w.str(gameId);
+    w.u8((gameCode ? kHasGameCode : 0) | (password ? kHasPassword : 0));
+    if (gameCode) w.str(*gameCode);
+    if (password) w.str(*password);
+    return out;
+}
+
+std::optional<JoinGamePayload> JoinGamePayload::fromBinary(std::string_view data) {
+    // The JSON path gets this check from json::parse; binary strings would
+    // otherwise reach the state broadcasts unchecked.
+    utils::ByteReader r(data);
+    bool valid = true;
+    auto text = [&] {
+        const std::string_view s = r.str();
+        valid = valid && utils::Validator::isValidUtf8(s);
+        return std::string(s);
+    };
+    JoinGamePayload p;
+    p.playerName = text();
+    p.gameId = text();
+    const uint8_t flags = r.u8();
+    if (flags & kHasGameCode) p.gameCode = text();
+    if (flags & kHasPassword) p.password = text();
+    if (!r.ok() || !valid) return std::nullopt;
+    return p;
+}
+
 std::string PlayCardPayload::toJson() const {
     json j;
     j["cardIndex"] = cardIndex;
@@ -75,6 +163,38 @@ PlayCardPayload PlayCardPayload::fromJson(const std::string& jsonStr) {
     return p;
 }
 
+std::string PlayCardPayload::toBinary() const {
+    std::string out;
+    utils::ByteWriter w(out);
+    w.varint(cardIndex);
+    w.u8(chosenSuit ? static_cast<uint8_t>(*chosenSuit) : kNone);
+    w.u8(reverseDirection ? static_cast<uint8_t>(*reverseDirection) : kNone);
+    w.varint(additionalCards.size());
+    for (size_t index : additionalCards) w.varint(index);
+    return out;
+}
+
+std::optional<PlayCardPayload> PlayCardPayload::fromBinary(std::string_view data) {
+    utils::ByteReader r(data);
+    const uint64_t cardIndex = r.varint();
+    const uint8_t suit = r.u8();
+    const uint8_t reverse = r.u8();
+    const uint64_t additional = r.varint();
+    // Each index takes at least one byte, which bounds the count.
+    if (!r.ok() || additional > data.size()) return std::nullopt;
+    if (suit != kNone && suit > static_cast<uint8_t>(core::Suit::WHOT)) return std::nullopt;
+    if (reverse != kNone && reverse > 1) return std::nullopt;
+    PlayCardPayload p;
+    p.cardIndex = static_cast<size_t>(cardIndex);
+    if (suit != kNone) p.chosenSuit = static_cast<core::Suit>(suit);
+    if (reverse != kNone) p.reverseDirection = reverse != 0;
+    p.additionalCards.reserve(static_cast<size_t>(additional));
+    for (uint64_t i = 0; i < additional; ++i) p.additionalCards.push_back(static_cast<size_t>(r.varint()));
+    // A partly decoded frame must not play its first card on its own.
+    if (!r.ok() || !r.atEnd()) return std::nullopt;
+    return p;
+}
+
 std::string GameStateUpdatePayload::toJson() const {
     json j;
     j["gameStateJson"] = gameStateJson;
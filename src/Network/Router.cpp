@@ -0,0 +1,197 @@
+#include "../../include/Network/Router.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <stdexcept>
+#include <vector>
+
+namespace whot::network {
+
+namespace {
+constexpr size_t kMethodCount = static_cast<size_t>(HttpMethod::OPTIONS) + 1;
+// Keeps ":id<int>" values inside int64_t for PathParams::getInt.
+constexpr size_t kMaxIntDigits = 18;
+
+enum class SegmentKind { LITERAL, UUID, INT, STRING };
+
+struct Segment {
+    SegmentKind kind;
+    std::string_view label;  // literal text or parameter name
+};
+
+[[noreturn]] void badPattern(std::string_view pattern, const char* why) {
+    throw std::invalid_argument("route pattern " + std::string(pattern) + ": " + why);
+}
+
+Segment parseSegment(std::string_view segment, std::string_view pattern) {
+    if (segment.empty() || segment.front() != ':') return {SegmentKind::LITERAL, segment};
+    segment.remove_prefix(1);
+    SegmentKind kind = SegmentKind::STRING;
+    const size_t open = segment.find('<');
+    if (open != std::string_view::npos) {
+        if (segment.back() != '>') badPattern(pattern, "unterminated parameter type");
+        const std::string_view type = segment.substr(open + 1, segment.size() - open - 2);
+        if (type == "int") kind = SegmentKind::INT;
+        else if (type == "uuid") kind = SegmentKind::UUID;
+        else if (type != "string") badPattern(pattern, "unknown parameter type");
+        segment = segment.substr(0, open);
+    }
+    if (segment.empty()) badPattern(pattern, "unnamed parameter");
+    return {kind, segment};
+}
+
+bool isInt(std::string_view s) {
+    if (!s.empty() && s.front() == '-') s.remove_prefix(1);
+    return !s.empty() && s.size() <= kMaxIntDigits &&
+           std::all_of(s.begin(), s.end(), [](unsigned char c) { return std::isdigit(c); });
+}
+
+bool isUuid(std::string_view s) {
+    if (s.size() != 36) return false;
+    for (size_t i = 0; i < s.size(); ++i) {
+        const bool dash = i == 8 || i == 13 || i == 18 || i == 23;
+        if (dash ? s[i] != '-' : !std::isxdigit(static_cast<unsigned char>(s[i]))) return false;
+    }
+    return true;
+}
+
+bool accepts(SegmentKind kind, std::string_view value) {
+    switch (kind) {
+        case SegmentKind::INT: return isInt(value);
+        case SegmentKind::UUID: return isUuid(value);
+        case SegmentKind::STRING: return !value.empty();
+        case SegmentKind::LITERAL: break;
+    }
+    return false;
+}
+
+/// Calls f(segment) for each segment after the leading '/'; "/" itself has
+/// none, and a trailing '/' yields a final empty segment.
+template <typename F>
+void forEachSegment(std::string_view path, F&& f) {
+    if (path.size() <= 1) return;
+    std::string_view rest = path.substr(1);
+    for (;;) {
+        const size_t slash = rest.find('/');
+        if (slash == std::string_view::npos) {
+            f(rest);
+            return;
+        }
+        f(rest.substr(0, slash));
+        rest.remove_prefix(slash + 1);
+    }
+}
+}  // namespace
+
+struct Router::Node {
+    SegmentKind kind = SegmentKind::LITERAL;
+    std::string label;
+    std::vector<std::unique_ptr<Node>> literals;  // sorted by label
+    std::vector<std::unique_ptr<Node>> params;    // typed before untyped
+    std::array<RouteId, kMethodCount> routes;
+
+    Node() { routes.fill(kNoRoute); }
+
+    const Node* findLiteral(std::string_view segment) const {
+        auto it = std::lower_bound(literals.begin(), literals.end(), segment,
+                                   [](const std::unique_ptr<Node>& n, std::string_view s) {
+                                       return n->label < s;
+                                   });
+        return it != literals.end() && (*it)->label == segment ? it->get() : nullptr;
+    }
+
+    Node& child(const Segment& segment) {
+        auto make = [&segment] {
+            auto node = std::make_unique<Node>();
+            node->kind = segment.kind;
+            node->label = std::string(segment.label);
+            return node;
+        };
+        if (segment.kind == SegmentKind::LITERAL) {
+            auto it = std::lower_bound(literals.begin(), literals.end(), segment.label,
+                                       [](const std::unique_ptr<Node>& n, std::string_view s) {
+                                           return n->label < s;
+                                       });
+            if (it == literals.end() || (*it)->label != segment.label) it = literals.insert(it, make());
+            return **it;
+        }
+        for (auto& p : params) {
+            if (p->kind == segment.kind && p->label == segment.label) return *p;
+        }
+        // Keep the most specific types first so ":n<int>" wins over ":name".
+        auto it = std::find_if(params.begin(), params.end(), [&segment](const std::unique_ptr<Node>& p) {
+            return p->kind > segment.kind;
+        });
+        return **params.insert(it, make());
+    }
+};
+
+Router::Router() : root_(std::make_unique<Node>()), size_(0) {}
+Router::~Router() = default;
+Router::Router(Router&&) noexcept = default;
+Router& Router::operator=(Router&&) noexcept = default;
+
+Router::RouteId Router::add(HttpMethod method, std::string_view pattern, RouteId route) {
+    if (pattern.empty() || pattern.front() != '/') badPattern(pattern, "must start with '/'");
+    Node* node = root_.get();
+    std::array<std::string_view, PathParams::kCapacity> names;
+    size_t paramCount = 0;
+    forEachSegment(pattern, [&](std::string_view text) {
+        const Segment segment = parseSegment(text, pattern);
+        if (segment.kind != SegmentKind::LITERAL) {
+            if (paramCount == names.size()) badPattern(pattern, "too many parameters");
+            if (std::find(names.begin(), names.begin() + paramCount, segment.label) !=
+                names.begin() + paramCount) {
+                badPattern(pattern, "duplicate parameter name");
+            }
+            names[paramCount++] = segment.label;
+        }
+        node = &node->child(segment);
+    });
+    RouteId& slot = node->routes[static_cast<size_t>(method)];
+    const RouteId previous = slot;
+    slot = route;
+    if (previous == kNoRoute) ++size_;
+    return previous;
+}
+
+Router::Match Router::find(HttpMethod method, std::string_view path, PathParams& params) const {
+    params.clear();
+    Match match;
+    if (path.empty() || path.front() != '/') return match;
+    const std::string_view rest = path.substr(1);
+    if (!matchNode(*root_, rest, rest.empty(), method, params, match)) params.clear();
+    return match;
+}
+
+bool Router::matchNode(const Node& node, std::string_view rest, bool atEnd, HttpMethod method,
+                       PathParams& params, Match& match) {
+    if (atEnd) {
+        const RouteId route = node.routes[static_cast<size_t>(method)];
+        if (route != kNoRoute) {
+            match.route = route;
+            return true;
+        }
+        for (size_t m = 0; m < kMethodCount; ++m) {
+            if (node.routes[m] != kNoRoute) match.allowedMethods |= 1u << m;
+        }
+        return false;
+    }
+    const size_t slash = rest.find('/');
+    const bool last = slash == std::string_view::npos;
+    const std::string_view segment = rest.substr(0, slash);
+    const std::string_view next = last ? std::string_view() : rest.substr(slash + 1);
+
+    if (const Node* literal = node.findLiteral(segment)) {
+        if (matchNode(*literal, next, last, method, params, match)) return true;
+    }
+    const size_t mark = params.size();
+    for (const auto& param : node.params) {
+        if (!accepts(param->kind, segment) || !params.add(param->label, segment)) continue;
+        if (matchNode(*param, next, last, method, params, match)) return true;
+        params.truncate(mark);
+    }
+    return false;
+}
+
+} // namespace whot::network
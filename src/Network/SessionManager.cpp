@@ -46,6 +46,13 @@ const Session* SessionManager::getSession(const std::string& sessionId) const {
     return it != sessions_.end() ? it->second.get() : nullptr;
 }
 
+std::optional<Session> SessionManager::getSessionSnapshot(const std::string& sessionId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(sessionId);
+    if (it == sessions_.end()) return std::nullopt;
+    return *it->second;
+}
+
 void SessionManager::setPlayerId(const std::string& sessionId, const std::string& playerId) {
     std::lock_guard<std::mutex> lock(mutex_);
     auto it = sessions_.find(sessionId);
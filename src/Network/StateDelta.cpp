@@ -0,0 +1,256 @@
+#include "../../include/Network/StateDelta.hpp"
+#include "Utils/JSONSerializer.hpp"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace whot::network {
+
+using json = nlohmann::json;
+
+namespace {
+
+json diffValue(const json& from, const json& to);
+
+json diffArray(const json& from, const json& to) {
+    if (from.size() == to.size()) {
+        json items = json::object();
+        for (size_t i = 0; i < to.size(); ++i) {
+            if (from[i] != to[i]) items[std::to_string(i)] = diffValue(from[i], to[i]);
+        }
+        // Every element changed: the plain array is no larger.
+        if (items.size() == to.size()) return to;
+        return json{{"$items", std::move(items)}};
+    }
+    const size_t shorter = std::min(from.size(), to.size());
+    size_t prefix = 0;
+    while (prefix < shorter && from[prefix] == to[prefix]) ++prefix;
+    size_t suffix = 0;
+    while (suffix < shorter - prefix &&
+           from[from.size() - 1 - suffix] == to[to.size() - 1 - suffix]) ++suffix;
+    json inserted = json::array();
+    for (size_t i = prefix; i < to.size() - suffix; ++i) inserted.push_back(to[i]);
+    return json{{"$splice", json::array({prefix, from.size() - prefix - suffix, std::move(inserted)})}};
+}
+
+json diffValue(const json& from, const json& to) {
+    if (from.is_array() && to.is_array()) return diffArray(from, to);
+    if (!from.is_object() || !to.is_object()) return to;
+    json patch = json::object();
+    for (auto it = from.begin(); it != from.end(); ++it) {
+        if (!to.contains(it.key())) patch[it.key()] = nullptr;
+    }
+    for (auto it = to.begin(); it != to.end(); ++it) {
+        auto old = from.find(it.key());
+        if (old == from.end()) patch[it.key()] = it.value();
+        else if (*old != it.value()) patch[it.key()] = diffValue(*old, it.value());
+    }
+    return patch;
+}
+
+json applyValue(json base, const json& patch) {
+    if (!patch.is_object()) return patch;
+    if (base.is_array()) {
+        if (auto items = patch.find("$items"); items != patch.end()) {
+            for (auto it = items->begin(); it != items->end(); ++it) {
+                const size_t index = std::stoul(it.key());
+                if (index < base.size()) base[index] = applyValue(std::move(base[index]), it.value());
+            }
+            return base;
+        }
+        if (auto splice = patch.find("$splice"); splice != patch.end() && splice->size() == 3) {
+            const size_t start = std::min<size_t>((*splice)[0].get<size_t>(), base.size());
+            const size_t count = std::min<size_t>((*splice)[1].get<size_t>(), base.size() - start);
+            base.erase(base.begin() + static_cast<std::ptrdiff_t>(start),
+                       base.begin() + static_cast<std::ptrdiff_t>(start + count));
+            const json& inserted = (*splice)[2];
+            base.insert(base.begin() + static_cast<std::ptrdiff_t>(start), inserted.begin(), inserted.end());
+            return base;
+        }
+    }
+    if (!base.is_object()) base = json::object();
+    for (auto it = patch.begin(); it != patch.end(); ++it) {
+        if (it.value().is_null()) {
+            base.erase(it.key());
+            continue;
+        }
+        auto existing = base.find(it.key());
+        base[it.key()] = applyValue(existing != base.end() ? std::move(*existing) : json(), it.value());
+    }
+    return base;
+}
+
+}  // namespace
+
+std::string diffJson(std::string_view from, std::string_view to) {
+    return diffValue(json::parse(from), json::parse(to)).dump();
+}
+
+std::string applyJsonPatch(std::string_view base, std::string_view patch) {
+    return applyValue(json::parse(base), json::parse(patch)).dump();
+}
+
+struct StateStreams::Frame::Impl {
+    std::shared_ptr<const json> shared;
+    // Shared patches already computed, keyed by the view they start from.
+    std::vector<std::pair<std::shared_ptr<const json>, json>> patches;
+
+    const json& patchFrom(const std::shared_ptr<const json>& base) {
+        for (const auto& [from, patch] : patches)
+            if (from == base) return patch;
+        patches.emplace_back(base, diffValue(*base, *shared));
+        return patches.back().second;
+    }
+};
+
+StateStreams::Frame::Frame(std::string_view sharedJson)
+    : impl_(std::make_unique<Impl>())
+{
+    impl_->shared = std::make_shared<const json>(json::parse(sharedJson));
+}
+
+StateStreams::Frame::~Frame() = default;
+
+struct StateStreams::Stream {
+    std::mutex mutex;
+    uint64_t seq = 0;
+    bool hasBase = false;
+    // The last view sent: the frame's shared view with `hand` at `seat`.
+    std::shared_ptr<const json> shared;
+    size_t seat = kNoSeat;
+    json hand;
+
+    json view() const {
+        json out = *shared;
+        if (seat != kNoSeat) out["players"][seat]["hand"] = hand;
+        return out;
+    }
+};
+
+namespace {
+
+size_t playerCount(const json& view) {
+    auto players = view.find("players");
+    return players != view.end() && players->is_array() ? players->size() : 0;
+}
+
+// `patch` is a shared-view patch; the viewer's own element in it carries the
+// masked hand ({"count":n}) or nothing. Swap in the patch of the real hand.
+void patchSeat(json& patch, size_t seat, const json& oldHand, const json& newHand) {
+    const bool handChanged = oldHand != newHand;
+    const std::string key = std::to_string(seat);
+    auto players = patch.find("players");
+    if (players == patch.end()) {
+        if (handChanged)
+            patch["players"] = json{{"$items", json{{key, json{{"hand", diffValue(oldHand, newHand)}}}}}};
+        return;
+    }
+    if (players->is_array()) {
+        (*players)[seat]["hand"] = newHand;
+        return;
+    }
+    json& items = (*players)["$items"];
+    if (handChanged) {
+        items[key]["hand"] = diffValue(oldHand, newHand);
+        return;
+    }
+    auto item = items.find(key);
+    if (item == items.end()) return;
+    item->erase("hand");
+    if (item->empty()) items.erase(key);
+    if (items.empty()) patch.erase("players");
+}
+
+}  // namespace
+
+StateStreams::StateStreams() = default;
+StateStreams::~StateStreams() = default;
+
+void StateStreams::open(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& stream = streams_[sessionId];
+    if (!stream) {
+        stream = std::make_shared<Stream>();
+        return;
+    }
+    std::lock_guard<std::mutex> streamLock(stream->mutex);
+    stream->hasBase = false;
+}
+
+void StateStreams::resync(const std::string& sessionId) {
+    std::shared_ptr<Stream> stream;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = streams_.find(sessionId);
+        if (it == streams_.end()) return;
+        stream = it->second;
+    }
+    std::lock_guard<std::mutex> streamLock(stream->mutex);
+    stream->hasBase = false;
+}
+
+void StateStreams::close(const std::string& sessionId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_.erase(sessionId);
+}
+
+bool StateStreams::isOpen(const std::string& sessionId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return streams_.count(sessionId) != 0;
+}
+
+std::optional<StateStreams::Update> StateStreams::next(const std::string& sessionId,
+                                                       std::string_view viewJson) {
+    if (!isOpen(sessionId)) return std::nullopt;
+    Frame frame(viewJson);
+    return next(sessionId, frame, viewJson);
+}
+
+std::optional<StateStreams::Update> StateStreams::next(const std::string& sessionId, Frame& frame,
+                                                       std::string_view viewJson, size_t seat,
+                                                       std::string_view handJson) {
+    std::shared_ptr<Stream> stream;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = streams_.find(sessionId);
+        if (it == streams_.end()) return std::nullopt;
+        stream = it->second;
+    }
+    const std::shared_ptr<const json>& shared = frame.impl_->shared;
+    if (seat != kNoSeat && seat >= playerCount(*shared)) seat = kNoSeat;
+    json hand = seat != kNoSeat ? json::parse(handJson) : json();
+
+    std::lock_guard<std::mutex> streamLock(stream->mutex);
+    Update update;
+    utils::JsonWriter w(update.payload);
+    if (!stream->hasBase) {
+        update.type = MessageType::GAME_STATE_UPDATE;
+        update.seq = ++stream->seq;
+        w.beginObject().key("seq").value(update.seq).key("gameState").raw(viewJson).endObject();
+    } else {
+        json patch;
+        if (seat == stream->seat && playerCount(*stream->shared) == playerCount(*shared)) {
+            patch = frame.impl_->patchFrom(stream->shared);
+            if (seat != kNoSeat) patchSeat(patch, seat, stream->hand, hand);
+        } else {
+            // Rare (a seat came or went): rebuild and diff both whole views.
+            patch = diffValue(stream->view(), json::parse(viewJson));
+        }
+        stream->shared = shared;
+        stream->seat = seat;
+        stream->hand = std::move(hand);
+        if (patch.is_object() && patch.empty()) return std::nullopt;
+        update.type = MessageType::GAME_STATE_PATCH;
+        update.seq = ++stream->seq;
+        w.beginObject().key("seq").value(update.seq).key("patch").raw(patch.dump()).endObject();
+        return update;
+    }
+    stream->shared = shared;
+    stream->seat = seat;
+    stream->hand = std::move(hand);
+    stream->hasBase = true;
+    return update;
+}
+
+} // namespace whot::network
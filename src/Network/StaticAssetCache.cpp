@@ -0,0 +1,188 @@
+#include "../../include/Network/StaticAssetCache.hpp"
+#include "Utils/Compression.hpp"
+#include "Utils/Logger.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+
+namespace whot::network {
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr std::chrono::milliseconds kDefaultRevalidateInterval{1000};
+// Below this, gzip framing eats most of the saving.
+constexpr size_t kMinGzipBytes = 256;
+
+std::string contentTypeFor(const fs::path& file) {
+    std::string ext = file.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (ext.empty() || ext == ".html") return "text/html; charset=utf-8";
+    if (ext == ".css") return "text/css; charset=utf-8";
+    if (ext == ".js") return "application/javascript; charset=utf-8";
+    if (ext == ".json" || ext == ".map") return "application/json";
+    if (ext == ".txt") return "text/plain; charset=utf-8";
+    if (ext == ".svg") return "image/svg+xml";
+    if (ext == ".png") return "image/png";
+    if (ext == ".jpg" || ext == ".jpeg") return "image/jpeg";
+    if (ext == ".webp") return "image/webp";
+    if (ext == ".ico") return "image/x-icon";
+    if (ext == ".woff2") return "font/woff2";
+    return "application/octet-stream";
+}
+
+bool isCompressible(const std::string& contentType) {
+    return contentType.rfind("text/", 0) == 0 || contentType.rfind("application/javascript", 0) == 0 ||
+           contentType == "application/json" || contentType == "image/svg+xml";
+}
+
+/// The SPA shell must pick up new deploys immediately; everything else may be
+/// reused for a few minutes and is then revalidated by ETag.
+std::string cacheControlFor(const std::string& contentType) {
+    return contentType.rfind("text/html", 0) == 0 ? "no-cache" : "public, max-age=300";
+}
+
+std::string makeEtag(std::string_view body) {
+    uint64_t h = 0xcbf29ce484222325ULL;  // FNV-1a
+    for (unsigned char c : body) {
+        h ^= c;
+        h *= 0x100000001b3ULL;
+    }
+    char buf[40];
+    std::snprintf(buf, sizeof(buf), "\"%016llx-%zx\"", static_cast<unsigned long long>(h), body.size());
+    return buf;
+}
+
+bool readFile(const fs::path& file, std::string& out) {
+    std::ifstream f(file, std::ios::binary);
+    if (!f) return false;
+    std::error_code ec;
+    const auto size = fs::file_size(file, ec);
+    if (ec) return false;
+    out.resize(static_cast<size_t>(size));
+    f.read(out.data(), static_cast<std::streamsize>(size));
+    out.resize(static_cast<size_t>(f.gcount()));
+    return true;
+}
+
+/// Reads a precompressed sibling ("<file>.gz"), ignoring it when it is older
+/// than the file it was made from.
+bool readVariant(const fs::path& file, const char* suffix, fs::file_time_type mtime, std::string& out) {
+    fs::path variant = file;
+    variant += suffix;
+    std::error_code ec;
+    const auto variantMtime = fs::last_write_time(variant, ec);
+    return !ec && variantMtime >= mtime && readFile(variant, out);
+}
+
+bool isVariantFile(const fs::path& file) {
+    const fs::path ext = file.extension();
+    return ext == ".gz" || ext == ".br";
+}
+
+/// Cache key (path relative to the root) for a URL path; empty if invalid.
+std::string keyFor(std::string_view urlPath) {
+    while (!urlPath.empty() && urlPath.front() == '/') urlPath.remove_prefix(1);
+    if (urlPath.empty()) return "index.html";
+    if (urlPath.find('\\') != std::string_view::npos || urlPath.find('\0') != std::string_view::npos)
+        return {};
+    std::string_view rest = urlPath;
+    while (!rest.empty()) {
+        const size_t slash = rest.find('/');
+        const std::string_view segment = rest.substr(0, slash);
+        if (segment.empty() || segment == "." || segment == "..") return {};
+        if (slash == std::string_view::npos) break;
+        rest.remove_prefix(slash + 1);
+    }
+    return std::string(urlPath);
+}
+
+std::chrono::steady_clock::rep nowTicks() {
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+}  // namespace
+
+StaticAssetCache::StaticAssetCache(fs::path root)
+    : root_(std::move(root)), revalidateInterval_(kDefaultRevalidateInterval)
+{
+}
+
+void StaticAssetCache::setRevalidateInterval(std::chrono::milliseconds interval) {
+    revalidateInterval_ = interval;
+}
+
+void StaticAssetCache::load() {
+    std::map<std::string, AssetPtr, std::less<>> loaded;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(root_, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file() || isVariantFile(it->path())) continue;
+        std::string key = fs::relative(it->path(), root_).generic_string();
+        if (AssetPtr asset = loadFile(key, it->path())) loaded.emplace(std::move(key), std::move(asset));
+    }
+    if (ec) LOG_WARNING("Static root not fully loaded: " + root_.string() + ": " + ec.message());
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    assets_.swap(loaded);
+}
+
+StaticAssetCache::AssetPtr StaticAssetCache::lookup(std::string_view urlPath) {
+    const std::string key = keyFor(urlPath);
+    if (key.empty()) return nullptr;
+    AssetPtr asset;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = assets_.find(key);
+        if (it != assets_.end()) asset = it->second;
+    }
+    fs::path file = root_ / key;
+    if (asset) {
+        const auto now = nowTicks();
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            revalidateInterval_).count();
+        if (now - asset->checkedAt.load(std::memory_order_relaxed) < interval) return asset;
+        asset->checkedAt.store(now, std::memory_order_relaxed);
+        std::error_code ec;
+        const auto mtime = fs::last_write_time(asset->file, ec);
+        if (!ec && mtime == asset->mtime) return asset;
+        file = asset->file;
+    }
+    // New, changed or deleted file.
+    AssetPtr fresh = loadFile(key, file);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (fresh) assets_[key] = fresh;
+    else assets_.erase(key);
+    return fresh;
+}
+
+size_t StaticAssetCache::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return assets_.size();
+}
+
+StaticAssetCache::AssetPtr StaticAssetCache::loadFile(const std::string& key, const fs::path& file) const {
+    std::error_code ec;
+    if (!fs::is_regular_file(file, ec)) return nullptr;
+    auto asset = std::make_shared<StaticAsset>();
+    asset->file = file;
+    asset->mtime = fs::last_write_time(file, ec);
+    if (ec || !readFile(file, asset->body)) return nullptr;
+    asset->contentType = contentTypeFor(file);
+    asset->cacheControl = cacheControlFor(asset->contentType);
+    asset->etag = makeEtag(asset->body);
+
+    if (!readVariant(file, ".gz", asset->mtime, asset->gzipBody) &&
+        isCompressible(asset->contentType) && asset->body.size() >= kMinGzipBytes) {
+        asset->gzipBody = utils::Compression::gzip(asset->body);
+    }
+    if (asset->gzipBody.size() >= asset->body.size()) asset->gzipBody.clear();
+    readVariant(file, ".br", asset->mtime, asset->brotliBody);
+    if (asset->brotliBody.size() >= asset->body.size()) asset->brotliBody.clear();
+    asset->checkedAt.store(nowTicks(), std::memory_order_relaxed);
+    LOG_DEBUG("Cached static asset " + key + " (" + std::to_string(asset->body.size()) + " bytes)");
+    return asset;
+}
+
+} // namespace whot::network
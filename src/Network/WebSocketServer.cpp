@@ -1,6 +1,7 @@
 #include "../../include/Network/WebSocketServer.hpp"
 #include <websocketpp/config/asio_no_tls.hpp>
 #include <websocketpp/server.hpp>
+#include <boost/asio/io_context_strand.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <mutex>
 #include <map>
@@ -24,6 +25,10 @@ struct WebSocketServer::WsServerImpl {
             server_.get_io_service());
         timeoutTimer_ = std::make_unique<boost::asio::steady_timer>(
             server_.get_io_service());
+        // With several io threads, the timers' handlers and stop() must not
+        // touch a timer concurrently.
+        timerStrand_ = std::make_unique<boost::asio::io_context::strand>(
+            server_.get_io_service());
 
         server_.set_reuse_addr(true);
         // Handle non-WebSocket HTTP requests (e.g. OPTIONS preflight or wrong port):
@@ -31,8 +36,19 @@ struct WebSocketServer::WsServerImpl {
         server_.set_http_handler([this](connection_hdl hdl) {
             on_http_request(hdl);
         });
-        server_.set_validate_handler([this](connection_hdl) {
-            return true; // accept all WebSocket handshakes that pass library checks
+        server_.set_validate_handler([this](connection_hdl hdl) {
+            // Accept all handshakes that pass library checks; clients that
+            // offer the binary subprotocol get it, everyone else stays on JSON.
+            try {
+                auto con = server_.get_con_from_hdl(hdl);
+                for (const std::string& protocol : con->get_requested_subprotocols()) {
+                    if (protocol == kBinarySubprotocol) {
+                        con->select_subprotocol(protocol);
+                        break;
+                    }
+                }
+            } catch (...) {}
+            return true;
         });
         server_.set_open_handler([this](connection_hdl hdl) {
             on_open(hdl);
@@ -65,25 +81,41 @@ struct WebSocketServer::WsServerImpl {
         con->set_body("");
     }
 
-    void run(uint16_t port) {
+    /// Binds and queues the first accept and the timers; io threads then
+    /// call run(). False if the port cannot be bound.
+    bool listen(uint16_t port) {
         try {
             server_.listen(port);
             server_.start_accept();
-            scheduleHeartbeat();
-            scheduleTimeoutCheck();
-            server_.run();
         } catch (const std::exception& e) {
             (void)e;
+            return false;
+        }
+        scheduleHeartbeat();
+        scheduleTimeoutCheck();
+        return true;
+    }
+
+    void run() {
+        for (;;) {
+            try {
+                server_.run();
+                return;
+            } catch (const std::exception& e) {
+                // A handler threw out of the io_service; keep serving.
+                (void)e;
+                if (!owner_ || !owner_->running_) return;
+            }
         }
     }
 
     void stop() {
-        // Cancel pending timers before stopping so their callbacks do not
-        // fire on a partially torn-down owner.
-        if (heartbeatTimer_) heartbeatTimer_->cancel();
-        if (timeoutTimer_)   timeoutTimer_->cancel();
         try {
-            server_.get_io_service().post([this]() {
+            timerStrand_->post([this]() {
+                // Cancel pending timers before stopping so their callbacks do
+                // not fire on a partially torn-down owner.
+                if (heartbeatTimer_) heartbeatTimer_->cancel();
+                if (timeoutTimer_)   timeoutTimer_->cancel();
                 try {
                     server_.stop_listening();
                     std::vector<connection_hdl> to_close;
@@ -103,19 +135,28 @@ struct WebSocketServer::WsServerImpl {
         } catch (...) {}
     }
 
-    void send(const std::string& sessionId, const std::string& data) {
-        connection_hdl hdl;
+    void send(const std::string& sessionId, const Message& message) {
+        Peer peer;
         {
             std::lock_guard<std::mutex> lock(mutex_);
             auto it = session_to_hdl_.find(sessionId);
             if (it == session_to_hdl_.end()) return;
-            hdl = it->second;
+            peer = it->second;
         }
         try {
-            server_.send(hdl, data, websocketpp::frame::opcode::text);
+            if (peer.binary)
+                server_.send(peer.hdl, message.encode(), websocketpp::frame::opcode::binary);
+            else
+                server_.send(peer.hdl, message.serialize(), websocketpp::frame::opcode::text);
         } catch (...) {}
     }
 
+    bool isBinary(const std::string& sessionId) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = session_to_hdl_.find(sessionId);
+        return it != session_to_hdl_.end() && it->second.binary;
+    }
+
     std::vector<std::string> getSessionIds() const {
         std::lock_guard<std::mutex> lock(mutex_);
         std::vector<std::string> out;
@@ -123,10 +164,17 @@ struct WebSocketServer::WsServerImpl {
         return out;
     }
 
-    // Send a WebSocket PING frame to every open connection.
+    // Send a WebSocket PING frame to every open connection. Pings go out
+    // after the lock is released so IO threads opening or closing
+    // connections are not held up behind the whole sweep.
     void sendPings() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        for (const auto& [hdl, sid] : hdl_to_session_) {
+        std::vector<connection_hdl> targets;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            targets.reserve(hdl_to_session_.size());
+            for (const auto& [hdl, sid] : hdl_to_session_) targets.push_back(hdl);
+        }
+        for (const connection_hdl& hdl : targets) {
             try { server_.ping(hdl, ""); } catch (...) {}
         }
     }
@@ -139,7 +187,7 @@ struct WebSocketServer::WsServerImpl {
             std::lock_guard<std::mutex> lock(mutex_);
             auto it = session_to_hdl_.find(sessionId);
             if (it != session_to_hdl_.end()) {
-                hdl = it->second;
+                hdl = it->second.hdl;
                 found = true;
             }
         }
@@ -156,11 +204,11 @@ private:
         if (!heartbeatTimer_ || !owner_ || !owner_->running_) return;
         heartbeatTimer_->expires_after(
             std::chrono::seconds(owner_->heartbeatInterval_));
-        heartbeatTimer_->async_wait([this](const boost::system::error_code& ec) {
+        heartbeatTimer_->async_wait(timerStrand_->wrap([this](const boost::system::error_code& ec) {
             if (ec || !owner_ || !owner_->running_) return;
             sendPings();
             scheduleHeartbeat();
-        });
+        }));
     }
 
     void scheduleTimeoutCheck() {
@@ -168,19 +216,21 @@ private:
         // Check at half the configured timeout so expiry is detected promptly.
         int checkInterval = std::max(1, owner_->timeout_ / 2);
         timeoutTimer_->expires_after(std::chrono::seconds(checkInterval));
-        timeoutTimer_->async_wait([this](const boost::system::error_code& ec) {
+        timeoutTimer_->async_wait(timerStrand_->wrap([this](const boost::system::error_code& ec) {
             if (ec || !owner_ || !owner_->running_) return;
             owner_->checkTimeouts();
             scheduleTimeoutCheck();
-        });
+        }));
     }
 
     void on_open(connection_hdl hdl) {
         std::string ip = "0.0.0.0";
+        bool binary = false;
         try {
             auto con = server_.get_con_from_hdl(hdl);
             if (con) {
                 ip = con->get_remote_endpoint();
+                binary = con->get_subprotocol() == kBinarySubprotocol;
             }
         } catch (...) {}
         std::string sessionId;
@@ -190,7 +240,7 @@ private:
         {
             std::lock_guard<std::mutex> lock(mutex_);
             hdl_to_session_[hdl] = sessionId;
-            session_to_hdl_[sessionId] = hdl;
+            session_to_hdl_[sessionId] = Peer{hdl, binary};
         }
         if (owner_) owner_->handleConnection(sessionId);
     }
@@ -228,16 +278,22 @@ private:
         if (owner_ && owner_->sessionManager_)
             owner_->sessionManager_->updateActivity(sessionId);
         if (owner_)
-            owner_->handleIncomingMessage(sessionId, msg->get_payload());
+            owner_->handleIncomingMessage(sessionId, msg->get_payload(),
+                                          msg->get_opcode() == websocketpp::frame::opcode::binary);
     }
 
     WebSocketServer* owner_;
     WsServer server_;
     std::unique_ptr<boost::asio::steady_timer> heartbeatTimer_;
     std::unique_ptr<boost::asio::steady_timer> timeoutTimer_;
+    std::unique_ptr<boost::asio::io_context::strand> timerStrand_;
     mutable std::mutex mutex_;
     std::map<connection_hdl, std::string, std::owner_less<connection_hdl>> hdl_to_session_;
-    std::map<std::string, connection_hdl> session_to_hdl_;
+    struct Peer {
+        connection_hdl hdl;
+        bool binary = false;  // negotiated kBinarySubprotocol
+    };
+    std::map<std::string, Peer> session_to_hdl_;
 };
 
 WebSocketServer::WebSocketServer(uint16_t port)
@@ -245,6 +301,7 @@ WebSocketServer::WebSocketServer(uint16_t port)
     , running_(false)
     , sessionManager_(std::make_unique<SessionManager>())
     , maxConnections_(1000)
+    , ioThreadCount_(0)
     , heartbeatInterval_(30)
     , timeout_(60)
     , messagesSent_(0)
@@ -254,16 +311,22 @@ WebSocketServer::WebSocketServer(uint16_t port)
 
 WebSocketServer::~WebSocketServer() {
     stop();
-    if (serverThread_.joinable()) serverThread_.join();
 }
 
 void WebSocketServer::start() {
     if (running_) return;
     running_ = true;
     impl_ = std::make_unique<WsServerImpl>(this);
-    serverThread_ = std::thread([this]() {
-        impl_->run(port_);
-    });
+    if (!impl_->listen(port_)) {
+        running_ = false;
+        impl_.reset();
+        return;
+    }
+    size_t threads = ioThreadCount_ ? ioThreadCount_ : std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    ioThreads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+        ioThreads_.emplace_back([this]() { impl_->run(); });
 }
 
 void WebSocketServer::stop() {
@@ -271,7 +334,10 @@ void WebSocketServer::stop() {
     if (impl_) {
         impl_->stop();
     }
-    if (serverThread_.joinable()) serverThread_.join();
+    for (std::thread& t : ioThreads_) {
+        if (t.joinable()) t.join();
+    }
+    ioThreads_.clear();
     impl_.reset();
 }
 
@@ -289,10 +355,14 @@ void WebSocketServer::broadcastMessage(const Message& message) {
 
 void WebSocketServer::sendMessage(const std::string& sessionId, const Message& message) {
     if (!impl_) return;
-    impl_->send(sessionId, message.serialize());
+    impl_->send(sessionId, message);
     messagesSent_++;
 }
 
+bool WebSocketServer::usesBinaryProtocol(const std::string& sessionId) const {
+    return impl_ && impl_->isBinary(sessionId);
+}
+
 void WebSocketServer::sendToGame(const std::string& gameId, const Message& message) {
     if (!sessionManager_) return;
     auto sessionIds = sessionManager_->getSessionsForGame(gameId);
@@ -302,6 +372,7 @@ void WebSocketServer::sendToGame(const std::string& gameId, const Message& messa
 
 SessionManager* WebSocketServer::getSessionManager() { return sessionManager_.get(); }
 void WebSocketServer::setMaxConnections(size_t max) { maxConnections_ = max; }
+void WebSocketServer::setIoThreads(size_t count) { ioThreadCount_ = count; }
 void WebSocketServer::setHeartbeatInterval(int seconds) { heartbeatInterval_ = seconds; }
 void WebSocketServer::setTimeout(int seconds) { timeout_ = seconds; }
 
@@ -321,10 +392,10 @@ void WebSocketServer::handleDisconnection(const std::string& sessionId) {
 }
 
 void WebSocketServer::handleIncomingMessage(const std::string& sessionId,
-                                            const std::string& data) {
+                                            const std::string& data, bool binary) {
     messagesReceived_++;
     if (messageHandler_) {
-        Message msg = Message::deserialize(data);
+        Message msg = binary ? Message::decode(data) : Message::deserialize(data);
         messageHandler_(sessionId, msg);
     }
 }
@@ -1,15 +1,119 @@
 #include "../../include/Persistence/Database.hpp"
 #include <sqlite3.h>
 #include <chrono>
+#include <list>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace whot::persistence {
 
 static const int SCHEMA_VERSION = 1;
 
+namespace {
+
+bool bindParams(sqlite3_stmt* stmt, const std::vector<SqlParam>& params) {
+    for (int i = 0; i < static_cast<int>(params.size()); ++i) {
+        int rc;
+        if (const auto* text = std::get_if<std::string>(&params[i]))
+            rc = sqlite3_bind_text(stmt, i + 1, text->c_str(), -1, SQLITE_TRANSIENT);
+        else if (const auto* blob = std::get_if<SqlBlob>(&params[i]))
+            rc = sqlite3_bind_blob(stmt, i + 1, blob->bytes.data(),
+                                   static_cast<int>(blob->bytes.size()), SQLITE_TRANSIENT);
+        else
+            rc = sqlite3_bind_int64(stmt, i + 1, std::get<int64_t>(params[i]));
+        if (rc != SQLITE_OK) return false;
+    }
+    return true;
+}
+
+// Column 0 as a string; a BLOB keeps its embedded NULs.  NULL reads as nullopt.
+std::optional<std::string> columnString(sqlite3_stmt* stmt) {
+    if (sqlite3_column_type(stmt, 0) == SQLITE_BLOB) {
+        const auto* data = static_cast<const char*>(sqlite3_column_blob(stmt, 0));
+        return std::string(data ? data : "", static_cast<size_t>(sqlite3_column_bytes(stmt, 0)));
+    }
+    const char* t = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    if (!t) return std::nullopt;
+    return std::string(t);
+}
+
+// LRU of prepared statements keyed by SQL text.  A statement handed out by
+// acquire() goes back through release(), which resets it and clears its
+// bindings (or finalizes it when caching is off).  Not synchronized.
+class StatementCache {
+public:
+    explicit StatementCache(size_t capacity) : capacity_(capacity) {}
+    ~StatementCache() { clear(); }
+
+    sqlite3_stmt* acquire(sqlite3* db, const std::string& sql) {
+        auto it = index_.find(sql);
+        if (it != index_.end()) {
+            ++stats_.hits;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->stmt;
+        }
+        ++stats_.misses;
+        sqlite3_stmt* stmt = nullptr;
+        const auto start = std::chrono::steady_clock::now();
+        const int rc = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+        stats_.prepareTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        if (rc != SQLITE_OK) {
+            sqlite3_finalize(stmt);
+            return nullptr;
+        }
+        if (capacity_ == 0) return stmt;
+        if (lru_.size() == capacity_) {
+            sqlite3_finalize(lru_.back().stmt);
+            index_.erase(lru_.back().sql);
+            lru_.pop_back();
+            ++stats_.evictions;
+        }
+        lru_.push_front(Entry{sql, stmt});
+        index_.emplace(sql, lru_.begin());
+        return stmt;
+    }
+
+    void release(sqlite3_stmt* stmt) {
+        if (capacity_ == 0) {
+            sqlite3_finalize(stmt);
+            return;
+        }
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
+
+    /// Finalizes every statement; sqlite3_close fails while any remain.
+    void clear() {
+        for (Entry& entry : lru_) sqlite3_finalize(entry.stmt);
+        lru_.clear();
+        index_.clear();
+    }
+
+    StatementCacheStats stats() const {
+        StatementCacheStats out = stats_;
+        out.size = lru_.size();
+        return out;
+    }
+
+private:
+    struct Entry {
+        std::string sql;
+        sqlite3_stmt* stmt;
+    };
+    size_t capacity_;
+    std::list<Entry> lru_;  // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    StatementCacheStats stats_;
+};
+
+} // namespace
+
 class SQLiteDatabase : public Database {
 public:
-    explicit SQLiteDatabase(const DatabaseConfig& config) : Database(config), db_(nullptr) {}
+    explicit SQLiteDatabase(const DatabaseConfig& config)
+        : Database(config), db_(nullptr), statements_(config.statementCacheSize) {}
 
     ~SQLiteDatabase() override { disconnect(); }
 
@@ -26,6 +130,8 @@ public:
 
     void disconnect() override {
         if (db_) {
+            std::lock_guard<std::mutex> lock(statementMutex_);
+            statements_.clear();
             sqlite3_close(db_);
             db_ = nullptr;
         }
@@ -71,51 +177,20 @@ public:
 
     bool executeBound(const std::string& sql,
                       const std::vector<SqlParam>& params) override {
-        if (!db_) return false;
-        sqlite3_stmt* stmt = nullptr;
-        if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
-            return false;
-        for (int i = 0; i < static_cast<int>(params.size()); ++i) {
-            int rc;
-            if (std::holds_alternative<std::string>(params[i]))
-                rc = sqlite3_bind_text(stmt, i + 1,
-                                       std::get<std::string>(params[i]).c_str(),
-                                       -1, SQLITE_TRANSIENT);
-            else
-                rc = sqlite3_bind_int64(stmt, i + 1,
-                                        std::get<int64_t>(params[i]));
-            if (rc != SQLITE_OK) { sqlite3_finalize(stmt); return false; }
-        }
-        int rc = sqlite3_step(stmt);
-        sqlite3_finalize(stmt);
+        Lease lease(*this, sql);
+        if (!lease.stmt || !bindParams(lease.stmt, params)) return false;
+        int rc = sqlite3_step(lease.stmt);
         return rc == SQLITE_DONE || rc == SQLITE_ROW || rc == SQLITE_OK;
     }
 
     std::optional<std::string> queryOneBound(
             const std::string& sql,
             const std::vector<SqlParam>& params) override {
-        if (!db_) return std::nullopt;
-        sqlite3_stmt* stmt = nullptr;
-        if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
-            return std::nullopt;
-        for (int i = 0; i < static_cast<int>(params.size()); ++i) {
-            int rc;
-            if (std::holds_alternative<std::string>(params[i]))
-                rc = sqlite3_bind_text(stmt, i + 1,
-                                       std::get<std::string>(params[i]).c_str(),
-                                       -1, SQLITE_TRANSIENT);
-            else
-                rc = sqlite3_bind_int64(stmt, i + 1,
-                                        std::get<int64_t>(params[i]));
-            if (rc != SQLITE_OK) { sqlite3_finalize(stmt); return std::nullopt; }
-        }
+        Lease lease(*this, sql);
+        if (!lease.stmt || !bindParams(lease.stmt, params)) return std::nullopt;
         std::optional<std::string> result;
-        if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_count(stmt) > 0) {
-            const char* t = reinterpret_cast<const char*>(
-                sqlite3_column_text(stmt, 0));
-            if (t) result = t;
-        }
-        sqlite3_finalize(stmt);
+        if (sqlite3_step(lease.stmt) == SQLITE_ROW && sqlite3_column_count(lease.stmt) > 0)
+            result = columnString(lease.stmt);
         return result;
     }
 
@@ -123,34 +198,17 @@ public:
             const std::string& sql,
             const std::vector<SqlParam>& params) override {
         std::vector<std::string> out;
-        if (!db_) return out;
-        sqlite3_stmt* stmt = nullptr;
-        if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
-            return out;
-        for (int i = 0; i < static_cast<int>(params.size()); ++i) {
-            int rc;
-            if (std::holds_alternative<std::string>(params[i]))
-                rc = sqlite3_bind_text(stmt, i + 1,
-                                       std::get<std::string>(params[i]).c_str(),
-                                       -1, SQLITE_TRANSIENT);
-            else
-                rc = sqlite3_bind_int64(stmt, i + 1,
-                                        std::get<int64_t>(params[i]));
-            if (rc != SQLITE_OK) { sqlite3_finalize(stmt); return out; }
-        }
-        while (sqlite3_step(stmt) == SQLITE_ROW &&
-               sqlite3_column_count(stmt) > 0) {
-            const char* t = reinterpret_cast<const char*>(
-                sqlite3_column_text(stmt, 0));
-            out.push_back(t ? t : "");
-        }
-        sqlite3_finalize(stmt);
+        Lease lease(*this, sql);
+        if (!lease.stmt || !bindParams(lease.stmt, params)) return out;
+        while (sqlite3_step(lease.stmt) == SQLITE_ROW &&
+               sqlite3_column_count(lease.stmt) > 0)
+            out.push_back(columnString(lease.stmt).value_or(""));
         return out;
     }
 
-    void beginTransaction() override { execute("BEGIN TRANSACTION"); }
-    void commit() override { execute("COMMIT"); }
-    void rollback() override { execute("ROLLBACK"); }
+    bool beginTransaction() override { return execute("BEGIN TRANSACTION"); }
+    bool commit() override { return execute("COMMIT"); }
+    bool rollback() override { return execute("ROLLBACK"); }
 
     void initializeSchema() override {
         execute(R"(
@@ -164,9 +222,13 @@ public:
                 rule_variant TEXT,
                 created_at INTEGER,
                 updated_at INTEGER,
-                status TEXT
+                status TEXT,
+                game_snapshot BLOB
             )
         )");
+        // Databases created before snapshots; fails harmlessly once the
+        // column exists.
+        execute("ALTER TABLE games ADD COLUMN game_snapshot BLOB");
         execute(R"(
             CREATE TABLE IF NOT EXISTS players (
                 player_id TEXT PRIMARY KEY,
@@ -193,6 +255,15 @@ public:
                 FOREIGN KEY(player_id) REFERENCES players(player_id)
             )
         )");
+        execute(R"(
+            CREATE TABLE IF NOT EXISTS game_journal (
+                game_id TEXT,
+                byte_offset INTEGER,
+                bytes BLOB,
+                PRIMARY KEY(game_id, byte_offset),
+                FOREIGN KEY(game_id) REFERENCES games(game_id)
+            )
+        )");
     }
 
     void migrate(int toVersion) override {
@@ -207,8 +278,30 @@ public:
         return 0;
     }
 
+    StatementCacheStats getStatementCacheStats() const override {
+        std::lock_guard<std::mutex> lock(statementMutex_);
+        return statements_.stats();
+    }
+
 private:
+    // A cached statement for one *Bound call.  Holds statementMutex_ from
+    // acquire to release, so a statement is never stepped by two threads.
+    struct Lease {
+        Lease(SQLiteDatabase& owner, const std::string& sql)
+            : db(owner), lock(owner.statementMutex_)
+            , stmt(owner.db_ ? owner.statements_.acquire(owner.db_, sql) : nullptr) {}
+        ~Lease() { if (stmt) db.statements_.release(stmt); }
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        SQLiteDatabase& db;
+        std::lock_guard<std::mutex> lock;
+        sqlite3_stmt* stmt;
+    };
+
     sqlite3* db_;
+    StatementCache statements_;
+    mutable std::mutex statementMutex_;
 };
 
 Database::Database(const DatabaseConfig& config) : config_(config) {}
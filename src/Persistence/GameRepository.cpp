@@ -17,42 +17,63 @@ int64_t toUnixTime(std::chrono::system_clock::time_point tp) {
 GameRepository::GameRepository(Database* database) : database_(database) {}
 
 bool GameRepository::saveGame(const game::GameState& state) {
-    if (!database_ || !database_->isConnected()) return false;
-    std::string json = state.toJson();
-    int64_t now = toUnixTime(std::chrono::system_clock::now());
-    std::string status = "active";
+    return writeGame(captureGame(state));
+}
+
+GameWrite GameRepository::captureGame(const game::GameState& state) {
+    GameWrite write;
+    write.gameId = state.getGameId();
+    write.json = state.toJson();
+    write.snapshot = state.toSnapshot();
+    write.status = "active";
     if (state.getPhase() == game::GamePhase::GAME_ENDED)
-        status = "ended";
+        write.status = "ended";
     else if (state.getPhase() == game::GamePhase::ROUND_ENDED)
-        status = "round_ended";
+        write.status = "round_ended";
+    for (const core::Player* p : state.getAllPlayers())
+        if (p) write.playerIds.push_back(p->getId());
+    return write;
+}
 
+bool GameRepository::writeGame(const GameWrite& write) {
+    if (!database_ || !database_->isConnected()) return false;
+    int64_t now = toUnixTime(std::chrono::system_clock::now());
     if (!database_->executeBound(
             "INSERT OR REPLACE INTO games"
-            " (game_id, game_state, rule_variant, created_at, updated_at, status)"
-            " VALUES (?, ?, 'nigerian', ?, ?, ?)",
-            {state.getGameId(), json, now, now, status}))
+            " (game_id, game_state, rule_variant, created_at, updated_at, status,"
+            "  game_snapshot)"
+            " VALUES (?, ?, 'nigerian', ?, ?, ?, ?)",
+            {write.gameId, write.json, now, now, write.status, SqlBlob{write.snapshot}}))
         return false;
 
     database_->executeBound(
-        "DELETE FROM game_players WHERE game_id = ?", {state.getGameId()});
-    try {
-        auto jo = nlohmann::json::parse(json);
-        if (jo.contains("players") && jo["players"].is_array()) {
-            for (const auto& pj : jo["players"]) {
-                if (pj.contains("id")) {
-                    database_->executeBound(
-                        "INSERT OR IGNORE INTO game_players (game_id, player_id)"
-                        " VALUES (?, ?)",
-                        {state.getGameId(), pj["id"].get<std::string>()});
-                }
-            }
-        }
-    } catch (...) {}
-    return true;
+        "DELETE FROM game_players WHERE game_id = ?", {write.gameId});
+    for (const std::string& playerId : write.playerIds) {
+        database_->executeBound(
+            "INSERT OR IGNORE INTO game_players (game_id, player_id)"
+            " VALUES (?, ?)",
+            {write.gameId, playerId});
+    }
+    if (write.journal.bytes.empty()) return true;
+    // The journal only grows, so each save stores just its new bytes as one
+    // chunk keyed by where they start.
+    if (write.journal.offset == 0)
+        database_->executeBound("DELETE FROM game_journal WHERE game_id = ?", {write.gameId});
+    return database_->executeBound(
+        "INSERT OR REPLACE INTO game_journal (game_id, byte_offset, bytes) VALUES (?, ?, ?)",
+        {write.gameId, static_cast<int64_t>(write.journal.offset), SqlBlob{write.journal.bytes}});
 }
 
 std::optional<game::GameState> GameRepository::loadGame(const std::string& gameId) {
     if (!database_ || !database_->isConnected()) return std::nullopt;
+    // The snapshot resumes play exactly; the JSON (no deck order or discard
+    // pile) is the fallback for rows written before snapshots existed.
+    auto snapshot = database_->queryOneBound(
+        "SELECT game_snapshot FROM games WHERE game_id = ? LIMIT 1", {gameId});
+    if (snapshot) {
+        if (auto ptr = game::GameState::fromSnapshot(*snapshot))
+            return std::optional<game::GameState>(std::move(*ptr));
+    }
     auto json = database_->queryOneBound(
         "SELECT game_state FROM games WHERE game_id = ? LIMIT 1", {gameId});
     if (!json) return std::nullopt;
@@ -65,10 +86,28 @@ bool GameRepository::updateGame(const game::GameState& state) {
     return saveGame(state);
 }
 
+std::optional<game::GameJournal> GameRepository::loadJournal(const std::string& gameId) {
+    if (!database_ || !database_->isConnected()) return std::nullopt;
+    const auto offsets = database_->queryManyBound(
+        "SELECT byte_offset FROM game_journal WHERE game_id = ? ORDER BY byte_offset", {gameId});
+    const auto chunks = database_->queryManyBound(
+        "SELECT bytes FROM game_journal WHERE game_id = ? ORDER BY byte_offset", {gameId});
+    if (chunks.empty() || chunks.size() != offsets.size()) return std::nullopt;
+    std::string bytes;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        // A failed write leaves a gap; what follows it cannot be trusted.
+        if (offsets[i] != std::to_string(bytes.size())) return std::nullopt;
+        bytes += chunks[i];
+    }
+    return game::GameJournal::fromBytes(bytes);
+}
+
 bool GameRepository::deleteGame(const std::string& gameId) {
     if (!database_) return false;
     database_->executeBound(
         "DELETE FROM game_players WHERE game_id = ?", {gameId});
+    database_->executeBound(
+        "DELETE FROM game_journal WHERE game_id = ?", {gameId});
     return database_->executeBound(
         "DELETE FROM games WHERE game_id = ?", {gameId});
 }
@@ -167,6 +206,10 @@ void GameRepository::deleteOldGames(int daysOld) {
         "DELETE FROM game_players WHERE game_id IN"
         " (SELECT game_id FROM games WHERE updated_at < ?)",
         {cutoff});
+    database_->executeBound(
+        "DELETE FROM game_journal WHERE game_id IN"
+        " (SELECT game_id FROM games WHERE updated_at < ?)",
+        {cutoff});
     database_->executeBound(
         "DELETE FROM games WHERE updated_at < ?", {cutoff});
 }
@@ -0,0 +1,239 @@
+#include "../../include/Persistence/WriteBehindQueue.hpp"
+#include "Utils/Logger.hpp"
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace whot::persistence {
+
+namespace {
+
+// Journal bytes are increments, not a last-write-wins value: `newer` takes
+// over `older` ahead of its own bytes, unless it starts the journal afresh.
+void prependJournal(game::GameJournal::Suffix& newer, game::GameJournal::Suffix&& older) {
+    if (older.bytes.empty()) return;
+    if (!newer.bytes.empty() && newer.offset == 0) return;
+    older.bytes += newer.bytes;
+    newer = std::move(older);
+}
+
+}  // namespace
+
+WriteBehindQueue::WriteBehindQueue(Database& database, GameRepository& games,
+                                   const WriteQueueConfig& config)
+    : database_(database), games_(games), config_(config)
+{
+    if (config_.capacity == 0) config_.capacity = 1;
+}
+
+WriteBehindQueue::~WriteBehindQueue() {
+    stop();
+}
+
+void WriteBehindQueue::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_ || writerActive_) return;
+    running_ = true;
+    writerActive_ = true;
+    thread_ = std::thread([this] { run(); });
+}
+
+void WriteBehindQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        running_ = false;
+    }
+    writerCv_.notify_all();
+    committedCv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+}
+
+bool WriteBehindQueue::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+void WriteBehindQueue::saveGame(const game::GameState& state, game::GameJournal::Suffix journal) {
+    Item item;
+    item.write = GameRepository::captureGame(state);
+    item.write->journal = std::move(journal);
+    item.gameId = item.write->gameId;
+    std::unique_lock<std::mutex> lock(mutex_);
+    enqueue(std::move(item), lock);
+}
+
+void WriteBehindQueue::deleteGame(const std::string& gameId) {
+    Item item;
+    item.gameId = gameId;
+    std::unique_lock<std::mutex> lock(mutex_);
+    enqueue(std::move(item), lock);
+}
+
+void WriteBehindQueue::post(std::function<void()> write) {
+    if (!write) return;
+    Item item;
+    item.task = std::move(write);
+    std::unique_lock<std::mutex> lock(mutex_);
+    enqueue(std::move(item), lock);
+}
+
+void WriteBehindQueue::enqueue(Item item, std::unique_lock<std::mutex>& lock) {
+    ++stats_.enqueued;
+    if (!item.gameId.empty()) {
+        auto unsaved = unsavedJournals_.find(item.gameId);
+        if (unsaved != unsavedJournals_.end()) {
+            if (item.write) prependJournal(item.write->journal, std::move(unsaved->second));
+            unsavedJournals_.erase(unsaved);
+        }
+        auto slot = gameSlots_.find(item.gameId);
+        if (running_ && slot != gameSlots_.end()) {
+            Item& pending = pending_[slot->second];
+            if (pending.write) {
+                ++stats_.coalesced;
+                if (item.write) prependJournal(item.write->journal, std::move(pending.write->journal));
+            }
+            pending.write = std::move(item.write);
+            ++enqueuedSeq_;
+            return;
+        }
+    }
+    while (running_ && pending_.size() >= config_.capacity) {
+        flushRequested_ = true;
+        writerCv_.notify_one();
+        committedCv_.wait(lock);
+    }
+    if (!running_) {
+        // Inline, but never ahead of a final batch still being written.
+        committedCv_.wait(lock, [this] { return !writerActive_; });
+        lock.unlock();
+        const bool ok = execute(item);
+        lock.lock();
+        ++stats_.written;
+        if (!ok) {
+            ++stats_.failed;
+            keepJournal(item);
+        }
+        return;
+    }
+    if (!item.gameId.empty()) gameSlots_.emplace(item.gameId, pending_.size());
+    pending_.push_back(std::move(item));
+    ++enqueuedSeq_;
+    if (pending_.size() == 1) writerCv_.notify_one();
+}
+
+void WriteBehindQueue::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const uint64_t target = enqueuedSeq_;
+    if (!running_ || committedSeq_ >= target) return;
+    flushRequested_ = true;
+    writerCv_.notify_one();
+    committedCv_.wait(lock, [&] { return committedSeq_ >= target || !writerActive_; });
+}
+
+size_t WriteBehindQueue::pendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+WriteBehindQueue::Stats WriteBehindQueue::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void WriteBehindQueue::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        writerCv_.wait(lock, [this] { return !running_ || !pending_.empty(); });
+        if (running_ && !flushRequested_) {
+            writerCv_.wait_for(lock, config_.flushInterval,
+                               [this] { return !running_ || flushRequested_; });
+        }
+        if (pending_.empty()) {
+            if (!running_) break;
+            continue;
+        }
+        std::vector<Item> batch;
+        batch.swap(pending_);
+        gameSlots_.clear();
+        flushRequested_ = false;
+        const uint64_t seq = enqueuedSeq_;
+
+        lock.unlock();
+        bool committed = false;
+        const uint64_t failed = writeBatch(batch, committed);
+        lock.lock();
+
+        committedSeq_ = seq;
+        stats_.written += batch.size();
+        stats_.failed += failed;
+        if (committed) ++stats_.batches;
+        else ++stats_.rolledBack;
+        if (failed != 0)
+            for (Item& item : batch)
+                if (item.failed) keepJournal(item);
+        committedCv_.notify_all();
+    }
+    writerActive_ = false;
+    committedCv_.notify_all();
+}
+
+uint64_t WriteBehindQueue::writeBatch(std::vector<Item>& batch, bool& committed) {
+    // Without a transaction each statement still commits on its own.
+    const bool inTransaction = database_.beginTransaction();
+    if (!inTransaction)
+        LOG_ERROR("Write-behind BEGIN failed; writing " + std::to_string(batch.size()) +
+                  " items without a transaction");
+    uint64_t failed = 0;
+    for (Item& item : batch) {
+        item.failed = !execute(item);
+        failed += item.failed ? 1 : 0;
+    }
+    committed = !inTransaction || database_.commit();
+    if (committed) return failed;
+
+    LOG_ERROR("Write-behind COMMIT failed; rolled back " + std::to_string(batch.size()) + " items");
+    if (!database_.rollback()) LOG_ERROR("Write-behind ROLLBACK failed");
+    uint64_t gameWrites = 0;
+    for (Item& item : batch) {
+        item.failed = item.write.has_value();
+        gameWrites += item.failed ? 1 : 0;
+    }
+    return gameWrites;
+}
+
+void WriteBehindQueue::keepJournal(Item& item) {
+    if (!item.write || item.write->journal.bytes.empty()) return;
+    game::GameJournal::Suffix journal = std::move(item.write->journal);
+    auto slot = gameSlots_.find(item.gameId);
+    if (slot != gameSlots_.end()) {
+        // A pending delete drops the journal with the game.
+        Item& pending = pending_[slot->second];
+        if (pending.write) prependJournal(pending.write->journal, std::move(journal));
+        return;
+    }
+    game::GameJournal::Suffix& unsaved = unsavedJournals_[item.gameId];
+    prependJournal(unsaved, std::move(journal));
+}
+
+bool WriteBehindQueue::execute(Item& item) {
+    if (item.task) {
+        try {
+            item.task();
+        } catch (const std::exception& e) {
+            LOG_ERROR(std::string("Persistence task failed: ") + e.what());
+        } catch (...) {
+            LOG_ERROR("Persistence task failed with unknown exception");
+        }
+        return true;
+    }
+    if (!item.write) {
+        games_.deleteGame(item.gameId);
+        return true;
+    }
+    if (games_.writeGame(*item.write)) return true;
+    LOG_ERROR("Failed to persist game " + item.gameId);
+    return false;
+}
+
+} // namespace whot::persistence
@@ -26,13 +26,9 @@ bool NigerianRules::canPlayCard(const core::Card& card,
                                 const core::Player& player,
                                 std::optional<core::Suit> demandedSuit) const {
     (void)player;
-    // Whot cards can play on anything
-    if (card.isWhotCard()) return true;
-    // If a suit is demanded (after Whot), must match that suit
-    if (demandedSuit.has_value())
-        return card.matchesSuit(demandedSuit.value());
-    // Otherwise match suit OR number
-    return card.canPlayOn(callCard);
+    // Whot cards play on anything; a demanded suit (after Whot) must be
+    // matched; otherwise match suit OR number. See PLAYABLE_ON(_DEMAND).
+    return core::isPlayableOn(card.getIdentity(), callCard.getIdentity(), demandedSuit);
 }
 
 bool NigerianRules::canDefendAgainstAttack(const core::Card& attackCard,
@@ -45,19 +41,31 @@ bool NigerianRules::canDefendAgainstAttack(const core::Card& attackCard,
     return false;
 }
 
-bool NigerianRules::validateDoubleDecking(const std::vector<const core::Card*>& cards,
+core::CardMask NigerianRules::playableMask(const core::Card& callCard,
+                                           std::optional<core::Suit> demandedSuit) const {
+    return core::playableOnMask(callCard, demandedSuit);
+}
+
+core::CardMask NigerianRules::defenseMask(const core::Card& attackCard) const {
+    const core::CardValue v = attackCard.getValue();
+    if (v == core::CardValue::TWO || v == core::CardValue::FIVE)
+        return core::valueMask(v);
+    return core::CardMask();
+}
+
+bool NigerianRules::validateDoubleDecking(const std::vector<core::Card>& cards,
                                           const core::Card& callCard) const {
     if (cards.empty()) return false;
     if (!allowDoubleDecking_) return false;
     // First card must match the call card
-    if (!cards.front()->canPlayOn(callCard)) return false;
-    int firstNum = cards.front()->isStarCard()
-        ? cards.front()->getOuterStarValue()
-        : cards.front()->getNumericValue();
+    if (!cards.front().canPlayOn(callCard)) return false;
+    int firstNum = cards.front().isStarCard()
+        ? cards.front().getOuterStarValue()
+        : cards.front().getNumericValue();
     for (size_t i = 1; i < cards.size(); ++i) {
-        int num = cards[i]->isStarCard()
-            ? cards[i]->getOuterStarValue()
-            : cards[i]->getNumericValue();
+        int num = cards[i].isStarCard()
+            ? cards[i].getOuterStarValue()
+            : cards[i].getNumericValue();
         if (num != firstNum) return false;
     }
     return true;
@@ -0,0 +1,98 @@
+#include "../../include/Utils/ByteStream.hpp"
+
+namespace whot::utils {
+
+namespace {
+constexpr int kMaxVarintBytes = 10;  // ceil(64 / 7)
+}  // namespace
+
+void ByteWriter::u64(uint64_t value) {
+    for (int i = 0; i < 8; ++i) out_.push_back(static_cast<char>(value >> (8 * i)));
+}
+
+void ByteWriter::varint(uint64_t value) {
+    while (value >= 0x80) {
+        out_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out_.push_back(static_cast<char>(value));
+}
+
+void ByteWriter::svarint(int64_t value) {
+    varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void ByteWriter::str(std::string_view value) {
+    varint(value.size());
+    out_.append(value);
+}
+
+uint8_t ByteReader::u8() {
+    if (!ok_ || pos_ >= in_.size()) {
+        ok_ = false;
+        return 0;
+    }
+    return static_cast<uint8_t>(in_[pos_++]);
+}
+
+uint64_t ByteReader::u64() {
+    const std::string_view raw = bytes(8);
+    uint64_t value = 0;
+    for (size_t i = 0; i < raw.size(); ++i)
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(raw[i])) << (8 * i);
+    return value;
+}
+
+uint64_t ByteReader::varint() {
+    uint64_t value = 0;
+    for (int i = 0; i < kMaxVarintBytes; ++i) {
+        const uint8_t byte = u8();
+        if (!ok_) return 0;
+        value |= static_cast<uint64_t>(byte & 0x7F) << (7 * i);
+        if (!(byte & 0x80)) return value;
+    }
+    ok_ = false;
+    return 0;
+}
+
+int64_t ByteReader::svarint() {
+    const uint64_t raw = varint();
+    return static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+}
+
+std::string_view ByteReader::str() {
+    const uint64_t size = varint();
+    if (size > in_.size()) {
+        ok_ = false;
+        return {};
+    }
+    return bytes(static_cast<size_t>(size));
+}
+
+std::string_view ByteReader::bytes(size_t size) {
+    if (!ok_ || size > in_.size() - pos_) {
+        ok_ = false;
+        return {};
+    }
+    std::string_view value = in_.substr(pos_, size);
+    pos_ += size;
+    return value;
+}
+
+std::string_view ByteReader::rest() {
+    if (!ok_) return {};
+    std::string_view value = in_.substr(pos_);
+    pos_ = in_.size();
+    return value;
+}
+
+uint64_t checksum64(std::string_view data) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (char c : data) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+} // namespace whot::utils
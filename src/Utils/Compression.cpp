@@ -0,0 +1,115 @@
+#include "../../include/Utils/Compression.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <zlib.h>
+
+namespace whot::utils {
+
+namespace {
+// windowBits 15 plus 16 selects the gzip wrapper instead of raw zlib.
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kZlibWindowBits = 15;
+constexpr size_t kChunkBytes = 16 * 1024;
+// avail_in/avail_out are 32-bit; larger buffers are fed in steps of this.
+constexpr size_t kMaxStepBytes = size_t{1} << 30;
+
+int windowBitsFor(Compression::Format format) {
+    return format == Compression::Format::GZIP ? kGzipWindowBits : kZlibWindowBits;
+}
+
+/// deflateInit2 allocates ~256 KiB of window and hash tables; keep one per
+/// thread and deflateReset it while the format and level stay the same.
+class ThreadDeflater {
+public:
+    ~ThreadDeflater() {
+        if (initialized_) deflateEnd(&zs_);
+    }
+
+    z_stream& acquire(Compression::Format format, int level) {
+        if (initialized_ && format == format_ && level == level_) {
+            deflateReset(&zs_);
+            return zs_;
+        }
+        if (initialized_) deflateEnd(&zs_);
+        zs_ = z_stream{};
+        initialized_ = deflateInit2(&zs_, level, Z_DEFLATED, windowBitsFor(format), 8,
+                                    Z_DEFAULT_STRATEGY) == Z_OK;
+        if (!initialized_) throw std::runtime_error("deflateInit2 failed");
+        format_ = format;
+        level_ = level;
+        return zs_;
+    }
+
+private:
+    z_stream zs_{};
+    bool initialized_ = false;
+    Compression::Format format_ = Compression::Format::GZIP;
+    int level_ = 0;
+};
+
+std::string inflateWith(std::string_view data, int windowBits, const char* what) {
+    z_stream zs{};
+    if (inflateInit2(&zs, windowBits) != Z_OK)
+        throw std::runtime_error("inflateInit2 failed");
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    zs.avail_in = static_cast<uInt>(data.size());
+    std::string out;
+    char buf[kChunkBytes];
+    int rc;
+    do {
+        zs.next_out = reinterpret_cast<Bytef*>(buf);
+        zs.avail_out = sizeof(buf);
+        rc = ::inflate(&zs, Z_NO_FLUSH);
+        if (rc != Z_OK && rc != Z_STREAM_END) {
+            inflateEnd(&zs);
+            throw std::runtime_error(std::string("corrupt ") + what + " stream");
+        }
+        out.append(buf, sizeof(buf) - zs.avail_out);
+    } while (rc != Z_STREAM_END && (zs.avail_in > 0 || zs.avail_out == 0));
+    inflateEnd(&zs);
+    if (rc != Z_STREAM_END) throw std::runtime_error(std::string("truncated ") + what + " stream");
+    return out;
+}
+}  // namespace
+
+std::string Compression::compress(std::string_view data, Format format, int level) {
+    thread_local ThreadDeflater deflater;
+    z_stream& zs = deflater.acquire(format, level);
+    // Deflates straight into `out`, growing it as needed; JSON and text
+    // usually shrink 4x or better.
+    std::string out(data.size() / 4 + 64, '\0');
+    size_t consumed = 0;
+    size_t produced = 0;
+    int rc;
+    do {
+        if (zs.avail_in == 0 && consumed < data.size()) {
+            const size_t step = std::min(data.size() - consumed, kMaxStepBytes);
+            zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data() + consumed));
+            zs.avail_in = static_cast<uInt>(step);
+            consumed += step;
+        }
+        if (produced == out.size()) out.resize(out.size() * 2);
+        const size_t room = std::min(out.size() - produced, kMaxStepBytes);
+        zs.next_out = reinterpret_cast<Bytef*>(out.data() + produced);
+        zs.avail_out = static_cast<uInt>(room);
+        rc = deflate(&zs, consumed == data.size() ? Z_FINISH : Z_NO_FLUSH);
+        if (rc == Z_STREAM_ERROR) throw std::runtime_error("deflate failed");
+        produced += room - zs.avail_out;
+    } while (rc != Z_STREAM_END);
+    out.resize(produced);
+    return out;
+}
+
+std::string Compression::gzip(std::string_view data, int level) {
+    return compress(data, Format::GZIP, level);
+}
+
+std::string Compression::gunzip(std::string_view data) {
+    return inflateWith(data, kGzipWindowBits, "gzip");
+}
+
+std::string Compression::inflate(std::string_view data) {
+    return inflateWith(data, kZlibWindowBits, "deflate");
+}
+
+} // namespace whot::utils
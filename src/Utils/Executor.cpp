@@ -0,0 +1,153 @@
+#include "../../include/Utils/Executor.hpp"
+#include "Utils/Logger.hpp"
+#include <exception>
+
+namespace whot::utils {
+
+namespace {
+// Tasks a strand runs before yielding its worker back to other strands.
+constexpr size_t kStrandBatchSize = 16;
+
+thread_local const Strand* tlsCurrentStrand = nullptr;
+
+void runGuarded(Task& task) {
+    try {
+        task();
+    } catch (const std::exception& e) {
+        LOG_ERROR(std::string("Executor task failed: ") + e.what());
+    } catch (...) {
+        LOG_ERROR("Executor task failed with unknown exception");
+    }
+}
+}  // namespace
+
+WorkerPool::WorkerPool(size_t threadCount)
+    : threadCount_(threadCount), running_(false), stopping_(false)
+{
+    if (threadCount_ == 0) threadCount_ = std::thread::hardware_concurrency();
+    if (threadCount_ == 0) threadCount_ = 1;
+}
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+void WorkerPool::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) return;
+    stopping_ = false;
+    running_ = true;
+    workers_.reserve(threadCount_);
+    for (size_t i = 0; i < threadCount_; ++i)
+        workers_.emplace_back([this] { workerLoop(); });
+}
+
+void WorkerPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : workers_)
+        if (t.joinable()) t.join();
+    workers_.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    stopping_ = false;
+}
+
+bool WorkerPool::isRunning() const { return running_; }
+
+size_t WorkerPool::getThreadCount() const { return threadCount_; }
+
+void WorkerPool::submit(Task task) {
+    if (!task) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            queue_.push_back(std::move(task));
+            cv_.notify_one();
+            return;
+        }
+    }
+    runGuarded(task);
+}
+
+void WorkerPool::workerLoop() {
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) return;  // stopping and fully drained
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        runGuarded(task);
+    }
+}
+
+Strand::Strand(WorkerPool& pool)
+    : pool_(pool), active_(false)
+{
+}
+
+void Strand::post(Task task) {
+    if (!task) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(task));
+        if (active_) return;  // the current drainer will pick it up
+        active_ = true;
+    }
+    pool_.submit([self = shared_from_this()] { self->drain(); });
+}
+
+void Strand::dispatch(Task task) {
+    if (runningInThisThread()) {
+        runGuarded(task);
+        return;
+    }
+    post(std::move(task));
+}
+
+bool Strand::runningInThisThread() const {
+    return tlsCurrentStrand == this;
+}
+
+size_t Strand::pendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+void Strand::drain() {
+    const Strand* previous = tlsCurrentStrand;
+    tlsCurrentStrand = this;
+    // Inline (pool stopped) drains run to completion so callers observe the
+    // effects of what they posted; pooled drains yield after a batch.
+    const bool pooled = pool_.isRunning();
+    bool yielded = false;
+    for (size_t ran = 0;; ++ran) {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queue_.empty()) {
+                active_ = false;
+                break;
+            }
+            if (pooled && ran == kStrandBatchSize) {
+                yielded = true;  // stay active_ so posts keep queueing
+                break;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        runGuarded(task);
+    }
+    tlsCurrentStrand = previous;
+    if (yielded)
+        pool_.submit([self = shared_from_this()] { self->drain(); });
+}
+
+} // namespace whot::utils
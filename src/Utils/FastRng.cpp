@@ -0,0 +1,43 @@
+#include "../../include/Utils/FastRng.hpp"
+#include <atomic>
+#include <chrono>
+#include <random>
+
+namespace whot::utils {
+
+namespace {
+constexpr uint64_t kGoldenGamma = 0x9E3779B97F4A7C15ULL;
+
+uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += kGoldenGamma);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t processEntropy() {
+    std::random_device rd;
+    const uint64_t hi = rd();
+    const uint64_t lo = rd();
+    const auto now = static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+    return ((hi << 32) | lo) ^ now;
+}
+}  // namespace
+
+FastRng::FastRng(uint64_t seed) {
+    this->seed(seed);
+}
+
+void FastRng::seed(uint64_t seed) {
+    uint64_t state = seed;
+    for (uint64_t& word : s_) word = splitmix64(state);
+}
+
+uint64_t FastRng::freshSeed() {
+    static std::atomic<uint64_t> counter{processEntropy()};
+    uint64_t state = counter.fetch_add(kGoldenGamma, std::memory_order_relaxed);
+    return splitmix64(state);
+}
+
+} // namespace whot::utils
@@ -120,4 +120,45 @@ std::string JsonSerializer::unescape(const std::string& str) {
     }
 }
 
+JsonWriter& JsonWriter::key(std::string_view name) {
+    separate();
+    appendEscaped(out_, name);
+    out_.push_back(':');
+    needComma_ = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::string_view str) {
+    separate();
+    appendEscaped(out_, str);
+    return *this;
+}
+
+void JsonWriter::appendEscaped(std::string& out, std::string_view str) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    out.push_back('"');
+    size_t run = 0;  // start of the pending span that needs no escaping
+    for (size_t i = 0; i < str.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(str[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        out.append(str.data() + run, i - run);
+        run = i + 1;
+        switch (c) {
+            case '"': out.append("\\\""); break;
+            case '\\': out.append("\\\\"); break;
+            case '\n': out.append("\\n"); break;
+            case '\r': out.append("\\r"); break;
+            case '\t': out.append("\\t"); break;
+            case '\b': out.append("\\b"); break;
+            case '\f': out.append("\\f"); break;
+            default:
+                out.append("\\u00");
+                out.push_back(kHex[c >> 4]);
+                out.push_back(kHex[c & 0xF]);
+        }
+    }
+    out.append(str.data() + run, str.size() - run);
+    out.push_back('"');
+}
+
 } // namespace whot::utils
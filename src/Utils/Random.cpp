@@ -1,28 +1,77 @@
 #include "../../include/Utils/Random.hpp"
-#include <random>
-#include <sstream>
-#include <iomanip>
-#include <chrono>
+#include "Utils/FastRng.hpp"
+#include <atomic>
 
 namespace whot::utils {
 
+namespace {
+// A thread's stream is stale once the epoch moves; it reseeds on next draw.
+struct StreamRegistry {
+    std::atomic<uint64_t> baseSeed{FastRng::freshSeed()};
+    std::atomic<uint64_t> epoch{1};
+    std::atomic<uint64_t> nextStream{0};
+};
+
+StreamRegistry& registry() {
+    static StreamRegistry r;
+    return r;
+}
+
+struct ThreadStream {
+    FastRng rng;
+    uint64_t epoch = 0;
+};
+
+thread_local ThreadStream tlsStream;
+
+uint64_t streamSeed(uint64_t base, uint64_t streamId) {
+    // FastRng::seed runs splitmix64 over this, so adjacent ids decorrelate.
+    return base ^ (streamId * 0xD1B54A32D192ED03ULL);
+}
+
+void bindStream(uint64_t streamId) {
+    StreamRegistry& r = registry();
+    tlsStream.epoch = r.epoch.load(std::memory_order_acquire);
+    tlsStream.rng.seed(streamSeed(r.baseSeed.load(std::memory_order_relaxed), streamId));
+}
+
+FastRng& threadRng() {
+    StreamRegistry& r = registry();
+    if (tlsStream.epoch != r.epoch.load(std::memory_order_acquire))
+        bindStream(r.nextStream.fetch_add(1, std::memory_order_relaxed));
+    return tlsStream.rng;
+}
+
+void resetStreams(uint64_t base) {
+    StreamRegistry& r = registry();
+    r.baseSeed.store(base, std::memory_order_relaxed);
+    r.nextStream.store(1, std::memory_order_relaxed);  // 0 goes to the caller
+    r.epoch.fetch_add(1, std::memory_order_release);
+    bindStream(0);
+}
+}  // namespace
+
 Random& Random::getInstance() {
     static Random instance;
     return instance;
 }
 
-Random::Random() : generator_(static_cast<unsigned>(std::random_device{}())) {}
+Random::Random() = default;
 
 int Random::nextInt(int min, int max) {
     if (min >= max) return min;
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(generator_);
+    const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+    const uint64_t offset = span > UINT32_MAX
+        ? threadRng()() >> 32  // full int range
+        : threadRng().below(static_cast<uint32_t>(span));
+    return static_cast<int>(min + static_cast<int64_t>(offset));
 }
 
 double Random::nextDouble(double min, double max) {
     if (min >= max) return min;
-    std::uniform_real_distribution<double> dist(min, max);
-    return dist(generator_);
+    // Top 53 bits -> uniform in [0, 1).
+    const double unit = static_cast<double>(threadRng()() >> 11) * 0x1.0p-53;
+    return min + unit * (max - min);
 }
 
 bool Random::nextBool(double probability) {
@@ -31,44 +80,47 @@ bool Random::nextBool(double probability) {
 
 std::string Random::generateId(size_t length) {
     static const char chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
-    std::string out;
-    out.reserve(length);
-    for (size_t i = 0; i < length; ++i)
-        out += chars[nextInt(0, static_cast<int>(sizeof(chars) - 2))];
+    FastRng& rng = threadRng();
+    std::string out(length, '\0');
+    for (char& c : out)
+        c = chars[rng.below(sizeof(chars) - 1)];
     return out;
 }
 
 std::string Random::generateGameCode(size_t length) {
     static const char chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-    std::string out;
-    out.reserve(length);
-    for (size_t i = 0; i < length; ++i)
-        out += chars[nextInt(0, static_cast<int>(sizeof(chars) - 2))];
+    FastRng& rng = threadRng();
+    std::string out(length, '\0');
+    for (char& c : out)
+        c = chars[rng.below(sizeof(chars) - 1)];
     return out;
 }
 
 std::string Random::generateUUID() {
-    std::ostringstream oss;
-    oss << std::hex;
-    std::uniform_int_distribution<int> nibble(0, 15);
-    auto putHex = [&](int digits) {
-        for (int i = 0; i < digits; ++i)
-            oss << nibble(generator_);
-    };
-    putHex(8);  oss << '-';
-    putHex(4);  oss << '-';
-    putHex(4);  oss << '-';
-    putHex(4);  oss << '-';
-    putHex(12);
-    return oss.str();
+    // 8-4-4-4-12 lowercase hex; 32 nibbles from two 64-bit draws.
+    static const char hex[] = "0123456789abcdef";
+    FastRng& rng = threadRng();
+    uint64_t bits[2] = {rng(), rng()};
+    std::string out(36, '-');
+    size_t nibble = 0;
+    for (size_t i = 0; i < out.size(); ++i) {
+        if (i == 8 || i == 13 || i == 18 || i == 23) continue;
+        out[i] = hex[(bits[nibble / 16] >> ((nibble % 16) * 4)) & 0xF];
+        ++nibble;
+    }
+    return out;
 }
 
 void Random::seed(unsigned int seed) {
-    generator_.seed(seed);
+    resetStreams(seed);
+}
+
+void Random::seedStream(uint64_t streamId) {
+    bindStream(streamId);
 }
 
 void Random::randomSeed() {
-    generator_.seed(static_cast<unsigned>(std::random_device{}()));
+    resetStreams(FastRng::freshSeed());
 }
 
 } // namespace whot::utils
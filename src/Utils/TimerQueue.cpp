@@ -0,0 +1,104 @@
+#include "../../include/Utils/TimerQueue.hpp"
+#include "Utils/Logger.hpp"
+#include <exception>
+
+namespace whot::utils {
+
+namespace {
+void fire(Task& task) {
+    try {
+        task();
+    } catch (const std::exception& e) {
+        LOG_ERROR(std::string("Timer task failed: ") + e.what());
+    } catch (...) {
+        LOG_ERROR("Timer task failed with unknown exception");
+    }
+}
+}  // namespace
+
+TimerQueue::TimerQueue()
+    : nextId_(1), running_(false)
+{
+}
+
+TimerQueue::~TimerQueue() {
+    stop();
+}
+
+void TimerQueue::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) return;
+    running_ = true;
+    thread_ = std::thread([this] { run(); });
+}
+
+void TimerQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) thread_.join();
+    std::lock_guard<std::mutex> lock(mutex_);
+    heap_ = {};
+    tasks_.clear();
+}
+
+bool TimerQueue::isRunning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+TimerQueue::TimerId TimerQueue::schedule(std::chrono::milliseconds delay, Task task) {
+    if (!task) return 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            const TimerId id = nextId_++;
+            const Clock::time_point deadline = Clock::now() + delay;
+            const bool earliest = heap_.empty() || deadline < heap_.top().deadline;
+            heap_.push(Entry{deadline, id});
+            tasks_.emplace(id, std::move(task));
+            if (earliest) cv_.notify_one();
+            return id;
+        }
+    }
+    fire(task);
+    return 0;
+}
+
+bool TimerQueue::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.erase(id) > 0;
+}
+
+size_t TimerQueue::pendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+void TimerQueue::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        if (heap_.empty()) {
+            cv_.wait(lock);
+            continue;
+        }
+        const Entry next = heap_.top();
+        if (Clock::now() < next.deadline) {
+            cv_.wait_until(lock, next.deadline);
+            continue;  // re-check: an earlier timer may have been scheduled
+        }
+        heap_.pop();
+        auto it = tasks_.find(next.id);
+        if (it == tasks_.end()) continue;  // cancelled
+        Task task = std::move(it->second);
+        tasks_.erase(it);
+        lock.unlock();
+        fire(task);
+        lock.lock();
+    }
+}
+
+} // namespace whot::utils
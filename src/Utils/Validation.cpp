@@ -33,6 +33,39 @@ bool Validator::matchesPattern(const std::string& str, const std::string& patter
     }
 }
 
+bool Validator::isValidUtf8(std::string_view str) {
+    size_t i = 0;
+    while (i < str.size()) {
+        const auto lead = static_cast<unsigned char>(str[i]);
+        if (lead < 0x80) {
+            ++i;
+            continue;
+        }
+        size_t length = 0;
+        unsigned char low = 0x80, high = 0xBF;  // allowed range of the second byte
+        if (lead >= 0xC2 && lead <= 0xDF) length = 2;
+        else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            if (lead == 0xE0) low = 0xA0;        // overlong
+            else if (lead == 0xED) high = 0x9F;  // UTF-16 surrogates
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            if (lead == 0xF0) low = 0x90;        // overlong
+            else if (lead == 0xF4) high = 0x8F;  // above U+10FFFF
+        } else {
+            return false;
+        }
+        if (str.size() - i < length) return false;
+        const auto second = static_cast<unsigned char>(str[i + 1]);
+        if (second < low || second > high) return false;
+        for (size_t k = 2; k < length; ++k) {
+            if ((static_cast<unsigned char>(str[i + k]) & 0xC0) != 0x80) return false;
+        }
+        i += length;
+    }
+    return true;
+}
+
 bool Validator::isInRange(int value, int min, int max) {
     return value >= min && value <= max;
 }
@@ -44,6 +44,18 @@ int main(int argc, char** argv) {
             config.logFilePath = argv[++i];
         } else if (arg == "--db-path" && i + 1 < argc) {
             dbPath = argv[++i];
+        } else if (arg == "--game-threads" && i + 1 < argc) {
+            config.gameWorkerThreads = static_cast<size_t>(std::stoul(argv[++i]));
+        } else if (arg == "--ws-threads" && i + 1 < argc) {
+            config.wsIoThreads = static_cast<size_t>(std::stoul(argv[++i]));
+        } else if (arg == "--http-threads" && i + 1 < argc) {
+            config.httpWorkerThreads = static_cast<size_t>(std::stoul(argv[++i]));
+        } else if (arg == "--http-max-connections" && i + 1 < argc) {
+            config.httpMaxConnections = static_cast<size_t>(std::stoul(argv[++i]));
+        } else if (arg == "--http-idle-timeout" && i + 1 < argc) {
+            config.httpIdleTimeoutSeconds = std::stoi(argv[++i]);
+        } else if (arg == "--no-http-compression") {
+            config.httpCompression = false;
         } else if (arg == "--no-ai") {
             config.enableAI = false;
         } else if (arg == "--help" || arg == "-h") {
@@ -55,6 +67,12 @@ int main(int argc, char** argv) {
             std::cout << "  --static-path PATH   Static files path (default: ./web)\n";
             std::cout << "  --log-file PATH      Log file path (default: ./logs/whot.log)\n";
             std::cout << "  --db-path PATH       SQLite DB file path (default: ./whot.db or $WHOT_DB_PATH)\n";
+            std::cout << "  --game-threads N     Worker threads running game logic (default: CPU count)\n";
+            std::cout << "  --ws-threads N       WebSocket IO threads (default: CPU count)\n";
+            std::cout << "  --http-threads N     HTTP handler threads (default: CPU count)\n";
+            std::cout << "  --http-max-connections N  Open HTTP connection cap (default: 4096)\n";
+            std::cout << "  --http-idle-timeout S  Keep-alive idle timeout in seconds (default: 65)\n";
+            std::cout << "  --no-http-compression  Send API responses uncompressed\n";
             std::cout << "  --no-ai              Disable AI players\n";
             std::cout << "  --help, -h           Show this help message\n";
             return 0;
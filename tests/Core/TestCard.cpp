@@ -17,6 +17,23 @@ TEST(TestCard, AllSuitsAndValues) {
     }
 }
 
+TEST(TestCard, PackedValue_RoundTripsEverySuitAndValue) {
+    const CardValue values[] = {
+        CardValue::ONE, CardValue::TWO, CardValue::THREE, CardValue::FOUR,
+        CardValue::FIVE, CardValue::SEVEN, CardValue::EIGHT, CardValue::TEN,
+        CardValue::ELEVEN, CardValue::TWELVE, CardValue::THIRTEEN,
+        CardValue::FOURTEEN, CardValue::TWENTY};
+    for (int s = 0; s <= static_cast<int>(Suit::WHOT); ++s) {
+        for (CardValue v : values) {
+            Card c(static_cast<Suit>(s), v);
+            Card copy = c;
+            EXPECT_EQ(copy.getSuit(), static_cast<Suit>(s));
+            EXPECT_EQ(copy.getValue(), v);
+            EXPECT_EQ(copy.getSpecialAbility(), c.getSpecialAbility());
+        }
+    }
+}
+
 TEST(TestCard, GetNumericValue) {
     Card c(Suit::CIRCLE, CardValue::FIVE);
     EXPECT_EQ(c.getNumericValue(), 5);
@@ -74,9 +91,8 @@ TEST(TestCard, OperatorEqNe) {
 TEST(TestCard, ToJsonRoundTrip) {
     Card c(Suit::CIRCLE, CardValue::FIVE);
     std::string json = c.toJson();
-    auto restored = Card::fromJson(json);
-    ASSERT_NE(restored, nullptr);
-    EXPECT_EQ(*restored, c);
+    Card restored = Card::fromJson(json);
+    EXPECT_EQ(restored, c);
 }
 
 TEST(TestCard, FromJson_EmptyString_Throws) {
@@ -101,16 +117,14 @@ TEST(TestCard, FromJson_MissingValue_Throws) {
 }
 
 TEST(TestCard, FromJson_InvalidSuitString_UsesFallback) {
-    auto card = Card::fromJson("{\"suit\": \"INVALID\", \"value\": \"FIVE\"}");
-    ASSERT_NE(card, nullptr);
-    EXPECT_EQ(card->getSuit(), Suit::CIRCLE);
-    EXPECT_EQ(card->getValue(), CardValue::FIVE);
+    Card card = Card::fromJson("{\"suit\": \"INVALID\", \"value\": \"FIVE\"}");
+    EXPECT_EQ(card.getSuit(), Suit::CIRCLE);
+    EXPECT_EQ(card.getValue(), CardValue::FIVE);
 }
 
 TEST(TestCard, FromJson_InvalidValueString_UsesFallback) {
-    auto card = Card::fromJson("{\"suit\": \"CIRCLE\", \"value\": \"NINETY\"}");
-    ASSERT_NE(card, nullptr);
-    EXPECT_EQ(card->getValue(), CardValue::ONE);
+    Card card = Card::fromJson("{\"suit\": \"CIRCLE\", \"value\": \"NINETY\"}");
+    EXPECT_EQ(card.getValue(), CardValue::ONE);
 }
 
 TEST(TestCard, FromJson_NonStringSuit_Throws) {
@@ -140,4 +154,17 @@ TEST(TestCard, ToString) {
     EXPECT_NE(s.find("10"), std::string::npos);
 }
 
+TEST(TestCard, Byte_RoundTripsAndRejectsInvalid) {
+    for (const CardSpec& spec : STANDARD_DECK) {
+        Card c(spec.suit, spec.value);
+        auto back = Card::fromByte(c.toByte());
+        ASSERT_TRUE(back.has_value());
+        EXPECT_EQ(*back, c);
+    }
+    EXPECT_FALSE(Card::fromByte(0xFF).has_value());
+    EXPECT_FALSE(Card::fromByte(0).has_value());  // circle, value 0
+    EXPECT_FALSE(Card::fromByte(static_cast<uint8_t>(6 << 5 | 1)).has_value());  // no suit 6
+    EXPECT_FALSE(Card::fromByte(static_cast<uint8_t>(0 << 5 | 6)).has_value());  // no 6
+}
+
 } // namespace whot::core
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "Core/CardMask.hpp"
+#include "Core/Card.hpp"
+#include <set>
+#include <vector>
+
+namespace whot::core {
+
+namespace {
+std::vector<Card> everyCard() {
+    const Suit suits[] = {Suit::CIRCLE, Suit::TRIANGLE, Suit::CROSS,
+                          Suit::BLOCK, Suit::STAR, Suit::WHOT};
+    const CardValue values[] = {
+        CardValue::ONE, CardValue::TWO, CardValue::THREE, CardValue::FOUR,
+        CardValue::FIVE, CardValue::SEVEN, CardValue::EIGHT, CardValue::TEN,
+        CardValue::ELEVEN, CardValue::TWELVE, CardValue::THIRTEEN,
+        CardValue::FOURTEEN, CardValue::TWENTY};
+    std::vector<Card> out;
+    for (Suit s : suits)
+        for (CardValue v : values) out.emplace_back(s, v);
+    return out;
+}
+}  // namespace
+
+TEST(TestCardMask, CardIdentity_DistinctForEveryCard) {
+    std::set<size_t> ids;
+    for (const Card& c : everyCard()) {
+        size_t id = cardIdentity(c);
+        EXPECT_LT(id, CARD_IDENTITY_COUNT);
+        ids.insert(id);
+    }
+    EXPECT_EQ(ids.size(), everyCard().size());
+}
+
+TEST(TestCardMask, SuitAndValueMasks_Partition) {
+    EXPECT_EQ(suitMask(Suit::CIRCLE).count(), VALUE_SLOTS);
+    EXPECT_EQ(valueMask(CardValue::TWO).count(), 6u);
+    EXPECT_TRUE((suitMask(Suit::CIRCLE) & suitMask(Suit::STAR)).none());
+    EXPECT_TRUE(whotMask().test(cardIdentity(Card(Suit::WHOT, CardValue::TWENTY))));
+    EXPECT_TRUE(whotMask().test(cardIdentity(Card(Suit::STAR, CardValue::TWENTY))));
+}
+
+TEST(TestCardMask, PlayableOnMask_MatchesCanPlayOn) {
+    const std::vector<Card> cards = everyCard();
+    for (const Card& call : cards) {
+        CardMask playable = playableOnMask(call);
+        for (const Card& c : cards)
+            EXPECT_EQ(playable.test(cardIdentity(c)), c.canPlayOn(call))
+                << c.toString() << " on " << call.toString();
+    }
+}
+
+TEST(TestCardMask, PlayableOnMask_DemandedSuit_OnlySuitAndWhot) {
+    Card call(Suit::WHOT, CardValue::TWENTY);
+    CardMask playable = playableOnMask(call, Suit::CROSS);
+    EXPECT_TRUE(playable.test(cardIdentity(Card(Suit::CROSS, CardValue::SEVEN))));
+    EXPECT_TRUE(playable.test(cardIdentity(Card(Suit::WHOT, CardValue::TWENTY))));
+    EXPECT_FALSE(playable.test(cardIdentity(Card(Suit::CIRCLE, CardValue::SEVEN))));
+}
+
+} // namespace whot::core
@@ -31,31 +31,32 @@ TEST(TestDeck, DrawUntilEmpty) {
     size_t count = d.size();
     for (size_t i = 0; i < count; ++i) {
         auto card = d.draw();
-        ASSERT_NE(card, nullptr);
+        ASSERT_TRUE(card.has_value());
     }
     EXPECT_TRUE(d.isEmpty());
-    EXPECT_EQ(d.draw(), nullptr);
+    EXPECT_FALSE(d.draw().has_value());
 }
 
-TEST(TestDeck, AddCardNull_NoOp) {
+TEST(TestDeck, AddCards_AppendsInOrder) {
     Deck d;
     d.clear();
-    d.addCard(nullptr);
-    EXPECT_EQ(d.size(), 0u);
+    d.addCards({Card(Suit::CIRCLE, CardValue::ONE), Card(Suit::STAR, CardValue::TWO)});
+    EXPECT_EQ(d.size(), 2u);
+    EXPECT_EQ(*d.peek(), Card(Suit::STAR, CardValue::TWO));
 }
 
-TEST(TestDeck, PeekEmpty_ReturnsNull) {
+TEST(TestDeck, PeekEmpty_ReturnsNullopt) {
     Deck d;
     d.clear();
-    EXPECT_EQ(d.peek(), nullptr);
+    EXPECT_FALSE(d.peek().has_value());
 }
 
 TEST(TestDeck, PeekNonEmpty) {
     Deck d;
     d.clear();
-    d.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::FIVE));
-    const Card* p = d.peek();
-    ASSERT_NE(p, nullptr);
+    d.addCard(Card(Suit::CIRCLE, CardValue::FIVE));
+    std::optional<Card> p = d.peek();
+    ASSERT_TRUE(p.has_value());
     EXPECT_EQ(p->getSuit(), Suit::CIRCLE);
     EXPECT_EQ(p->getValue(), CardValue::FIVE);
 }
@@ -71,12 +72,12 @@ TEST(TestDeck, ToJsonFromJson_EmptyDeck) {
 TEST(TestDeck, ToJsonFromJson_SingleCard) {
     Deck d;
     d.clear();
-    d.addCard(std::make_unique<Card>(Suit::STAR, CardValue::TWENTY));
+    d.addCard(Card(Suit::STAR, CardValue::TWENTY));
     std::string json = d.toJson();
     Deck restored = Deck::fromJson(json);
     ASSERT_EQ(restored.size(), 1u);
     auto c = restored.draw();
-    ASSERT_NE(c, nullptr);
+    ASSERT_TRUE(c.has_value());
     EXPECT_EQ(c->getSuit(), Suit::STAR);
     EXPECT_EQ(c->getValue(), CardValue::TWENTY);
 }
@@ -94,8 +95,8 @@ TEST(TestDeck, ReshuffleFromDiscardPile_Empty) {
     Deck d;
     d.clear();
     Card call(Suit::CIRCLE, CardValue::FIVE);
-    std::vector<std::unique_ptr<Card>> pile;
-    d.reshuffleFromDiscardPile(std::move(pile), call);
+    std::vector<Card> pile;
+    d.reshuffleFromDiscardPile(pile, call);
     EXPECT_EQ(d.size(), 0u);
 }
 
@@ -103,10 +104,10 @@ TEST(TestDeck, ReshuffleFromDiscardPile_WithCallCard) {
     Deck d;
     d.clear();
     Card call(Suit::CIRCLE, CardValue::FIVE);
-    std::vector<std::unique_ptr<Card>> pile;
-    pile.push_back(std::make_unique<Card>(Suit::CIRCLE, CardValue::THREE));
-    pile.push_back(std::make_unique<Card>(Suit::CIRCLE, CardValue::FIVE));
-    d.reshuffleFromDiscardPile(std::move(pile), call);
+    std::vector<Card> pile;
+    pile.push_back(Card(Suit::CIRCLE, CardValue::THREE));
+    pile.push_back(Card(Suit::CIRCLE, CardValue::FIVE));
+    d.reshuffleFromDiscardPile(pile, call);
     EXPECT_EQ(d.size(), 1u);
 }
 
@@ -125,4 +126,20 @@ TEST(TestDeck, Clear) {
     EXPECT_TRUE(d.isEmpty());
 }
 
+TEST(TestDeck, SameSeed_SameShuffle) {
+    Deck a(1, 1234);
+    Deck b(1, 1234);
+    EXPECT_EQ(a.toJson(), b.toJson());
+    a.reset();
+    b.reset();
+    EXPECT_EQ(a.toJson(), b.toJson());
+    Deck c(1, 4321);
+    EXPECT_NE(a.toJson(), c.toJson());
+}
+
+TEST(TestDeck, ZeroDecks_StartsEmpty) {
+    Deck d(0, 1);
+    EXPECT_TRUE(d.isEmpty());
+}
+
 } // namespace whot::core
@@ -68,4 +68,32 @@ TEST(TestGameConstants, StringToCardValue_Numeric) {
     EXPECT_EQ(stringToCardValue("20"), CardValue::TWENTY);
 }
 
+TEST(TestGameConstants, StandardDeck_FollowsPerSuitValueLists) {
+    size_t n = 0;
+    for (CardValue v : CIRCLE_VALUES) {
+        EXPECT_EQ(STANDARD_DECK[n].suit, Suit::CIRCLE);
+        EXPECT_EQ(STANDARD_DECK[n++].value, v);
+    }
+    n += TRIANGLE_VALUES.size() + CROSS_VALUES.size() + BLOCK_VALUES.size();
+    for (CardValue v : STAR_VALUES) {
+        EXPECT_EQ(STANDARD_DECK[n].suit, Suit::STAR);
+        EXPECT_EQ(STANDARD_DECK[n++].value, v);
+    }
+    for (; n < STANDARD_DECK.size(); ++n)
+        EXPECT_EQ(STANDARD_DECK[n].value, CardValue::TWENTY);
+}
+
+TEST(TestGameConstants, CardIdentity_RoundTripsEveryIdentity) {
+    for (size_t id = 0; id < CARD_IDENTITY_COUNT; ++id)
+        EXPECT_EQ(cardIdentity(identitySuit(id), identityValue(id)), id);
+}
+
+TEST(TestGameConstants, PlayableOnDemand_OnlyDemandedSuitOrWhot) {
+    for (size_t id = 0; id < CARD_IDENTITY_COUNT; ++id) {
+        bool expected = identitySuit(id) == Suit::TRIANGLE ||
+                        identityValue(id) == CardValue::TWENTY;
+        EXPECT_EQ(isPlayableOn(id, 0, Suit::TRIANGLE), expected);
+    }
+}
+
 } // namespace whot::core
@@ -15,62 +15,63 @@ TEST(TestHand, EmptyHand) {
 
 TEST(TestHand, AddCard) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     EXPECT_EQ(h.size(), 1u);
     EXPECT_FALSE(h.isEmpty());
 }
 
-TEST(TestHand, AddCardNull_NoOp) {
+TEST(TestHand, AddCards_AppendsAll) {
     Hand h;
-    h.addCard(nullptr);
-    EXPECT_EQ(h.size(), 0u);
+    h.addCards({Card(Suit::CIRCLE, CardValue::ONE), Card(Suit::WHOT, CardValue::TWENTY)});
+    EXPECT_EQ(h.size(), 2u);
+    EXPECT_EQ(h.getCard(1), Card(Suit::WHOT, CardValue::TWENTY));
 }
 
-TEST(TestHand, PlayCard_IndexOutOfRange_ReturnsNull) {
+TEST(TestHand, PlayCard_IndexOutOfRange_ReturnsNullopt) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
-    EXPECT_EQ(h.playCard(1), nullptr);
-    EXPECT_EQ(h.playCard(100), nullptr);
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
+    EXPECT_FALSE(h.playCard(1).has_value());
+    EXPECT_FALSE(h.playCard(100).has_value());
     EXPECT_EQ(h.size(), 1u);
 }
 
 TEST(TestHand, PlayCard_ByIndex) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     auto c = h.playCard(0);
-    ASSERT_NE(c, nullptr);
+    ASSERT_TRUE(c.has_value());
     EXPECT_EQ(c->getSuit(), Suit::CIRCLE);
     EXPECT_EQ(h.size(), 0u);
 }
 
-TEST(TestHand, PlayCard_ByCard_NotInHand_ReturnsNull) {
+TEST(TestHand, PlayCard_ByCard_NotInHand_ReturnsNullopt) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     Card other(Suit::TRIANGLE, CardValue::TWO);
-    EXPECT_EQ(h.playCard(other), nullptr);
+    EXPECT_FALSE(h.playCard(other).has_value());
     EXPECT_EQ(h.size(), 1u);
 }
 
 TEST(TestHand, PlayCard_ByCard_InHand) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     Card target(Suit::CIRCLE, CardValue::ONE);
     auto c = h.playCard(target);
-    ASSERT_NE(c, nullptr);
+    ASSERT_TRUE(c.has_value());
     EXPECT_EQ(c->getSuit(), Suit::CIRCLE);
     EXPECT_EQ(h.size(), 0u);
 }
 
 TEST(TestHand, GetCard_OutOfRange_Throws) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     EXPECT_THROW(h.getCard(1), std::out_of_range);
     EXPECT_THROW(h.getCard(100), std::out_of_range);
 }
 
 TEST(TestHand, GetCard_ValidIndex) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::BLOCK, CardValue::TEN));
+    h.addCard(Card(Suit::BLOCK, CardValue::TEN));
     const Card& c = h.getCard(0);
     EXPECT_EQ(c.getSuit(), Suit::BLOCK);
     EXPECT_EQ(c.getValue(), CardValue::TEN);
@@ -78,7 +79,7 @@ TEST(TestHand, GetCard_ValidIndex) {
 
 TEST(TestHand, GetPlayableCardIndices_None) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     Card call(Suit::TRIANGLE, CardValue::SEVEN);
     auto indices = h.getPlayableCardIndices(call);
     EXPECT_TRUE(indices.empty());
@@ -86,8 +87,8 @@ TEST(TestHand, GetPlayableCardIndices_None) {
 
 TEST(TestHand, GetPlayableCardIndices_MatchSuit) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
-    h.addCard(std::make_unique<Card>(Suit::TRIANGLE, CardValue::TWO));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::TRIANGLE, CardValue::TWO));
     Card call(Suit::TRIANGLE, CardValue::SEVEN);
     auto indices = h.getPlayableCardIndices(call);
     EXPECT_EQ(indices.size(), 1u);
@@ -96,7 +97,7 @@ TEST(TestHand, GetPlayableCardIndices_MatchSuit) {
 
 TEST(TestHand, HasPlayableCard) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::FIVE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::FIVE));
     Card call(Suit::CIRCLE, CardValue::THREE);
     EXPECT_TRUE(h.hasPlayableCard(call));
     Card call2(Suit::TRIANGLE, CardValue::EIGHT);
@@ -105,7 +106,7 @@ TEST(TestHand, HasPlayableCard) {
 
 TEST(TestHand, HasCard) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::FIVE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::FIVE));
     Card yes(Suit::CIRCLE, CardValue::FIVE);
     Card no(Suit::CIRCLE, CardValue::SEVEN);
     EXPECT_TRUE(h.hasCard(yes));
@@ -119,8 +120,8 @@ TEST(TestHand, CalculateTotalScore_Empty) {
 
 TEST(TestHand, CalculateTotalScore_WithCards) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::FIVE));
-    h.addCard(std::make_unique<Card>(Suit::STAR, CardValue::FIVE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::FIVE));
+    h.addCard(Card(Suit::STAR, CardValue::FIVE));
     int score = h.calculateTotalScore();
     EXPECT_GE(score, 5 + 10);
 }
@@ -134,19 +135,45 @@ TEST(TestHand, ToJsonFromJson_RoundTrip) {
 
 TEST(TestHand, GetCardsBySuit) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::TWO));
-    h.addCard(std::make_unique<Card>(Suit::TRIANGLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::CIRCLE, CardValue::TWO));
+    h.addCard(Card(Suit::TRIANGLE, CardValue::ONE));
     auto circle = h.getCardsBySuit(Suit::CIRCLE);
     EXPECT_EQ(circle.size(), 2u);
 }
 
 TEST(TestHand, GetWhotCards) {
     Hand h;
-    h.addCard(std::make_unique<Card>(Suit::WHOT, CardValue::TWENTY));
-    h.addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    h.addCard(Card(Suit::WHOT, CardValue::TWENTY));
+    h.addCard(Card(Suit::CIRCLE, CardValue::ONE));
     auto whots = h.getWhotCards();
     EXPECT_EQ(whots.size(), 1u);
 }
 
+TEST(TestHand, CardMask_TracksDuplicatesThroughPlay) {
+    Hand h;
+    Card whot(Suit::WHOT, CardValue::TWENTY);
+    h.addCards({whot, whot, Card(Suit::CIRCLE, CardValue::ONE)});
+    EXPECT_EQ(h.countOf(whot), 2u);
+    EXPECT_EQ(h.getCardMask().count(), 2u);
+    ASSERT_TRUE(h.playCard(whot).has_value());
+    EXPECT_TRUE(h.hasCard(whot));
+    ASSERT_TRUE(h.playCard(whot).has_value());
+    EXPECT_FALSE(h.hasCard(whot));
+    EXPECT_EQ(h.getCardMask(), cardMask(Card(Suit::CIRCLE, CardValue::ONE)));
+}
+
+TEST(TestHand, GetPlayableMask_RespectsDemandedSuit) {
+    Hand h;
+    h.addCard(Card(Suit::CIRCLE, CardValue::SEVEN));
+    h.addCard(Card(Suit::CROSS, CardValue::THREE));
+    Card call(Suit::TRIANGLE, CardValue::SEVEN);
+    EXPECT_EQ(h.getPlayableMask(call), cardMask(Card(Suit::CIRCLE, CardValue::SEVEN)));
+    EXPECT_EQ(h.getPlayableMask(call, Suit::CROSS),
+              cardMask(Card(Suit::CROSS, CardValue::THREE)));
+    EXPECT_TRUE(h.getPlayableMask(call, Suit::BLOCK).none());
+    EXPECT_EQ(h.getSuitMask(Suit::CROSS).count(), 1u);
+    EXPECT_EQ(h.getValueMask(CardValue::SEVEN).count(), 1u);
+}
+
 } // namespace whot::core
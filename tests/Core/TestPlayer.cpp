@@ -22,7 +22,7 @@ TEST(TestPlayer, GetHandScoresStatus) {
     EXPECT_EQ(p.getCurrentScore(), 0);
     EXPECT_EQ(p.getCumulativeScore(), 0);
     EXPECT_EQ(p.getStatus(), PlayerStatus::ACTIVE);
-    p.getHand().addCard(std::make_unique<Card>(Suit::CIRCLE, CardValue::ONE));
+    p.getHand().addCard(Card(Suit::CIRCLE, CardValue::ONE));
     EXPECT_EQ(p.getHand().size(), 1u);
 }
 
@@ -101,4 +101,15 @@ TEST(TestPlayer, FromJson_EmptyObject_Defaults) {
     EXPECT_TRUE(p->getName().empty());
 }
 
+TEST(TestPlayer, ToJson_MatchesCompactSortedDump) {
+    Player p("p\u00e9-1", "Tab\tand \"quote\"", PlayerType::HUMAN);
+    p.getHand().addCard(Card(Suit::STAR, CardValue::EIGHT));
+    p.getHand().addCard(Card(Suit::WHOT, CardValue::TWENTY));
+    p.addToScore(-3);
+    p.setSaidLastCard(true);
+    const std::string text = p.toJson();
+    EXPECT_EQ(nlohmann::json::parse(text).dump(), text);
+    EXPECT_EQ(Player::fromJson(text)->toJson(), text);
+}
+
 } // namespace whot::core
@@ -78,4 +78,69 @@ TEST(TestGameEngine, EventCallback) {
     EXPECT_TRUE(fired);
 }
 
+TEST(TestGameEngine, Subscribe_TypedEventsAndUnsubscribe) {
+    GameEngine engine(makeGameStateWithPlayers(2));
+    engine.startGame();
+    engine.startNewRound();
+    std::vector<GameEventType> seen;
+    std::optional<CardDrawnEvent> drawn;
+    engine.subscribeAll([&seen](const GameEvent& e) { seen.push_back(e.type); });
+    const SubscriptionId id = engine.subscribe(GameEventType::CARD_DRAWN, [&drawn](const GameEvent& e) {
+        drawn = std::get<CardDrawnEvent>(e.data);
+    });
+
+    // A player with no cards has to draw.
+    auto emptyCurrentHand = [&engine] {
+        core::Hand& hand = engine.getState()->getCurrentPlayer()->getHand();
+        while (!hand.isEmpty()) hand.playCard(0);
+    };
+    GameAction draw;
+    draw.type = ActionType::DRAW_CARD;
+    draw.playerId = engine.getState()->getCurrentPlayer()->getId();
+    emptyCurrentHand();
+    ActionResult r = engine.processAction(draw);
+    ASSERT_TRUE(r.success);
+    ASSERT_TRUE(drawn.has_value());
+    EXPECT_EQ(drawn->playerId, draw.playerId);
+    EXPECT_EQ(drawn->count, 1);
+    EXPECT_EQ(seen, std::vector<GameEventType>{GameEventType::CARD_DRAWN});
+    EXPECT_EQ(r.stateJson(), engine.getState()->toJson());
+
+    engine.unsubscribe(id);
+    drawn.reset();
+    draw.playerId = engine.getState()->getCurrentPlayer()->getId();
+    emptyCurrentHand();
+    ASSERT_TRUE(engine.processAction(draw).success);
+    EXPECT_FALSE(drawn.has_value());
+    EXPECT_EQ(seen.size(), 2u);
+}
+
+TEST(TestGameEngine, RegisterEventCallback_NamedAndWildcard) {
+    GameEngine engine(makeGameStateWithPlayers(2));
+    std::vector<std::string> names;
+    std::string data;
+    engine.registerEventCallback("*", [&names](const std::string& type, const std::string&) {
+        names.push_back(type);
+    });
+    engine.registerEventCallback("game_ended", [&data](const std::string&, const std::string& d) { data = d; });
+    engine.startNewRound();
+    engine.endGame();
+    EXPECT_EQ(names, (std::vector<std::string>{"round_started", "game_ended"}));
+    EXPECT_EQ(data, engine.getState()->toJson());
+
+    engine.unregisterEventCallback("*");
+    engine.endGame();
+    EXPECT_EQ(names.size(), 2u);
+}
+
+TEST(TestGameEngine, RegisterEventCallback_UnknownName_ReturnsFalse) {
+    GameEngine engine(makeGameStateWithPlayers(2));
+    bool fired = false;
+    auto callback = [&fired](const std::string&, const std::string&) { fired = true; };
+    EXPECT_FALSE(engine.registerEventCallback("roundStarted", callback));
+    EXPECT_TRUE(engine.registerEventCallback("round_started", callback));
+    engine.startNewRound();
+    EXPECT_TRUE(fired);
+}
+
 } // namespace whot::game
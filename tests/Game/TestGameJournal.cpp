@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "Game/GameEngine.hpp"
+#include "Game/GameJournal.hpp"
+#include "TestHelpers.hpp"
+
+namespace whot::game {
+
+using namespace whot::test;
+
+namespace {
+/// Current player plays their first legal card, else draws; new rounds start
+/// as Application starts them.
+void playMoves(GameEngine& engine, int moves) {
+    for (int i = 0; i < moves && engine.getState()->getPhase() != GamePhase::GAME_ENDED; ++i) {
+        GameState& state = *engine.getState();
+        if (state.getPhase() == GamePhase::ROUND_ENDED) {
+            engine.startNewRound();
+            continue;
+        }
+        const core::Player* current = state.getCurrentPlayer();
+        ASSERT_NE(current, nullptr);
+        GameAction action;
+        action.playerId = current->getId();
+        action.type = ActionType::DRAW_CARD;
+        for (size_t c = 0; c < current->getHand().size(); ++c) {
+            GameAction play = action;
+            play.type = ActionType::PLAY_CARD;
+            play.cardIndex = c;
+            if (engine.isValidAction(play)) {
+                action = play;
+                break;
+            }
+        }
+        if (action.type == ActionType::DRAW_CARD && !engine.isValidAction(action)) {
+            action.type = ActionType::DECLARE_CHECK_UP;
+        }
+        ASSERT_TRUE(engine.processAction(action).success);
+    }
+}
+}  // namespace
+
+TEST(TestGameJournal, Replay_RebuildsExactStateAndJournal) {
+    GameEngine engine(makeGameStateWithPlayers(3));
+    engine.getState()->setGameCode("ABC123");
+    engine.getState()->setSeed(7);
+    engine.startGame();
+    engine.startNewRound();
+    playMoves(engine, 60);
+    // Remove a seat behind the current one, so the turn index stays valid.
+    for (int i = 0; i < 10 && engine.getState()->getCurrentPlayerIndex() != 0; ++i) playMoves(engine, 1);
+    ASSERT_EQ(engine.getState()->getCurrentPlayerIndex(), 0);
+    engine.removePlayer("player-2");
+    playMoves(engine, 10);
+
+    const GameJournal& journal = engine.getJournal();
+    EXPECT_GT(journal.entryCount(), 60u);
+    auto replayed = journal.replay();
+    ASSERT_NE(replayed, nullptr);
+    EXPECT_EQ(replayed->getState()->toJson(), engine.getState()->toJson());
+    EXPECT_EQ(replayed->getState()->getDeck().toJson(), engine.getState()->getDeck().toJson());
+    EXPECT_EQ(replayed->getJournal().bytes(), journal.bytes());
+}
+
+TEST(TestGameJournal, FromBytes_RoundTripsAndRejectsDamage) {
+    GameEngine engine(makeGameStateWithPlayers(2));
+    engine.getState()->setSeed(11);
+    engine.startGame();
+    engine.startNewRound();
+    const size_t headerAndRound = engine.getJournal().bytes().size();
+    playMoves(engine, 5);
+    const std::string bytes = engine.getJournal().bytes();
+    // A few bytes per move, not a state blob.
+    EXPECT_LE(bytes.size() - headerAndRound, 5u * 5u);
+
+    auto restored = GameJournal::fromBytes(bytes);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->entryCount(), engine.getJournal().entryCount());
+    auto replayed = restored->replay();
+    ASSERT_NE(replayed, nullptr);
+    EXPECT_EQ(replayed->getState()->toJson(), engine.getState()->toJson());
+
+    EXPECT_FALSE(GameJournal::fromBytes(bytes.substr(0, bytes.size() - 2)).has_value());
+    EXPECT_FALSE(GameJournal::fromBytes("not a journal").has_value());
+    EXPECT_FALSE(GameJournal().isOpen());
+}
+
+TEST(TestGameJournal, FromBytes_RejectsOutOfRangeFields) {
+    auto state = makeGameStateWithPlayers(2);
+    const std::string header = GameJournal(*state).bytes();
+    auto entry = [&](std::initializer_list<int> entryBytes) {
+        std::string bytes = header;
+        for (int b : entryBytes) bytes.push_back(static_cast<char>(b));
+        return GameJournal::fromBytes(bytes);
+    };
+    // ACTION seat 0 CHOOSE_SUIT with a suit; PLAYER_REMOVED seat 1.
+    EXPECT_TRUE(entry({2, 0, 4, 2, 3}).has_value());
+    EXPECT_TRUE(entry({3, 1}).has_value());
+
+    EXPECT_FALSE(entry({2, 0, 4, 2, 6}).has_value());   // suit past SUIT_COUNT
+    EXPECT_FALSE(entry({2, 0, 5, 4, 2}).has_value());   // direction past COUNTER_CLOCKWISE
+    EXPECT_FALSE(entry({2, 0, 7, 0}).has_value());      // action type past FORFEIT_TURN
+    EXPECT_FALSE(entry({2, 0, 1, 8}).has_value());      // unknown field bit
+    EXPECT_FALSE(entry({2, 2, 1, 0}).has_value());      // action seat past the seating
+    EXPECT_FALSE(entry({3, 2}).has_value());            // removal seat past the seating
+
+    std::string badType = header;
+    badType.back() = static_cast<char>(static_cast<uint8_t>(core::PlayerType::AI_HARD) + 1);
+    EXPECT_FALSE(GameJournal::fromBytes(badType).has_value());
+}
+
+TEST(TestGameJournal, TakeUnsaved_ReturnsEachByteOnce) {
+    GameEngine engine(makeGameStateWithPlayers(2));
+    engine.startGame();
+    engine.startNewRound();
+    auto first = engine.takeUnsavedJournal();
+    EXPECT_EQ(first.offset, 0u);
+    EXPECT_EQ(first.bytes, engine.getJournal().bytes());
+    EXPECT_TRUE(engine.takeUnsavedJournal().bytes.empty());
+
+    playMoves(engine, 3);
+    auto second = engine.takeUnsavedJournal();
+    EXPECT_EQ(second.offset, first.bytes.size());
+    EXPECT_EQ(first.bytes + second.bytes, engine.getJournal().bytes());
+
+    // A loaded journal is already stored; only later entries are unsaved.
+    auto restored = GameJournal::fromBytes(engine.getJournal().bytes());
+    ASSERT_TRUE(restored.has_value());
+    engine.restoreJournal(std::move(*restored));
+    EXPECT_TRUE(engine.takeUnsavedJournal().bytes.empty());
+    engine.endGame();
+    EXPECT_EQ(engine.takeUnsavedJournal().offset, first.bytes.size() + second.bytes.size());
+}
+
+} // namespace whot::game
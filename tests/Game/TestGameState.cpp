@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "Game/GameState.hpp"
 #include "TestHelpers.hpp"
+#include "Utils/ByteStream.hpp"
+#include "Utils/JSONSerializer.hpp"
 #include <nlohmann/json.hpp>
 
 namespace whot::game {
@@ -59,10 +61,10 @@ TEST(TestGameState, AdvanceTurnReverseDirection) {
 
 TEST(TestGameState, SetCallCardAddToDiscardPile) {
     auto state = makeGameStateWithPlayers(1);
-    state->setCallCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::FIVE));
-    ASSERT_NE(state->getCallCard(), nullptr);
+    state->setCallCard(core::Card(core::Suit::CIRCLE, core::CardValue::FIVE));
+    ASSERT_TRUE(state->getCallCard().has_value());
     EXPECT_EQ(state->getCallCard()->getSuit(), core::Suit::CIRCLE);
-    state->addToDiscardPile(std::make_unique<core::Card>(core::Suit::TRIANGLE, core::CardValue::ONE));
+    state->addToDiscardPile(core::Card(core::Suit::TRIANGLE, core::CardValue::ONE));
 }
 
 TEST(TestGameState, ActivePickCountDemandedSuit) {
@@ -82,9 +84,9 @@ TEST(TestGameState, ToJsonForPlayer_MasksOtherHands) {
     auto state = makeGameStateWithPlayers(2);
     state->startRound();
     state->getPlayer("player-0")->getHand().addCard(
-        std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::ONE));
+        core::Card(core::Suit::CIRCLE, core::CardValue::ONE));
     state->getPlayer("player-1")->getHand().addCard(
-        std::make_unique<core::Card>(core::Suit::WHOT, core::CardValue::TWENTY));
+        core::Card(core::Suit::WHOT, core::CardValue::TWENTY));
     std::string json = state->toJsonForPlayer("player-0");
     auto j = nlohmann::json::parse(json);
     ASSERT_TRUE(j.contains("players"));
@@ -92,6 +94,145 @@ TEST(TestGameState, ToJsonForPlayer_MasksOtherHands) {
     EXPECT_TRUE(j["players"][0].contains("hand"));
     EXPECT_TRUE(j["players"][1]["hand"].contains("count"));
     EXPECT_EQ(j["players"][1]["hand"]["count"], 1);
+
+    // The same layout as toJson(), other hands aside.
+    auto full = nlohmann::json::parse(state->toJson());
+    full["players"][1]["hand"] = {{"count", 1}};
+    EXPECT_EQ(j, full);
+}
+
+TEST(TestGameState, ToBinaryForPlayer_OneByteCardsAndMaskedHands) {
+    auto state = makeGameStateWithPlayers(2);
+    state->startRound();
+    state->getPlayer("player-0")->getHand().addCard(
+        core::Card(core::Suit::CIRCLE, core::CardValue::ONE));
+    state->getPlayer("player-1")->getHand().addCard(
+        core::Card(core::Suit::WHOT, core::CardValue::TWENTY));
+    const std::string bin = state->toBinaryForPlayer("player-0");
+    EXPECT_LT(bin.size() * 4, state->toJsonForPlayer("player-0").size());
+
+    utils::ByteReader r(bin);
+    EXPECT_EQ(r.u8(), 1);  // view version
+    EXPECT_EQ(r.str(), state->getGameId());
+    r.str();  // gameCode
+    r.str();  // creator
+    EXPECT_EQ(r.u8(), static_cast<uint8_t>(state->getPhase()));
+    EXPECT_EQ(r.svarint(), state->getCurrentPlayerIndex());
+    r.u8();      // direction
+    r.varint();  // activePickCount
+    r.u8();      // demanded suit
+    r.u8();      // call card
+    r.varint();  // deck
+    r.varint();  // discard
+    r.str();     // winner
+    ASSERT_EQ(r.varint(), 2u);
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_EQ(r.str(), "player-" + std::to_string(i));
+        r.str();
+        r.u8();
+        r.u8();
+        r.svarint();
+        r.svarint();
+        const uint8_t flags = r.u8();
+        r.varint();
+        r.varint();
+        const auto& hand = state->getPlayer("player-" + std::to_string(i))->getHand();
+        ASSERT_EQ(r.varint(), hand.size());
+        if (i == 0) {
+            ASSERT_TRUE(flags & 4);
+            for (size_t c = 0; c < hand.size(); ++c) {
+                const uint8_t b = r.u8();
+                EXPECT_EQ(static_cast<core::Suit>(b >> 5), hand.getCard(c).getSuit());
+                EXPECT_EQ(static_cast<core::CardValue>(b & 0x1F), hand.getCard(c).getValue());
+            }
+        } else {
+            EXPECT_FALSE(flags & 4);
+        }
+    }
+    EXPECT_TRUE(r.ok());
+    EXPECT_TRUE(r.atEnd());
+}
+
+TEST(TestGameState, RenderView_SplicesViewerHandIntoSharedJson) {
+    auto state = makeGameStateWithPlayers(3);
+    state->startRound();
+    state->getPlayer("player-1")->getHand().addCard(
+        core::Card(core::Suit::STAR, core::CardValue::EIGHT));
+    state->getPlayer("player-2")->setName("Q\"uote");
+    const StateView view = state->renderView(StateView::Format::JSON);
+    for (int viewer = 0; viewer < 3; ++viewer) {
+        const std::string id = "player-" + std::to_string(viewer);
+        const std::string text = view.forPlayer(id);
+        EXPECT_EQ(text, state->toJsonForPlayer(id));
+        // Sorted keys and compact output, as nlohmann::json renders it.
+        const auto j = nlohmann::json::parse(text);
+        EXPECT_EQ(j.dump(), text);
+        for (int i = 0; i < 3; ++i) {
+            const core::Player* p = state->getPlayer("player-" + std::to_string(i));
+            auto expected = nlohmann::json::parse(p->toJson());
+            if (i != viewer) expected["hand"] = {{"count", p->getHand().size()}};
+            EXPECT_EQ(j["players"][i], expected);
+        }
+    }
+    const auto masked = nlohmann::json::parse(view.forPlayer("spectator"));
+    EXPECT_TRUE(masked["players"][1]["hand"].is_object());
+
+    const StateView binary = state->renderView(StateView::Format::BINARY);
+    EXPECT_EQ(binary.forPlayer("player-1"), state->toBinaryForPlayer("player-1"));
+}
+
+TEST(TestGameState, Version_GrowsOnNestedChangesAndKeysCachedJson) {
+    auto state = makeGameStateWithPlayers(3);
+    state->startRound();
+    const uint64_t start = state->getVersion();
+    const std::string json = state->toJson();
+    EXPECT_EQ(state->toJson(), json);
+    EXPECT_EQ(state->getVersion(), start);
+
+    state->getPlayer("player-1")->getHand().addCard(
+        core::Card(core::Suit::STAR, core::CardValue::EIGHT));
+    const uint64_t afterHand = state->getVersion();
+    EXPECT_GT(afterHand, start);
+    EXPECT_NE(state->toJson(), json);
+
+    state->getDeck().draw();
+    EXPECT_GT(state->getVersion(), afterHand);
+    const uint64_t afterDeck = state->getVersion();
+    state->getPlayer("player-2")->setSaidLastCard(true);
+    EXPECT_GT(state->getVersion(), afterDeck);
+
+    const uint64_t beforeRemove = state->getVersion();
+    state->removePlayer("player-2");
+    EXPECT_GT(state->getVersion(), beforeRemove);
+}
+
+TEST(TestGameState, RenderView_CachedUntilStateChanges) {
+    auto state = makeGameStateWithPlayers(2);
+    state->startRound();
+    const StateView* first = &state->renderView(StateView::Format::JSON);
+    const std::string before = first->forPlayer("player-0");
+    EXPECT_EQ(&state->renderView(StateView::Format::JSON), first);
+
+    state->getPlayer("player-1")->setName("Renamed");
+    const std::string after = state->renderView(StateView::Format::JSON).forPlayer("player-0");
+    EXPECT_NE(after, before);
+    EXPECT_NE(after.find("Renamed"), std::string::npos);
+}
+
+TEST(TestGameState, ToJson_WriterMatchesCompactSortedDump) {
+    auto state = makeGameStateWithPlayers(3);
+    state->startRound();
+    state->setCallCard(core::Card(core::Suit::CROSS, core::CardValue::FIVE));
+    state->setDemandedSuit(core::Suit::TRIANGLE);
+    std::string text = state->toJson();
+    EXPECT_EQ(nlohmann::json::parse(text).dump(), text);
+
+    std::string wrapped;
+    utils::JsonWriter w(wrapped);
+    w.beginArray();
+    state->writeJson(w);
+    w.endArray();
+    EXPECT_EQ(wrapped, "[" + text + "]");
 }
 
 TEST(TestGameState, CheckRoundEndCheckGameEnd) {
@@ -116,4 +257,87 @@ TEST(TestGameState, FromJson_Malformed_Throws) {
     EXPECT_THROW(GameState::fromJson(""), nlohmann::json::parse_error);
 }
 
+TEST(TestGameState, SameSeed_SameDeal) {
+    GameConfig cfg;
+    cfg.seed = 99;
+    GameState a(cfg);
+    GameState b(cfg);
+    EXPECT_EQ(a.getSeed(), 99u);
+    a.startRound();
+    b.startRound();
+    EXPECT_EQ(a.getDeck().toJson(), b.getDeck().toJson());
+}
+
+TEST(TestGameState, Seed_OnlyInSnapshot) {
+    GameConfig cfg;
+    cfg.seed = 12345;
+    GameState state(cfg);
+    auto restored = GameState::fromSnapshot(state.toSnapshot());
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->getSeed(), 12345u);
+    EXPECT_FALSE(nlohmann::json::parse(state.toJson()).contains("seed"));
+    EXPECT_NE(GameState::fromJson(state.toJson())->getSeed(), 12345u);
+    auto viewerJson = nlohmann::json::parse(state.toJsonForPlayer("player-0"));
+    EXPECT_FALSE(viewerJson.contains("seed"));
+}
+
+namespace {
+/// A mid-round state: dealt hands, a discard pile, a pending pick and a
+/// demanded suit.
+std::unique_ptr<GameState> makeMidRoundState() {
+    auto state = makeGameStateWithPlayers(3);
+    state->setSeed(2024);
+    state->startRound();
+    for (core::Player* p : state->getAllPlayers())
+        for (int i = 0; i < 5; ++i) p->getHand().addCard(*state->getDeck().draw());
+    for (int i = 0; i < 7; ++i) {
+        const core::Card card = *state->getDeck().draw();
+        state->addToDiscardPile(card);
+        state->setCallCard(card);
+    }
+    state->getAllPlayers()[1]->setSaidLastCard(true);
+    state->getAllPlayers()[2]->addToScore(17);
+    state->reverseDirection();
+    state->advanceTurn();
+    state->setActivePickCount(2);
+    state->setDemandedSuit(core::Suit::STAR);
+    return state;
+}
+}  // namespace
+
+TEST(TestGameState, Snapshot_ResumesExactly) {
+    auto state = makeMidRoundState();
+    const std::string snapshot = state->toSnapshot();
+    auto restored = GameState::fromSnapshot(snapshot);
+    ASSERT_NE(restored, nullptr);
+    EXPECT_EQ(restored->toJson(), state->toJson());
+    EXPECT_EQ(restored->getDeck().toJson(), state->getDeck().toJson());
+    EXPECT_EQ(restored->toSnapshot(), snapshot);
+
+    // Same discard pile and RNG state: the reshuffle and later draws match.
+    while (!state->getDeck().isEmpty()) {
+        state->getDeck().draw();
+        restored->getDeck().draw();
+    }
+    ASSERT_TRUE(state->needsReshufffle());
+    ASSERT_TRUE(restored->needsReshufffle());
+    state->reshuffleDiscardPile();
+    restored->reshuffleDiscardPile();
+    EXPECT_EQ(restored->getDeck().toJson(), state->getDeck().toJson());
+    state->startRound();
+    restored->startRound();
+    EXPECT_EQ(restored->getDeck().toJson(), state->getDeck().toJson());
+}
+
+TEST(TestGameState, FromSnapshot_RejectsDamage) {
+    const std::string snapshot = makeMidRoundState()->toSnapshot();
+    ASSERT_NE(GameState::fromSnapshot(snapshot), nullptr);
+    std::string flipped = snapshot;
+    flipped[flipped.size() / 2] ^= 0x10;
+    EXPECT_EQ(GameState::fromSnapshot(flipped), nullptr);
+    EXPECT_EQ(GameState::fromSnapshot(snapshot.substr(0, snapshot.size() - 1)), nullptr);
+    EXPECT_EQ(GameState::fromSnapshot(makeMidRoundState()->toJson()), nullptr);
+    EXPECT_EQ(GameState::fromSnapshot(""), nullptr);
+}
+
 } // namespace whot::game
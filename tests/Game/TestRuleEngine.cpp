@@ -11,9 +11,9 @@ using namespace whot::test;
 TEST(TestRuleEngine, CanPlayCard_WithCallCard) {
     auto state = makeGameStateWithPlayers(1);
     state->startRound();
-    state->setCallCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::FIVE));
+    state->setCallCard(core::Card(core::Suit::CIRCLE, core::CardValue::FIVE));
     core::Player* p = state->getCurrentPlayer();
-    p->getHand().addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::THREE));
+    p->getHand().addCard(core::Card(core::Suit::CIRCLE, core::CardValue::THREE));
     RuleEngine re;
     core::Card card(core::Suit::CIRCLE, core::CardValue::THREE);
     EXPECT_TRUE(re.canPlayCard(*state, *p, card));
@@ -22,9 +22,9 @@ TEST(TestRuleEngine, CanPlayCard_WithCallCard) {
 TEST(TestRuleEngine, MustDrawCard_NoPlayable) {
     auto state = makeGameStateWithPlayers(1);
     state->startRound();
-    state->setCallCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::FIVE));
+    state->setCallCard(core::Card(core::Suit::CIRCLE, core::CardValue::FIVE));
     core::Player* p = state->getCurrentPlayer();
-    p->getHand().addCard(std::make_unique<core::Card>(core::Suit::TRIANGLE, core::CardValue::SEVEN));
+    p->getHand().addCard(core::Card(core::Suit::TRIANGLE, core::CardValue::SEVEN));
     RuleEngine re;
     EXPECT_TRUE(re.mustDrawCard(*state, *p));
 }
@@ -41,15 +41,15 @@ TEST(TestRuleEngine, CalculateDrawCount) {
 TEST(TestRuleEngine, RequiresLastCardDeclaration) {
     RuleEngine re;
     core::Player p("p", "P", core::PlayerType::HUMAN);
-    p.getHand().addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::ONE));
-    p.getHand().addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::TWO));
+    p.getHand().addCard(core::Card(core::Suit::CIRCLE, core::CardValue::ONE));
+    p.getHand().addCard(core::Card(core::Suit::CIRCLE, core::CardValue::TWO));
     EXPECT_TRUE(re.requiresLastCardDeclaration(p));
 }
 
 TEST(TestRuleEngine, RequiresCheckUpDeclaration) {
     RuleEngine re;
     core::Player p("p", "P", core::PlayerType::HUMAN);
-    p.getHand().addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::ONE));
+    p.getHand().addCard(core::Card(core::Suit::CIRCLE, core::CardValue::ONE));
     EXPECT_TRUE(re.requiresCheckUpDeclaration(p));
 }
 
@@ -61,7 +61,7 @@ TEST(TestRuleEngine, GetDeclarationPenalty) {
 TEST(TestRuleEngine, CalculateRoundScore) {
     RuleEngine re;
     core::Player p("p", "P", core::PlayerType::HUMAN);
-    p.getHand().addCard(std::make_unique<core::Card>(core::Suit::STAR, core::CardValue::FIVE));
+    p.getHand().addCard(core::Card(core::Suit::STAR, core::CardValue::FIVE));
     int score = re.calculateRoundScore(p);
     EXPECT_GE(score, 0);
 }
@@ -13,8 +13,8 @@ TEST(TestScoreCalculator, CalculateHandScore_Empty) {
 
 TEST(TestScoreCalculator, CalculateHandScore_WithCards) {
     core::Hand hand;
-    hand.addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::FIVE));
-    hand.addCard(std::make_unique<core::Card>(core::Suit::STAR, core::CardValue::FIVE));
+    hand.addCard(core::Card(core::Suit::CIRCLE, core::CardValue::FIVE));
+    hand.addCard(core::Card(core::Suit::STAR, core::CardValue::FIVE));
     int score = ScoreCalculator::calculateHandScore(hand);
     EXPECT_GE(score, 15);
 }
@@ -42,7 +42,7 @@ TEST(TestScoreCalculator, CheckEliminatedPlayers) {
 TEST(TestScoreCalculator, DetermineRoundWinner) {
     core::Player p1("p1", "P1", core::PlayerType::HUMAN);
     core::Player p2("p2", "P2", core::PlayerType::HUMAN);
-    p2.getHand().addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::ONE));
+    p2.getHand().addCard(core::Card(core::Suit::CIRCLE, core::CardValue::ONE));
     std::vector<core::Player*> players = {&p1, &p2};
     std::string winner = ScoreCalculator::determineRoundWinner(players);
     EXPECT_EQ(winner, "p1");
@@ -46,6 +46,27 @@ TEST(TestTurnManager, RecordActionGetTurnHistory) {
     EXPECT_GE(history.size(), 1u);
 }
 
+TEST(TestTurnManager, TurnHistory_KeepsMostRecentInOrder) {
+    auto state = makeGameStateWithPlayers(1);
+    TurnManager tm(state.get());
+    EXPECT_EQ(tm.getLastAction(), nullptr);
+    for (int i = 0; i < 250; ++i) {
+        TurnAction a;
+        a.playerId = "p" + std::to_string(i);
+        a.action = ActionType::DRAW_CARD;
+        a.completed = true;
+        tm.recordAction(a);
+    }
+    auto recent = tm.getTurnHistory(3);
+    ASSERT_EQ(recent.size(), 3u);
+    EXPECT_EQ(recent[0].playerId, "p247");
+    EXPECT_EQ(recent[2].playerId, "p249");
+    EXPECT_EQ(tm.getTurnHistory(1000).size(), 100u);
+    EXPECT_EQ(tm.getTurnHistory(1000).front().playerId, "p150");
+    ASSERT_NE(tm.getLastAction(), nullptr);
+    EXPECT_EQ(tm.getLastAction()->playerId, "p249");
+}
+
 TEST(TestTurnManager, QueueSkipIsPlayerSkipped) {
     auto state = makeGameStateWithPlayers(2);
     TurnManager tm(state.get());
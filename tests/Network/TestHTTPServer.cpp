@@ -1,8 +1,72 @@
 #include <gtest/gtest.h>
 #include "Network/HTTPServer.hpp"
+#include "Utils/Compression.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace whot::network {
 
+namespace {
+int connectTo(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+std::string readUntilClose(int fd) {
+    std::string out;
+    char buf[4096];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) out.append(buf, static_cast<size_t>(n));
+    return out;
+}
+
+/// Reads exactly one response (headers plus Content-Length body).
+std::string readResponse(int fd) {
+    std::string out;
+    char buf[4096];
+    for (;;) {
+        size_t headerEnd = out.find("\r\n\r\n");
+        if (headerEnd != std::string::npos) {
+            size_t len = 0;
+            size_t cl = out.find("Content-Length: ");
+            if (cl != std::string::npos && cl < headerEnd) len = std::stoul(out.substr(cl + 16));
+            if (out.size() >= headerEnd + 4 + len) return out;
+        }
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n <= 0) return out;
+        out.append(buf, static_cast<size_t>(n));
+    }
+}
+
+std::string roundTrip(uint16_t port, const std::string& request) {
+    int fd = connectTo(port);
+    if (fd < 0) return "";
+    send(fd, request.data(), request.size(), 0);
+    std::string out = readUntilClose(fd);
+    close(fd);
+    return out;
+}
+}  // namespace
+
 TEST(TestHTTPServer, HttpResponse_Ok) {
     HttpResponse r = HttpResponse::ok("body");
     EXPECT_EQ(r.statusCode, 200);
@@ -52,4 +116,386 @@ TEST(TestHTTPServer, SetStaticRoot) {
     server.stop();
 }
 
+TEST(TestHTTPServer, Start_ServesRouteOverSocket) {
+    HttpServer server(0);
+    server.setWorkerThreads(2);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    ASSERT_TRUE(server.isRunning());
+    ASSERT_NE(server.getPort(), 0);
+    std::string resp = roundTrip(server.getPort(), "GET /health HTTP/1.1\r\nHost: x\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(resp.rfind("HTTP/1.1 200 OK", 0), 0u);
+    EXPECT_NE(resp.find("\r\n\r\nok"), std::string::npos);
+    server.stop();
+    EXPECT_FALSE(server.isRunning());
+}
+
+TEST(TestHTTPServer, Start_WaitsForBodySplitAcrossPackets) {
+    HttpServer server(0);
+    server.addRoute(HttpMethod::POST, "/echo", [](const HttpRequest& r) {
+        return HttpResponse::ok(std::string(r.body));
+    });
+    server.start();
+    int fd = connectTo(server.getPort());
+    ASSERT_GE(fd, 0);
+    std::string head = "POST /echo HTTP/1.1\r\nConnection: close\r\nContent-Length: 10\r\n\r\nhello";
+    send(fd, head.data(), head.size(), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    send(fd, "world", 5, 0);
+    std::string resp = readUntilClose(fd);
+    close(fd);
+    EXPECT_NE(resp.find("\r\n\r\nhelloworld"), std::string::npos);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_BodyLargerThanOneReadArrivesWhole) {
+    HttpServer server(0);
+    server.addRoute(HttpMethod::POST, "/size", [](const HttpRequest& r) {
+        return HttpResponse::ok(std::to_string(r.body.size()));
+    });
+    server.start();
+    const std::string body(200 * 1024, 'x');
+    std::string resp = roundTrip(server.getPort(),
+        "POST /size HTTP/1.1\r\nConnection: close\r\nContent-Length: " +
+        std::to_string(body.size()) + "\r\n\r\n" + body);
+    EXPECT_NE(resp.find("\r\n\r\n204800"), std::string::npos);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_PatternRouteSeesPathAndQueryParams) {
+    HttpServer server(0);
+    server.addPatternRoute(HttpMethod::GET, "/api/games/:id", [](const HttpRequest& r) {
+        auto id = r.pathParams.find("id");
+        auto view = r.queryParams.find("view");
+        return HttpResponse::ok(std::string(id->second) + "/" + std::string(view->second));
+    });
+    server.start();
+    std::string resp = roundTrip(server.getPort(),
+        "GET /api/games/abc?view=full HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_NE(resp.find("\r\n\r\nabc/full"), std::string::npos);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_WrongMethodOnKnownPath_Returns405) {
+    HttpServer server(0);
+    server.addRoute(HttpMethod::GET, "/api/games", [](const HttpRequest&) {
+        return HttpResponse::ok("[]");
+    });
+    server.addRoute(HttpMethod::POST, "/api/games", [](const HttpRequest&) {
+        return HttpResponse::ok("{}");
+    });
+    server.start();
+    std::string resp = roundTrip(server.getPort(),
+        "DELETE /api/games HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(resp.rfind("HTTP/1.1 405", 0), 0u);
+    EXPECT_NE(resp.find("Allow: GET, POST\r\n"), std::string::npos);
+    resp = roundTrip(server.getPort(), "DELETE /api/nope HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(resp.rfind("HTTP/1.1 404", 0), 0u);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_RejectsOversizedBodyBeforeReadingIt) {
+    HttpServer server(0);
+    server.setMaxBodySize(4);
+    server.addRoute(HttpMethod::POST, "/echo", [](const HttpRequest& r) {
+        return HttpResponse::ok(std::string(r.body));
+    });
+    server.start();
+    std::string resp = roundTrip(server.getPort(),
+        "POST /echo HTTP/1.1\r\nContent-Length: 100\r\n\r\n");
+    EXPECT_EQ(resp.rfind("HTTP/1.1 400", 0), 0u);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_OverConnectionCap_Returns503) {
+    HttpServer server(0);
+    server.setMaxConnections(1);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    int idle = connectTo(server.getPort());
+    ASSERT_GE(idle, 0);
+    for (int i = 0; i < 100 && server.getConnectionCount() == 0; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::string resp = roundTrip(server.getPort(), "GET /health HTTP/1.1\r\n\r\n");
+    EXPECT_EQ(resp.rfind("HTTP/1.1 503", 0), 0u);
+    close(idle);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_OutOfDescriptors_ShedsQueuedConnection) {
+    HttpServer server(0);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    // Created after the server's spare fd, so the limit below leaves the
+    // spare under it and no free descriptor for accept().
+    int client = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(client, 0);
+    timeval timeout{2, 0};
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    rlimit original{};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &original), 0);
+    rlimit lowered = original;
+    lowered.rlim_cur = static_cast<rlim_t>(client + 1);
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &lowered), 0);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(server.getPort());
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    const bool connected = connect(client, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    std::string resp;
+    if (connected) {
+        const std::string request = "GET /health HTTP/1.1\r\n\r\n";
+        send(client, request.data(), request.size(), 0);
+        resp = readUntilClose(client);
+    }
+    setrlimit(RLIMIT_NOFILE, &original);
+    close(client);
+    ASSERT_TRUE(connected);
+    EXPECT_EQ(resp.rfind("HTTP/1.1 503", 0), 0u);
+
+    // Served normally once descriptors are available again.
+    resp = roundTrip(server.getPort(), "GET /health HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(resp.rfind("HTTP/1.1 200", 0), 0u);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Start_ConcurrentClientsAllServed) {
+    HttpServer server(0);
+    server.setWorkerThreads(4);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    std::atomic<int> okCount{0};
+    std::vector<std::thread> clients;
+    for (int c = 0; c < 8; ++c) {
+        clients.emplace_back([&] {
+            for (int i = 0; i < 25; ++i) {
+                std::string resp = roundTrip(server.getPort(),
+                    "GET /health HTTP/1.1\r\nConnection: close\r\n\r\n");
+                if (resp.rfind("HTTP/1.1 200", 0) == 0) ++okCount;
+            }
+        });
+    }
+    for (auto& t : clients) t.join();
+    EXPECT_EQ(okCount.load(), 200);
+    server.stop();
+}
+
+TEST(TestHTTPServer, KeepAlive_ServesSequentialRequestsOnOneSocket) {
+    HttpServer server(0);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    int fd = connectTo(server.getPort());
+    ASSERT_GE(fd, 0);
+    const std::string req = "GET /health HTTP/1.1\r\n\r\n";
+    for (int i = 0; i < 3; ++i) {
+        send(fd, req.data(), req.size(), 0);
+        std::string resp = readResponse(fd);
+        EXPECT_EQ(resp.rfind("HTTP/1.1 200", 0), 0u);
+        EXPECT_NE(resp.find("Connection: keep-alive"), std::string::npos);
+    }
+    EXPECT_EQ(server.getConnectionCount(), 1u);
+    close(fd);
+    server.stop();
+}
+
+TEST(TestHTTPServer, KeepAlive_PipelinedRequestsAnsweredInOrder) {
+    HttpServer server(0);
+    server.setWorkerThreads(4);
+    server.addRoute(HttpMethod::POST, "/echo", [](const HttpRequest& r) {
+        return HttpResponse::ok(std::string(r.body));
+    });
+    server.start();
+    int fd = connectTo(server.getPort());
+    ASSERT_GE(fd, 0);
+    const std::string batch =
+        "POST /echo HTTP/1.1\r\nContent-Length: 3\r\n\r\none"
+        "POST /echo HTTP/1.1\r\nContent-Length: 3\r\n\r\ntwo"
+        "POST /echo HTTP/1.1\r\nConnection: close\r\nContent-Length: 5\r\n\r\nthree";
+    send(fd, batch.data(), batch.size(), 0);
+    std::string resp = readUntilClose(fd);
+    close(fd);
+    size_t one = resp.find("\r\n\r\none");
+    size_t two = resp.find("\r\n\r\ntwo");
+    size_t three = resp.find("\r\n\r\nthree");
+    ASSERT_NE(one, std::string::npos);
+    ASSERT_NE(two, std::string::npos);
+    ASSERT_NE(three, std::string::npos);
+    EXPECT_LT(one, two);
+    EXPECT_LT(two, three);
+    server.stop();
+}
+
+TEST(TestHTTPServer, KeepAlive_ClosesAfterMaxRequests) {
+    HttpServer server(0);
+    server.setMaxRequestsPerConnection(2);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    int fd = connectTo(server.getPort());
+    ASSERT_GE(fd, 0);
+    const std::string req = "GET /health HTTP/1.1\r\n\r\n";
+    send(fd, req.data(), req.size(), 0);
+    EXPECT_NE(readResponse(fd).find("Connection: keep-alive"), std::string::npos);
+    send(fd, req.data(), req.size(), 0);
+    std::string last = readUntilClose(fd);
+    EXPECT_EQ(last.rfind("HTTP/1.1 200", 0), 0u);
+    EXPECT_NE(last.find("Connection: close"), std::string::npos);
+    close(fd);
+    server.stop();
+}
+
+TEST(TestHTTPServer, KeepAlive_Http10ClosesByDefault) {
+    HttpServer server(0);
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    std::string resp = roundTrip(server.getPort(), "GET /health HTTP/1.0\r\n\r\n");
+    EXPECT_NE(resp.find("Connection: close"), std::string::npos);
+    server.stop();
+}
+
+TEST(TestHTTPServer, KeepAlive_IdleConnectionClosed) {
+    HttpServer server(0);
+    server.setIdleTimeout(std::chrono::milliseconds(50));
+    server.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) {
+        return HttpResponse::ok("ok");
+    });
+    server.start();
+    int fd = connectTo(server.getPort());
+    ASSERT_GE(fd, 0);
+    const std::string req = "GET /health HTTP/1.1\r\n\r\n";
+    send(fd, req.data(), req.size(), 0);
+    EXPECT_EQ(readResponse(fd).rfind("HTTP/1.1 200", 0), 0u);
+    // The idle sweep closes the socket; recv then sees EOF.
+    EXPECT_EQ(readUntilClose(fd), "");
+    close(fd);
+    for (int i = 0; i < 100 && server.getConnectionCount() != 0; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(server.getConnectionCount(), 0u);
+    server.stop();
+}
+
+TEST(TestHTTPServer, StaticFiles_EtagRevalidationAndGzip) {
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / ("whot_http_static_" + std::to_string(getpid()));
+    fs::create_directories(root);
+    std::string script;
+    for (int i = 0; i < 100; ++i) script += "console.log('whot " + std::to_string(i) + "');\n";
+    std::ofstream(root / "game.js") << script;
+
+    HttpServer server(0);
+    server.setStaticRoot(root.string());
+    server.start();
+    std::string plain = roundTrip(server.getPort(),
+        "GET /game.js HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(plain.rfind("HTTP/1.1 200", 0), 0u);
+    EXPECT_NE(plain.find("Cache-Control: public"), std::string::npos);
+    EXPECT_EQ(plain.find("Content-Encoding"), std::string::npos);
+    EXPECT_NE(plain.find("\r\n\r\n" + script), std::string::npos);
+
+    std::string gz = roundTrip(server.getPort(),
+        "GET /game.js HTTP/1.1\r\nAccept-Encoding: gzip, deflate\r\nConnection: close\r\n\r\n");
+    EXPECT_NE(gz.find("Content-Encoding: gzip"), std::string::npos);
+    EXPECT_NE(gz.find("Vary: Accept-Encoding"), std::string::npos);
+    EXPECT_LT(gz.size(), plain.size());
+
+    const size_t etagAt = gz.find("ETag: ");
+    ASSERT_NE(etagAt, std::string::npos);
+    const std::string etag = gz.substr(etagAt + 6, gz.find("\r\n", etagAt) - etagAt - 6);
+    std::string notModified = roundTrip(server.getPort(),
+        "GET /game.js HTTP/1.1\r\nAccept-Encoding: gzip\r\nIf-None-Match: " + etag +
+        "\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(notModified.rfind("HTTP/1.1 304", 0), 0u);
+    EXPECT_EQ(notModified.find("Content-Length"), std::string::npos);
+    EXPECT_NE(notModified.find("\r\n\r\n"), std::string::npos);
+    EXPECT_EQ(notModified.size(), notModified.find("\r\n\r\n") + 4);
+    server.stop();
+    fs::remove_all(root);
+}
+
+namespace {
+std::string bodyOf(const std::string& resp) {
+    const size_t at = resp.find("\r\n\r\n");
+    return at == std::string::npos ? "" : resp.substr(at + 4);
+}
+}  // namespace
+
+TEST(TestHTTPServer, Compression_GzipsLargeJsonWhenAccepted) {
+    const std::string json = "[" + std::string(4000, '1') + "]";
+    HttpServer server(0);
+    server.enableCompression(1024);
+    server.addRoute(HttpMethod::GET, "/big", [&](const HttpRequest&) { return HttpResponse::json(200, json); });
+    server.start();
+    std::string gz = roundTrip(server.getPort(),
+        "GET /big HTTP/1.1\r\nAccept-Encoding: gzip\r\nConnection: close\r\n\r\n");
+    EXPECT_NE(gz.find("Content-Encoding: gzip"), std::string::npos);
+    EXPECT_NE(gz.find("Vary: Accept-Encoding"), std::string::npos);
+    EXPECT_EQ(utils::Compression::gunzip(bodyOf(gz)), json);
+
+    std::string deflated = roundTrip(server.getPort(),
+        "GET /big HTTP/1.1\r\nAccept-Encoding: deflate\r\nConnection: close\r\n\r\n");
+    EXPECT_NE(deflated.find("Content-Encoding: deflate"), std::string::npos);
+    EXPECT_EQ(utils::Compression::inflate(bodyOf(deflated)), json);
+
+    std::string plain = roundTrip(server.getPort(),
+        "GET /big HTTP/1.1\r\nAccept-Encoding: gzip;q=0\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(plain.find("Content-Encoding"), std::string::npos);
+    EXPECT_EQ(bodyOf(plain), json);
+    server.stop();
+}
+
+TEST(TestHTTPServer, Compression_SkipsSmallBodiesAndOptedOutRoutes) {
+    const std::string json = "[" + std::string(4000, '1') + "]";
+    HttpServer server(0);
+    server.enableCompression(1024);
+    server.addRoute(HttpMethod::GET, "/small", [](const HttpRequest&) {
+        return HttpResponse::json(200, "{\"ok\":true}");
+    });
+    RouteOptions raw;
+    raw.compress = false;
+    server.addRoute(HttpMethod::GET, "/raw", [&](const HttpRequest&) { return HttpResponse::json(200, json); }, raw);
+    server.start();
+    for (const char* path : {"/small", "/raw"}) {
+        std::string resp = roundTrip(server.getPort(), std::string("GET ") + path +
+            " HTTP/1.1\r\nAccept-Encoding: gzip\r\nConnection: close\r\n\r\n");
+        EXPECT_EQ(resp.rfind("HTTP/1.1 200", 0), 0u) << path;
+        EXPECT_EQ(resp.find("Content-Encoding"), std::string::npos) << path;
+    }
+    server.stop();
+}
+
+TEST(TestHTTPServer, Cors_HeadersOnlyWhenEnabled) {
+    HttpServer plain(0);
+    plain.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) { return HttpResponse::ok("ok"); });
+    plain.start();
+    std::string resp = roundTrip(plain.getPort(), "GET /health HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(resp.find("Access-Control-Allow-Origin"), std::string::npos);
+    plain.stop();
+
+    HttpServer cors(0);
+    cors.addCorsHeaders();
+    cors.addRoute(HttpMethod::GET, "/health", [](const HttpRequest&) { return HttpResponse::ok("ok"); });
+    cors.start();
+    resp = roundTrip(cors.getPort(), "GET /health HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_NE(resp.find("Access-Control-Allow-Origin: *"), std::string::npos);
+    std::string preflight = roundTrip(cors.getPort(), "OPTIONS /health HTTP/1.1\r\nConnection: close\r\n\r\n");
+    EXPECT_EQ(preflight.rfind("HTTP/1.1 204", 0), 0u);
+    EXPECT_NE(preflight.find("Access-Control-Allow-Methods"), std::string::npos);
+    EXPECT_NE(preflight.find("Access-Control-Max-Age: 86400"), std::string::npos);
+    cors.stop();
+}
+
 } // namespace whot::network
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "Network/HttpParser.hpp"
+#include <string>
+
+namespace whot::network {
+
+namespace {
+using Status = HttpRequestParser::Status;
+}  // namespace
+
+TEST(TestHttpParser, Parse_ResumesAcrossReads) {
+    HttpRequestParser parser(1024, 1024);
+    std::string buf = "GET /api/games?limit=5&x=1 HTTP/1.1\r\nHo";
+    EXPECT_EQ(parser.parse(buf), Status::INCOMPLETE);
+    buf += "st: example\r\n\r";
+    EXPECT_EQ(parser.parse(buf), Status::INCOMPLETE);
+    buf += "\n";
+    ASSERT_EQ(parser.parse(buf), Status::COMPLETE);
+    EXPECT_EQ(parser.requestSize(), buf.size());
+
+    HttpRequest req;
+    parser.build(buf, req);
+    EXPECT_EQ(req.method, HttpMethod::GET);
+    EXPECT_EQ(req.path, "/api/games");
+    ASSERT_NE(req.queryParams.find("limit"), req.queryParams.end());
+    EXPECT_EQ(req.queryParams.find("limit")->second, "5");
+    EXPECT_EQ(req.queryParams.find("x")->second, "1");
+    EXPECT_TRUE(req.body.empty());
+}
+
+TEST(TestHttpParser, Parse_WaitsForContentLengthBody) {
+    HttpRequestParser parser(1024, 1024);
+    std::string buf = "POST /echo HTTP/1.1\r\nContent-Length: 10\r\n\r\nhello";
+    EXPECT_EQ(parser.parse(buf), Status::INCOMPLETE);
+    buf += "world";
+    ASSERT_EQ(parser.parse(buf), Status::COMPLETE);
+    HttpRequest req;
+    parser.build(buf, req);
+    EXPECT_EQ(req.method, HttpMethod::POST);
+    EXPECT_EQ(req.body, "helloworld");
+}
+
+TEST(TestHttpParser, Parse_PipelinedRequest_StopsAtFirst) {
+    HttpRequestParser parser(1024, 1024);
+    const std::string first = "POST /a HTTP/1.1\r\nContent-Length: 3\r\n\r\none";
+    std::string buf = first + "GET /b HTTP/1.1\r\n\r\n";
+    ASSERT_EQ(parser.parse(buf), Status::COMPLETE);
+    EXPECT_EQ(parser.requestSize(), first.size());
+    HttpRequest req;
+    parser.build(buf, req);
+    EXPECT_EQ(req.path, "/a");
+    EXPECT_EQ(req.body, "one");
+}
+
+TEST(TestHttpParser, Parse_LowercasesHeaderNamesAndTrimsValues) {
+    HttpRequestParser parser(1024, 1024);
+    std::string buf = "GET / HTTP/1.1\r\nContent-Type:  application/json \r\nX-Id: 7\r\n\r\n";
+    ASSERT_EQ(parser.parse(buf), Status::COMPLETE);
+    HttpRequest req;
+    parser.build(buf, req);
+    EXPECT_EQ(req.headers.size(), 2u);
+    ASSERT_NE(req.headers.find("content-type"), req.headers.end());
+    EXPECT_EQ(req.headers.find("content-type")->second, "application/json");
+    EXPECT_EQ(req.headers.find("x-id")->second, "7");
+}
+
+TEST(TestHttpParser, Parse_BuildFromMovedBuffer) {
+    HttpRequestParser parser(1024, 1024);
+    std::string buf = "PUT /x/y HTTP/1.1\r\nContent-Length: 2\r\n\r\nok";
+    ASSERT_EQ(parser.parse(buf), Status::COMPLETE);
+    std::string moved = std::move(buf);
+    HttpRequest req;
+    parser.build(moved, req);
+    EXPECT_EQ(req.method, HttpMethod::PUT);
+    EXPECT_EQ(req.path, "/x/y");
+    EXPECT_EQ(req.body, "ok");
+}
+
+TEST(TestHttpParser, Parse_KeepAliveFollowsVersionAndConnectionHeader) {
+    HttpRequestParser parser(1024, 1024);
+    std::string http11 = "GET / HTTP/1.1\r\n\r\n";
+    ASSERT_EQ(parser.parse(http11), Status::COMPLETE);
+    EXPECT_TRUE(parser.keepAlive());
+
+    parser.reset();
+    std::string close11 = "GET / HTTP/1.1\r\nConnection: Close\r\n\r\n";
+    ASSERT_EQ(parser.parse(close11), Status::COMPLETE);
+    EXPECT_FALSE(parser.keepAlive());
+
+    parser.reset();
+    std::string http10 = "GET / HTTP/1.0\r\n\r\n";
+    ASSERT_EQ(parser.parse(http10), Status::COMPLETE);
+    EXPECT_FALSE(parser.keepAlive());
+
+    parser.reset();
+    std::string keep10 = "GET / HTTP/1.0\r\nConnection: keep-alive\r\n\r\n";
+    ASSERT_EQ(parser.parse(keep10), Status::COMPLETE);
+    EXPECT_TRUE(parser.keepAlive());
+}
+
+TEST(TestHttpParser, Parse_ContentLengthOverLimit_FailsBeforeBody) {
+    HttpRequestParser parser(1024, 4);
+    std::string buf = "POST /echo HTTP/1.1\r\nContent-Length: 100\r\n\r\n";
+    EXPECT_EQ(parser.parse(buf), Status::ERROR);
+    EXPECT_STREQ(parser.error(), "Request body too large");
+}
+
+TEST(TestHttpParser, Parse_HeadersOverLimit_Fails) {
+    HttpRequestParser parser(64, 1024);
+    std::string buf = "GET / HTTP/1.1\r\nX-Pad: " + std::string(100, 'a');
+    EXPECT_EQ(parser.parse(buf), Status::ERROR);
+    EXPECT_STREQ(parser.error(), "Request headers too large");
+}
+
+TEST(TestHttpParser, Parse_MalformedInput_Fails) {
+    for (std::string buf : {
+             std::string("GARBAGE\r\n\r\n"),
+             std::string("BREW /pot HTTP/1.1\r\n\r\n"),
+             std::string("GET / HTTP/2.0\r\n\r\n"),
+             std::string("GET / HTTP/1.1\r\nNoColon\r\n\r\n"),
+             std::string("POST / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n"),
+             std::string("POST / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 2\r\n\r\n"),
+             std::string("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"),
+         }) {
+        HttpRequestParser parser(1024, 1024);
+        EXPECT_EQ(parser.parse(buf), Status::ERROR) << buf;
+    }
+}
+
+TEST(TestHttpParser, HttpFields_FindIsExact) {
+    HttpFields fields;
+    fields.add("id", "42");
+    fields.add("name", "obi");
+    EXPECT_EQ(fields.size(), 2u);
+    EXPECT_EQ(fields.find("id")->second, "42");
+    EXPECT_EQ(fields.find("ID"), fields.end());
+    fields.clear();
+    EXPECT_TRUE(fields.empty());
+}
+
+} // namespace whot::network
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "Network/MessageProtocol.hpp"
 #include "Core/GameConstants.hpp"
+#include <nlohmann/json.hpp>
 
 namespace whot::network {
 
@@ -20,6 +21,146 @@ TEST(TestMessageProtocol, Message_SerializeDeserialize_RoundTrip) {
     EXPECT_EQ(restored.timestamp, 12345u);
 }
 
+TEST(TestMessageProtocol, Message_Serialize_EmbedsJsonPayloadUnescaped) {
+    Message m;
+    m.type = MessageType::GAME_STATE_UPDATE;
+    m.playerId = "p\"1";
+    m.gameId = "g1";
+    m.payload = "{\"gameState\":{\"players\":[{\"name\":\"A\\\"b\"}]}}";
+    m.timestamp = 7;
+    const std::string frame = m.serialize();
+    EXPECT_NE(frame.find("\"payload\":{\"gameState\":{"), std::string::npos);
+    const auto j = nlohmann::json::parse(frame);
+    ASSERT_TRUE(j["payload"].is_object());
+    EXPECT_EQ(j["payload"]["gameState"]["players"][0]["name"], "A\"b");
+    EXPECT_EQ(j["playerId"], "p\"1");
+    EXPECT_EQ(Message::deserialize(frame).payload, j["payload"].dump());
+
+    m.payload = "plain \"text\"\n";
+    EXPECT_EQ(nlohmann::json::parse(m.serialize())["payload"], m.payload);
+}
+
+TEST(TestMessageProtocol, Message_Deserialize_StringPayload_StillAccepted) {
+    Message m = Message::deserialize(
+        "{\"type\":102,\"playerId\":\"p1\",\"gameId\":\"g1\","
+        "\"payload\":\"{\\\"cardIndex\\\":4}\",\"timestamp\":1}");
+    EXPECT_EQ(m.type, MessageType::PLAY_CARD);
+    EXPECT_EQ(m.payload, "{\"cardIndex\":4}");
+    EXPECT_EQ(decodePayload<PlayCardPayload>(m)->cardIndex, 4u);
+}
+
+TEST(TestMessageProtocol, Message_EncodeDecode_RoundTrip) {
+    Message m;
+    m.type = MessageType::PLAY_CARD;
+    m.playerId = "p1";
+    m.gameId = "g1";
+    m.timestamp = 1700000000000000000ULL;
+    Message asJson = m;
+    asJson.payload = "{\"cardIndex\":2}";
+    m.payloadFormat = PayloadFormat::BINARY;
+    m.payload = std::string("\x02\xff\x00", 3);
+    const std::string frame = m.encode();
+    EXPECT_LT(frame.size(), asJson.serialize().size() / 3);
+    Message restored = Message::decode(frame);
+    EXPECT_EQ(restored.type, MessageType::PLAY_CARD);
+    EXPECT_EQ(restored.payloadFormat, PayloadFormat::BINARY);
+    EXPECT_EQ(restored.playerId, "p1");
+    EXPECT_EQ(restored.gameId, "g1");
+    EXPECT_EQ(restored.timestamp, m.timestamp);
+    EXPECT_EQ(restored.payload, m.payload);
+}
+
+TEST(TestMessageProtocol, Message_Decode_Truncated_DefaultsToError) {
+    Message m;
+    m.type = MessageType::JOIN_GAME;
+    m.playerId = "player";
+    m.gameId = "game";
+    m.timestamp = 1;
+    const std::string frame = m.encode();
+    EXPECT_EQ(Message::decode(frame.substr(0, 5)).type, MessageType::ERROR);
+    EXPECT_EQ(Message::decode("").type, MessageType::ERROR);
+}
+
+TEST(TestMessageProtocol, PlayCardPayload_BinaryRoundTrip) {
+    PlayCardPayload p;
+    p.cardIndex = 300;
+    p.chosenSuit = core::Suit::STAR;
+    p.reverseDirection = false;
+    p.additionalCards = {1, 2};
+    auto restored = PlayCardPayload::fromBinary(p.toBinary());
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->cardIndex, 300u);
+    EXPECT_EQ(restored->chosenSuit, core::Suit::STAR);
+    EXPECT_EQ(restored->reverseDirection, false);
+    EXPECT_EQ(restored->additionalCards, (std::vector<size_t>{1, 2}));
+
+    Message m;
+    m.payloadFormat = PayloadFormat::BINARY;
+    m.payload = p.toBinary();
+    EXPECT_EQ(decodePayload<PlayCardPayload>(m)->cardIndex, 300u);
+    m.payloadFormat = PayloadFormat::JSON;
+    m.payload = p.toJson();
+    EXPECT_EQ(decodePayload<PlayCardPayload>(m)->cardIndex, 300u);
+}
+
+TEST(TestMessageProtocol, PlayCardPayload_FromBinary_RejectsMalformedFrames) {
+    PlayCardPayload p;
+    p.cardIndex = 3;
+    p.additionalCards = {1, 2};
+    const std::string frame = p.toBinary();
+    ASSERT_TRUE(PlayCardPayload::fromBinary(frame).has_value());
+    // Cut inside additionalCards: the primary card must not play alone.
+    EXPECT_FALSE(PlayCardPayload::fromBinary(frame.substr(0, frame.size() - 1)).has_value());
+    EXPECT_FALSE(PlayCardPayload::fromBinary(frame.substr(0, 2)).has_value());
+    EXPECT_FALSE(PlayCardPayload::fromBinary("").has_value());
+    EXPECT_FALSE(PlayCardPayload::fromBinary(frame + '\x01').has_value());
+
+    std::string badSuit = frame;
+    badSuit[1] = '\x09';
+    EXPECT_FALSE(PlayCardPayload::fromBinary(badSuit).has_value());
+    std::string badReverse = frame;
+    badReverse[2] = '\x02';
+    EXPECT_FALSE(PlayCardPayload::fromBinary(badReverse).has_value());
+
+    Message m;
+    m.payloadFormat = PayloadFormat::BINARY;
+    m.payload = frame.substr(0, 2);
+    EXPECT_FALSE(decodePayload<PlayCardPayload>(m).has_value());
+}
+
+TEST(TestMessageProtocol, JoinGamePayload_BinaryRoundTrip) {
+    JoinGamePayload p;
+    p.playerName = "Ada";
+    p.gameId = "g1";
+    p.gameCode = "ABC123";
+    auto restored = JoinGamePayload::fromBinary(p.toBinary());
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->playerName, "Ada");
+    EXPECT_EQ(restored->gameId, "g1");
+    EXPECT_EQ(restored->gameCode, "ABC123");
+    EXPECT_FALSE(restored->password.has_value());
+    EXPECT_FALSE(JoinGamePayload::fromBinary("\x05").has_value());
+}
+
+TEST(TestMessageProtocol, JoinGamePayload_FromBinary_RejectsInvalidUtf8) {
+    JoinGamePayload p;
+    p.playerName = "Ad\xC3";  // truncated two-byte sequence
+    p.gameId = "g1";
+    EXPECT_FALSE(JoinGamePayload::fromBinary(p.toBinary()).has_value());
+
+    p.playerName = "Ad\xC3\xA9";
+    p.password = std::string("\xED\xA0\x80");  // encoded surrogate
+    EXPECT_FALSE(JoinGamePayload::fromBinary(p.toBinary()).has_value());
+
+    Message m;
+    m.payloadFormat = PayloadFormat::BINARY;
+    m.payload = p.toBinary();
+    EXPECT_FALSE(decodePayload<JoinGamePayload>(m).has_value());
+    p.password.reset();
+    m.payload = p.toBinary();
+    EXPECT_EQ(decodePayload<JoinGamePayload>(m)->playerName, "Ad\xC3\xA9");
+}
+
 TEST(TestMessageProtocol, Message_Deserialize_EmptyString_DefaultsToError) {
     Message m = Message::deserialize("");
     EXPECT_EQ(m.type, MessageType::ERROR);
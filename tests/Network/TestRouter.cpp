@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "Network/Router.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace whot::network {
+
+TEST(TestRouter, Find_LiteralAndParameterRoutes) {
+    Router router;
+    router.add(HttpMethod::GET, "/api/games", 1);
+    router.add(HttpMethod::GET, "/api/games/:id", 2);
+    router.add(HttpMethod::POST, "/api/games/:id/join", 3);
+    router.add(HttpMethod::GET, "/", 4);
+
+    PathParams params;
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games", params).route, 1u);
+    EXPECT_TRUE(params.empty());
+    EXPECT_EQ(router.find(HttpMethod::GET, "/", params).route, 4u);
+
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games/abc", params).route, 2u);
+    ASSERT_NE(params.find("id"), params.end());
+    EXPECT_EQ(params.find("id")->second, "abc");
+
+    EXPECT_EQ(router.find(HttpMethod::POST, "/api/games/g1/join", params).route, 3u);
+    EXPECT_EQ(params.find("id")->second, "g1");
+
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games/", params).route, Router::kNoRoute);
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games/a/b", params).route, Router::kNoRoute);
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api", params).route, Router::kNoRoute);
+    EXPECT_TRUE(params.empty());
+    EXPECT_EQ(router.size(), 4u);
+}
+
+TEST(TestRouter, Find_LiteralBeatsParameterAndBacktracks) {
+    Router router;
+    router.add(HttpMethod::POST, "/api/games/join", 1);
+    router.add(HttpMethod::GET, "/api/games/:id", 2);
+
+    PathParams params;
+    EXPECT_EQ(router.find(HttpMethod::POST, "/api/games/join", params).route, 1u);
+    // No GET on the literal node, so the parameter branch takes the path.
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games/join", params).route, 2u);
+    EXPECT_EQ(params.find("id")->second, "join");
+}
+
+TEST(TestRouter, Find_TypedParametersConstrainSegments) {
+    Router router;
+    router.add(HttpMethod::GET, "/api/replays/:n<int>", 1);
+    router.add(HttpMethod::GET, "/api/replays/:name", 2);
+    router.add(HttpMethod::GET, "/api/games/:id<uuid>", 3);
+
+    PathParams params;
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/replays/42", params).route, 1u);
+    EXPECT_EQ(params.getInt("n"), 42);
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/replays/-7", params).route, 1u);
+    EXPECT_EQ(params.getInt("n"), -7);
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/replays/latest", params).route, 2u);
+    EXPECT_EQ(params.find("name")->second, "latest");
+    EXPECT_FALSE(params.getInt("name").has_value());
+
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games/123e4567-e89b-12d3-a456-426614174000",
+                          params).route, 3u);
+    EXPECT_EQ(router.find(HttpMethod::GET, "/api/games/not-a-uuid", params).route, Router::kNoRoute);
+}
+
+TEST(TestRouter, Find_ReportsAllowedMethodsForKnownPath) {
+    Router router;
+    router.add(HttpMethod::GET, "/api/games", 1);
+    router.add(HttpMethod::POST, "/api/games", 2);
+
+    PathParams params;
+    Router::Match match = router.find(HttpMethod::DELETE, "/api/games", params);
+    EXPECT_EQ(match.route, Router::kNoRoute);
+    EXPECT_EQ(match.allowedMethods, (1u << static_cast<unsigned>(HttpMethod::GET)) |
+                                        (1u << static_cast<unsigned>(HttpMethod::POST)));
+    EXPECT_EQ(router.find(HttpMethod::DELETE, "/api/other", params).allowedMethods, 0u);
+}
+
+TEST(TestRouter, Add_ReplacesAndRejectsMalformedPatterns) {
+    Router router;
+    EXPECT_EQ(router.add(HttpMethod::GET, "/a/:x", 1), Router::kNoRoute);
+    EXPECT_EQ(router.add(HttpMethod::GET, "/a/:x", 2), 1u);
+    EXPECT_EQ(router.size(), 1u);
+    PathParams params;
+    EXPECT_EQ(router.find(HttpMethod::GET, "/a/b", params).route, 2u);
+
+    EXPECT_THROW(router.add(HttpMethod::GET, "no-slash", 3), std::invalid_argument);
+    EXPECT_THROW(router.add(HttpMethod::GET, "/a/:", 3), std::invalid_argument);
+    EXPECT_THROW(router.add(HttpMethod::GET, "/a/:x<float>", 3), std::invalid_argument);
+    EXPECT_THROW(router.add(HttpMethod::GET, "/a/:x/:x", 3), std::invalid_argument);
+    EXPECT_THROW(router.add(HttpMethod::GET, "/:a/:b/:c/:d/:e/:f/:g/:h/:i", 3), std::invalid_argument);
+}
+
+} // namespace whot::network
@@ -30,6 +30,17 @@ TEST(TestSessionManager, SetPlayerIdSetGameId) {
     EXPECT_EQ(s->gameId, "game-1");
 }
 
+TEST(TestSessionManager, GetSessionSnapshot_OutlivesDestroy) {
+    SessionManager mgr;
+    std::string sid = mgr.createSession("1.2.3.4");
+    mgr.setGameId(sid, "game-1");
+    auto snapshot = mgr.getSessionSnapshot(sid);
+    mgr.destroySession(sid);
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(snapshot->gameId, "game-1");
+    EXPECT_FALSE(mgr.getSessionSnapshot(sid).has_value());
+}
+
 TEST(TestSessionManager, GetSessionsForGame_Empty) {
     SessionManager mgr;
     auto list = mgr.getSessionsForGame("g1");
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "Network/StateDelta.hpp"
+#include "Game/GameEngine.hpp"
+#include "TestHelpers.hpp"
+#include <nlohmann/json.hpp>
+
+namespace whot::network {
+
+using json = nlohmann::json;
+
+namespace {
+void expectRoundTrip(const std::string& from, const std::string& to) {
+    const std::string patch = diffJson(from, to);
+    EXPECT_EQ(json::parse(applyJsonPatch(from, patch)), json::parse(to)) << patch;
+}
+}  // namespace
+
+TEST(TestStateDelta, DiffJson_ObjectsMergeNestedAndRemoveKeys) {
+    const std::string from = R"({"a":1,"b":{"x":1,"y":2},"gone":"v","same":[1,2]})";
+    const std::string to = R"({"a":2,"b":{"x":1,"y":3},"added":true,"same":[1,2]})";
+    EXPECT_EQ(json::parse(diffJson(from, to)),
+              json::parse(R"({"a":2,"b":{"y":3},"gone":null,"added":true})"));
+    expectRoundTrip(from, to);
+    EXPECT_EQ(diffJson(to, to), "{}");
+}
+
+TEST(TestStateDelta, DiffJson_ArraysPatchItemsOrSplice) {
+    const std::string players = R"({"p":[{"n":"a","c":5},{"n":"b","c":5},{"n":"c","c":5}]})";
+    const std::string oneCount = R"({"p":[{"n":"a","c":5},{"n":"b","c":4},{"n":"c","c":5}]})";
+    EXPECT_EQ(json::parse(diffJson(players, oneCount)),
+              json::parse(R"({"p":{"$items":{"1":{"c":4}}}})"));
+    expectRoundTrip(players, oneCount);
+
+    const std::string hand = R"({"h":["1","2","3","4"]})";
+    EXPECT_EQ(json::parse(diffJson(hand, R"({"h":["1","3","4"]})")),
+              json::parse(R"({"h":{"$splice":[1,1,[]]}})"));
+    expectRoundTrip(hand, R"({"h":["1","3","4"]})");
+    expectRoundTrip(hand, R"({"h":["1","2","3","4","5"]})");
+    expectRoundTrip(hand, R"({"h":["0","1","2","3","4"]})");
+    expectRoundTrip(hand, R"({"h":[]})");
+    expectRoundTrip(R"({"h":[]})", hand);
+    expectRoundTrip(R"({"h":{"k":1}})", hand);
+    expectRoundTrip(hand, R"({"h":{"k":1}})");
+}
+
+TEST(TestStateDelta, StateStreams_SnapshotThenPatchesWithSequence) {
+    StateStreams streams;
+    EXPECT_FALSE(streams.next("s1", R"({"a":1})").has_value());
+    streams.open("s1");
+    ASSERT_TRUE(streams.isOpen("s1"));
+
+    auto first = streams.next("s1", R"({"a":1,"b":[1]})");
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->type, MessageType::GAME_STATE_UPDATE);
+    EXPECT_EQ(json::parse(first->payload), json::parse(R"({"seq":1,"gameState":{"a":1,"b":[1]}})"));
+
+    EXPECT_FALSE(streams.next("s1", R"({"a":1,"b":[1]})").has_value());
+
+    auto patch = streams.next("s1", R"({"a":2,"b":[1]})");
+    ASSERT_TRUE(patch.has_value());
+    EXPECT_EQ(patch->type, MessageType::GAME_STATE_PATCH);
+    EXPECT_EQ(patch->payload, R"({"seq":2,"patch":{"a":2}})");
+
+    streams.resync("s1");
+    auto snapshot = streams.next("s1", R"({"a":2,"b":[1]})");
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(snapshot->type, MessageType::GAME_STATE_UPDATE);
+    EXPECT_EQ(snapshot->seq, 3u);
+
+    streams.close("s1");
+    EXPECT_FALSE(streams.isOpen("s1"));
+    EXPECT_FALSE(streams.next("s1", R"({"a":3})").has_value());
+}
+
+TEST(TestStateDelta, StateStreams_PatchPerMoveIsSmallAndReproducesView) {
+    game::GameEngine engine(test::makeGameStateWithPlayers(4));
+    engine.startGame();
+    const game::GameState& state = *engine.getState();
+    StateStreams streams;
+    streams.open("s0");
+    const std::string before = state.toJsonForPlayer("player-0");
+    ASSERT_TRUE(streams.next("s0", before).has_value());
+
+    game::GameAction draw;
+    draw.type = game::ActionType::DRAW_CARD;
+    draw.playerId = state.getCurrentPlayer()->getId();
+    ASSERT_TRUE(engine.processAction(draw).success);
+
+    const std::string after = state.toJsonForPlayer("player-0");
+    auto update = streams.next("s0", after);
+    ASSERT_TRUE(update.has_value());
+    EXPECT_EQ(update->type, MessageType::GAME_STATE_PATCH);
+    EXPECT_LT(update->payload.size() * 5, after.size());
+    const auto patch = json::parse(update->payload)["patch"].dump();
+    EXPECT_EQ(json::parse(applyJsonPatch(before, patch)), json::parse(after));
+}
+
+TEST(TestStateDelta, StateStreams_FramePatchesReproduceEveryViewersView) {
+    game::GameEngine engine(test::makeGameStateWithPlayers(4));
+    engine.startGame();
+    const game::GameState& state = *engine.getState();
+    const std::vector<std::string> viewers = {"player-0", "player-1", "player-2", "player-3", "spectator"};
+    StateStreams streams;
+    std::vector<json> seen(viewers.size());
+    for (const auto& id : viewers) streams.open(id);
+
+    auto broadcast = [&] {
+        const auto& view = state.renderView(game::StateView::Format::JSON);
+        StateStreams::Frame frame(view.shared());
+        for (size_t i = 0; i < viewers.size(); ++i) {
+            const std::string full = view.forPlayer(viewers[i]);
+            const auto seat = view.seatOf(viewers[i]);
+            auto update = seat ? streams.next(viewers[i], frame, full, seat->index, seat->hand)
+                               : streams.next(viewers[i], frame, full);
+            if (!update) {
+                EXPECT_EQ(seen[i], json::parse(full)) << viewers[i];
+                continue;
+            }
+            const json payload = json::parse(update->payload);
+            if (update->type == MessageType::GAME_STATE_UPDATE) seen[i] = payload["gameState"];
+            else seen[i] = json::parse(applyJsonPatch(seen[i].dump(), payload["patch"].dump()));
+            EXPECT_EQ(seen[i], json::parse(full)) << viewers[i];
+        }
+    };
+    auto draw = [&] {
+        game::GameAction action;
+        action.type = game::ActionType::DRAW_CARD;
+        action.playerId = state.getCurrentPlayer()->getId();
+        ASSERT_TRUE(engine.processAction(action).success);
+    };
+
+    broadcast();
+    for (int i = 0; i < 6; ++i) {
+        draw();
+        broadcast();
+    }
+    broadcast();  // unchanged: nothing sent
+    engine.removePlayer("player-1");  // later seats move
+    broadcast();
+    draw();
+    broadcast();
+}
+
+} // namespace whot::network
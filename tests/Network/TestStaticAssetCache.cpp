@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "Network/StaticAssetCache.hpp"
+#include "Utils/Compression.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+namespace whot::network {
+
+namespace fs = std::filesystem;
+
+namespace {
+class StaticRoot {
+public:
+    StaticRoot() : dir_(fs::temp_directory_path() / ("whot_static_" + std::to_string(getpid()))) {
+        fs::remove_all(dir_);
+        fs::create_directories(dir_ / "js");
+    }
+    ~StaticRoot() { fs::remove_all(dir_); }
+    void write(const std::string& rel, const std::string& content) {
+        std::ofstream(dir_ / rel, std::ios::binary) << content;
+    }
+    const fs::path& path() const { return dir_; }
+
+private:
+    fs::path dir_;
+};
+
+std::string bigScript() {
+    std::string s;
+    for (int i = 0; i < 100; ++i) s += "function card" + std::to_string(i) + "() { return 'whot'; }\n";
+    return s;
+}
+}  // namespace
+
+TEST(TestStaticAssetCache, Load_ServesFromMemoryWithMetadata) {
+    StaticRoot root;
+    root.write("index.html", "<html></html>");
+    root.write("js/game.js", bigScript());
+    StaticAssetCache cache(root.path());
+    cache.load();
+    EXPECT_EQ(cache.size(), 2u);
+
+    auto index = cache.lookup("/");
+    ASSERT_NE(index, nullptr);
+    EXPECT_EQ(index->body, "<html></html>");
+    EXPECT_EQ(index->contentType, "text/html; charset=utf-8");
+    EXPECT_EQ(index->cacheControl, "no-cache");
+    EXPECT_TRUE(index->gzipBody.empty());  // too small to be worth it
+
+    auto js = cache.lookup("/js/game.js");
+    ASSERT_NE(js, nullptr);
+    EXPECT_EQ(js->contentType, "application/javascript; charset=utf-8");
+    ASSERT_FALSE(js->gzipBody.empty());
+    EXPECT_LT(js->gzipBody.size(), js->body.size());
+    EXPECT_EQ(utils::Compression::gunzip(js->gzipBody), js->body);
+    EXPECT_EQ(js->etag.front(), '"');
+    EXPECT_EQ(js->etag.back(), '"');
+}
+
+TEST(TestStaticAssetCache, Lookup_RejectsPathsOutsideRoot) {
+    StaticRoot root;
+    root.write("index.html", "x");
+    StaticAssetCache cache(root.path());
+    cache.load();
+    EXPECT_EQ(cache.lookup("/../etc/passwd"), nullptr);
+    EXPECT_EQ(cache.lookup("/js/../index.html"), nullptr);
+    EXPECT_EQ(cache.lookup("/missing.js"), nullptr);
+}
+
+TEST(TestStaticAssetCache, Lookup_ReloadsChangedFile) {
+    StaticRoot root;
+    root.write("index.html", "v1");
+    StaticAssetCache cache(root.path());
+    cache.setRevalidateInterval(std::chrono::milliseconds(0));
+    cache.load();
+    auto v1 = cache.lookup("/index.html");
+    ASSERT_NE(v1, nullptr);
+    root.write("index.html", "version two");
+    fs::last_write_time(root.path() / "index.html", v1->mtime + std::chrono::seconds(1));
+    auto v2 = cache.lookup("/index.html");
+    ASSERT_NE(v2, nullptr);
+    EXPECT_EQ(v2->body, "version two");
+    EXPECT_NE(v2->etag, v1->etag);
+}
+
+TEST(TestStaticAssetCache, Lookup_PicksUpPrecompressedVariants) {
+    StaticRoot root;
+    root.write("js/game.js", bigScript());
+    root.write("js/game.js.br", "tiny-brotli");
+    StaticAssetCache cache(root.path());
+    cache.load();
+    EXPECT_EQ(cache.size(), 1u);  // variants are not assets of their own
+    auto js = cache.lookup("/js/game.js");
+    ASSERT_NE(js, nullptr);
+    EXPECT_EQ(js->brotliBody, "tiny-brotli");
+}
+
+} // namespace whot::network
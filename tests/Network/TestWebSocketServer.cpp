@@ -30,4 +30,23 @@ TEST(TestWebSocketServer, SetMessageHandler_DeserializeEmpty_NoCrash) {
     ws.stop();
 }
 
+TEST(TestWebSocketServer, StartStop_WithIoThreadPool) {
+    WebSocketServer ws(9094);
+    ws.setIoThreads(4);
+    ws.start();
+    EXPECT_TRUE(ws.isRunning());
+    ws.stop();
+    EXPECT_FALSE(ws.isRunning());
+}
+
+TEST(TestWebSocketServer, Start_PortInUse_NotRunning) {
+    WebSocketServer first(9095);
+    first.start();
+    ASSERT_TRUE(first.isRunning());
+    WebSocketServer second(9095);
+    second.start();
+    EXPECT_FALSE(second.isRunning());
+    first.stop();
+}
+
 } // namespace whot::network
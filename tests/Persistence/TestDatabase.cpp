@@ -44,11 +44,13 @@ TEST(TestDatabase, QueryMany) {
 TEST(TestDatabase, Transaction) {
     auto db = createInMemoryDatabase();
     ASSERT_NE(db, nullptr);
-    db->beginTransaction();
+    EXPECT_TRUE(db->beginTransaction());
     db->execute("CREATE TABLE IF NOT EXISTS t4 (id INTEGER)");
-    db->commit();
-    db->beginTransaction();
-    db->rollback();
+    EXPECT_TRUE(db->commit());
+    EXPECT_TRUE(db->beginTransaction());
+    EXPECT_FALSE(db->beginTransaction());  // already inside one
+    EXPECT_TRUE(db->rollback());
+    EXPECT_FALSE(db->commit());  // nothing to commit
 }
 
 TEST(TestDatabase, GetCurrentSchemaVersion) {
@@ -65,4 +67,51 @@ TEST(TestDatabase, Execute_InvalidSql_NoCrash) {
     EXPECT_FALSE(ok);
 }
 
+TEST(TestDatabase, BoundQueries_ReusePreparedStatements) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    ASSERT_TRUE(db->execute("CREATE TABLE t6 (id INTEGER, name TEXT)"));
+    const auto before = db->getStatementCacheStats();
+    for (int64_t i = 0; i < 5; ++i)
+        ASSERT_TRUE(db->executeBound("INSERT INTO t6 (id, name) VALUES (?, ?)",
+                                     {i, "n" + std::to_string(i)}));
+    // Bindings are cleared and the cursor reset between uses.
+    EXPECT_EQ(db->queryOneBound("SELECT name FROM t6 WHERE id = ?", {int64_t{3}}), "n3");
+    EXPECT_EQ(db->queryOneBound("SELECT name FROM t6 WHERE id = ?", {int64_t{1}}), "n1");
+    EXPECT_EQ(db->queryManyBound("SELECT id FROM t6 WHERE id >= ? ORDER BY id", {int64_t{3}}).size(), 2u);
+
+    const auto stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.misses - before.misses, 3u);
+    EXPECT_EQ(stats.hits - before.hits, 5u);
+    EXPECT_GT(stats.prepareTime.count(), 0);
+    db->disconnect();  // finalizes cached statements so the close succeeds
+    EXPECT_FALSE(db->isConnected());
+}
+
+TEST(TestDatabase, StatementCache_EvictsLeastRecentlyUsed) {
+    auto config = makeInMemoryDbConfig();
+    config.statementCacheSize = 2;
+    auto db = DatabaseFactory::create(config);
+    ASSERT_NE(db, nullptr);
+    ASSERT_TRUE(db->connect());
+    db->queryOneBound("SELECT ?", {int64_t{1}});
+    db->queryOneBound("SELECT ? + 1", {int64_t{1}});
+    db->queryOneBound("SELECT ?", {int64_t{2}});      // hit; "SELECT ? + 1" is now oldest
+    db->queryOneBound("SELECT ? + 2", {int64_t{1}});  // evicts "SELECT ? + 1"
+    EXPECT_EQ(db->queryOneBound("SELECT ?", {int64_t{7}}), "7");
+    auto stats = db->getStatementCacheStats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 3u);
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.size, 2u);
+
+    config.statementCacheSize = 0;
+    auto uncached = DatabaseFactory::create(config);
+    ASSERT_TRUE(uncached->connect());
+    EXPECT_EQ(uncached->queryOneBound("SELECT ?", {int64_t{4}}), "4");
+    EXPECT_EQ(uncached->queryOneBound("SELECT ?", {int64_t{5}}), "5");
+    EXPECT_EQ(uncached->getStatementCacheStats().misses, 2u);
+    EXPECT_EQ(uncached->getStatementCacheStats().size, 0u);
+}
+
 } // namespace whot::persistence
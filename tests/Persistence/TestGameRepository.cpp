@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "Persistence/GameRepository.hpp"
+#include "Game/GameEngine.hpp"
 #include "Game/GameState.hpp"
 #include "TestHelpers.hpp"
 
@@ -55,4 +56,73 @@ TEST(TestGameRepository, GetActiveGames) {
     EXPECT_TRUE(list.empty() || !list.empty());
 }
 
+TEST(TestGameRepository, LoadGame_RestoresDeckFromSnapshot) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    auto state = whot::test::makeGameStateWithPlayers(2);
+    state->startRound();
+    const core::Card top = *state->getDeck().draw();
+    state->addToDiscardPile(top);
+    state->setCallCard(top);
+    ASSERT_TRUE(repo.saveGame(*state));
+    auto loaded = repo.loadGame(state->getGameId());
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->toSnapshot(), state->toSnapshot());
+    EXPECT_EQ(loaded->getDeck().toJson(), state->getDeck().toJson());
+}
+
+TEST(TestGameRepository, Blob_RoundTripsEmbeddedNul) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    const std::string bytes("a\0b\xff", 4);
+    ASSERT_TRUE(db->execute("CREATE TABLE blobs (b BLOB)"));
+    ASSERT_TRUE(db->executeBound("INSERT INTO blobs (b) VALUES (?)", {SqlBlob{bytes}}));
+    auto read = db->queryOneBound("SELECT b FROM blobs WHERE length(b) = ?", {int64_t{4}});
+    ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(*read, bytes);
+}
+
+TEST(TestGameRepository, Journal_AppendedPerSaveAndReloaded) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    game::GameEngine engine(makeGameStateWithPlayers(3));
+    const std::string gameId = engine.getState()->getGameId();
+    auto save = [&] {
+        GameWrite write = GameRepository::captureGame(*engine.getState());
+        write.journal = engine.takeUnsavedJournal();
+        return repo.writeGame(write);
+    };
+    ASSERT_TRUE(save());
+    EXPECT_FALSE(repo.loadJournal(gameId).has_value());  // not started: no journal
+
+    engine.startGame();
+    engine.startNewRound();
+    ASSERT_TRUE(save());
+    engine.removePlayer("player-2");
+    ASSERT_TRUE(save());
+    ASSERT_TRUE(save());  // nothing new
+    auto loaded = repo.loadJournal(gameId);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->bytes(), engine.getJournal().bytes());
+
+    // A restarted game's journal replaces the stored one.
+    engine.startGame();
+    ASSERT_TRUE(save());
+    loaded = repo.loadJournal(gameId);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->bytes(), engine.getJournal().bytes());
+
+    // A lost chunk leaves a gap; the journal is not trusted past it.
+    engine.startNewRound();
+    engine.takeUnsavedJournal();
+    engine.endGame();
+    ASSERT_TRUE(save());
+    EXPECT_FALSE(repo.loadJournal(gameId).has_value());
+
+    EXPECT_TRUE(repo.deleteGame(gameId));
+    EXPECT_FALSE(db->queryOneBound("SELECT game_id FROM game_journal WHERE game_id = ?", {gameId}));
+}
+
 } // namespace whot::persistence
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "Persistence/WriteBehindQueue.hpp"
+#include "Persistence/GameRepository.hpp"
+#include "Game/GameEngine.hpp"
+#include "Game/GameState.hpp"
+#include "TestHelpers.hpp"
+#include <chrono>
+
+namespace whot::persistence {
+
+using namespace whot::test;
+
+namespace {
+/// Long enough that only flush(), stop() or a full queue commits a batch.
+WriteQueueConfig slowFlush(size_t capacity = 1024) {
+    WriteQueueConfig config;
+    config.flushInterval = std::chrono::seconds(30);
+    config.capacity = capacity;
+    return config;
+}
+}  // namespace
+
+TEST(TestWriteBehindQueue, NotRunning_WritesInline) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    WriteBehindQueue queue(*db, repo);
+    auto state = makeGameStateWithPlayers(2);
+    queue.saveGame(*state);
+    EXPECT_TRUE(repo.loadGame(state->getGameId()).has_value());
+    EXPECT_EQ(queue.getStats().written, 1u);
+    EXPECT_EQ(queue.getStats().batches, 0u);
+}
+
+TEST(TestWriteBehindQueue, CoalescesSavesIntoOneBatch) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    WriteBehindQueue queue(*db, repo, slowFlush());
+    queue.start();
+    auto state = makeGameStateWithPlayers(2);
+    auto other = makeGameStateWithPlayers(3);
+    for (int i = 0; i < 5; ++i) {
+        state->getAllPlayers()[0]->addToScore(1);
+        queue.saveGame(*state);
+    }
+    queue.saveGame(*other);
+    bool ran = false;
+    queue.post([&] { ran = true; });
+    EXPECT_EQ(queue.pendingCount(), 3u);
+    EXPECT_FALSE(repo.loadGame(state->getGameId()).has_value());
+
+    queue.flush();
+    EXPECT_TRUE(ran);
+    EXPECT_EQ(queue.pendingCount(), 0u);
+    auto loaded = repo.loadGame(state->getGameId());
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->toJson(), state->toJson());  // last save wins
+    EXPECT_TRUE(repo.loadGame(other->getGameId()).has_value());
+    const auto stats = queue.getStats();
+    EXPECT_EQ(stats.enqueued, 7u);
+    EXPECT_EQ(stats.coalesced, 4u);
+    EXPECT_EQ(stats.written, 3u);
+    EXPECT_EQ(stats.failed, 0u);
+    EXPECT_EQ(stats.batches, 1u);
+}
+
+TEST(TestWriteBehindQueue, DeleteReplacesPendingSave) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    auto state = makeGameStateWithPlayers(2);
+    ASSERT_TRUE(repo.saveGame(*state));
+    WriteBehindQueue queue(*db, repo, slowFlush());
+    queue.start();
+    queue.saveGame(*state);
+    queue.deleteGame(state->getGameId());
+    EXPECT_EQ(queue.pendingCount(), 1u);
+    queue.flush();
+    EXPECT_FALSE(repo.loadGame(state->getGameId()).has_value());
+}
+
+TEST(TestWriteBehindQueue, StopCommitsPendingAndFullQueueFlushes) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    WriteBehindQueue queue(*db, repo, slowFlush(2));
+    queue.start();
+    auto a = makeGameStateWithPlayers(2);
+    auto b = makeGameStateWithPlayers(2);
+    auto c = makeGameStateWithPlayers(2);
+    queue.saveGame(*a);
+    queue.saveGame(*b);
+    queue.saveGame(*c);  // waits for {a, b} to be committed
+    EXPECT_TRUE(repo.loadGame(a->getGameId()).has_value());
+    EXPECT_EQ(queue.pendingCount(), 1u);
+
+    queue.stop();
+    EXPECT_FALSE(queue.isRunning());
+    EXPECT_TRUE(repo.loadGame(c->getGameId()).has_value());
+    EXPECT_EQ(queue.getStats().batches, 2u);
+}
+
+TEST(TestWriteBehindQueue, FailedCommitRollsBackBatch) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    ASSERT_TRUE(db->execute("PRAGMA foreign_keys = ON"));
+    GameRepository repo(db.get());
+    WriteBehindQueue queue(*db, repo, slowFlush());
+    queue.start();
+    game::GameEngine engine(makeGameStateWithPlayers(3));
+    engine.startGame();
+    engine.startNewRound();
+    const std::string gameId = engine.getState()->getGameId();
+    queue.saveGame(*engine.getState(), engine.takeUnsavedJournal());
+    queue.post([&] {
+        // A deferred foreign-key violation makes the batch's COMMIT fail.
+        db->execute("PRAGMA defer_foreign_keys = ON");
+        db->execute("INSERT INTO game_players (game_id, player_id) VALUES ('missing', 'missing')");
+    });
+    queue.flush();
+    EXPECT_FALSE(repo.loadGame(gameId).has_value());
+    EXPECT_FALSE(repo.loadJournal(gameId).has_value());
+    auto stats = queue.getStats();
+    EXPECT_EQ(stats.rolledBack, 1u);
+    EXPECT_EQ(stats.batches, 0u);
+    EXPECT_EQ(stats.failed, 1u);
+
+    // The failed transaction was closed, so the next batch commits, and the
+    // rolled-back journal bytes go out with it.
+    engine.removePlayer("player-2");
+    queue.saveGame(*engine.getState(), engine.takeUnsavedJournal());
+    queue.flush();
+    EXPECT_TRUE(repo.loadGame(gameId).has_value());
+    EXPECT_EQ(queue.getStats().batches, 1u);
+    auto journal = repo.loadJournal(gameId);
+    ASSERT_TRUE(journal.has_value());
+    EXPECT_EQ(journal->bytes(), engine.getJournal().bytes());
+}
+
+TEST(TestWriteBehindQueue, CoalescedSaves_KeepEveryJournalByte) {
+    auto db = createInMemoryDatabase();
+    ASSERT_NE(db, nullptr);
+    GameRepository repo(db.get());
+    WriteBehindQueue queue(*db, repo, slowFlush());
+    queue.start();
+    game::GameEngine engine(makeGameStateWithPlayers(3));
+    engine.startGame();
+    engine.startNewRound();
+    queue.saveGame(*engine.getState(), engine.takeUnsavedJournal());
+    engine.removePlayer("player-2");
+    queue.saveGame(*engine.getState(), engine.takeUnsavedJournal());
+    queue.saveGame(*engine.getState(), engine.takeUnsavedJournal());
+    EXPECT_EQ(queue.pendingCount(), 1u);
+
+    queue.flush();
+    auto journal = repo.loadJournal(engine.getState()->getGameId());
+    ASSERT_TRUE(journal.has_value());
+    EXPECT_EQ(journal->bytes(), engine.getJournal().bytes());
+}
+
+} // namespace whot::persistence
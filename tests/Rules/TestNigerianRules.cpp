@@ -44,7 +44,7 @@ TEST(TestNigerianRules, CanDefendAgainstAttack) {
 
 TEST(TestNigerianRules, ValidateDoubleDecking_Empty) {
     NigerianRules r;
-    std::vector<const core::Card*> cards;
+    std::vector<core::Card> cards;
     core::Card call(core::Suit::CIRCLE, core::CardValue::FIVE);
     EXPECT_FALSE(r.validateDoubleDecking(cards, call));
 }
@@ -52,7 +52,7 @@ TEST(TestNigerianRules, ValidateDoubleDecking_Empty) {
 TEST(TestNigerianRules, CalculateScore) {
     NigerianRules r;
     core::Hand hand;
-    hand.addCard(std::make_unique<core::Card>(core::Suit::CIRCLE, core::CardValue::FIVE));
+    hand.addCard(core::Card(core::Suit::CIRCLE, core::CardValue::FIVE));
     EXPECT_EQ(r.calculateScore(hand), 5);
 }
 
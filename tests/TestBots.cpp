@@ -3,6 +3,7 @@
 #include "TestHelpers.hpp"
 #include "Core/Player.hpp"
 #include "Game/GameState.hpp"
+#include <chrono>
 
 namespace whot {
 
@@ -62,4 +63,33 @@ TEST(TestBots, NoAutoStart_WithBots) {
     EXPECT_EQ(eng->getState()->getPhase(), game::GamePhase::LOBBY);
 }
 
+TEST(TestBots, RunBotTurns_DoesNotSleepForThinkingDelay) {
+    ApplicationConfig config;
+    config.dbConfig = makeInMemoryDbConfig();
+    config.httpPort = 0;
+    config.websocketPort = 0;
+    Application app(config);
+    app.initialize();
+    std::string gameId = app.createGame(game::GameConfig{});
+    app.addBotsToGame(gameId, 2);
+    game::GameEngine* eng = app.getGame(gameId);
+    ASSERT_NE(eng, nullptr);
+    eng->startGame();
+    eng->startNewRound();
+    const size_t deckBefore = eng->getState()->getDeck().size();
+    const core::Card callBefore = *eng->getState()->getCallCard();
+
+    // Timers are not started, so bot turns fire immediately instead of after
+    // the 2s EASY thinking delay each.
+    const auto start = std::chrono::steady_clock::now();
+    app.runBotTurnsIfNeeded(gameId);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(elapsed, std::chrono::seconds(2));
+    game::GameState* st = eng->getState();
+    ASSERT_TRUE(st->getCallCard().has_value());
+    EXPECT_TRUE(st->getPhase() != game::GamePhase::IN_PROGRESS ||
+                st->getDeck().size() != deckBefore || *st->getCallCard() != callBefore);
+}
+
 } // namespace whot
@@ -36,7 +36,7 @@ TEST(TestGameplayFlows, Flow_CreateJoinByCodeStart_StateCorrect) {
     EXPECT_EQ(eng->getState()->getPhase(), game::GamePhase::IN_PROGRESS);
     EXPECT_EQ(eng->getState()->getCurrentPlayerIndex(), 0);
     EXPECT_EQ(eng->getState()->getPlayerCount(), 2u);
-    EXPECT_NE(eng->getState()->getCallCard(), nullptr);
+    EXPECT_TRUE(eng->getState()->getCallCard().has_value());
 }
 
 TEST(TestGameplayFlows, Visibility_OtherPlayersHandsHiddenInJson) {
@@ -4,15 +4,15 @@
 namespace whot {
 namespace test {
 
-std::unique_ptr<core::Card> makeCard(core::Suit suit, core::CardValue value) {
-    return std::make_unique<core::Card>(suit, value);
+core::Card makeCard(core::Suit suit, core::CardValue value) {
+    return core::Card(suit, value);
 }
 
 std::unique_ptr<core::Hand> makeHandWithCards(
     const std::vector<std::pair<core::Suit, core::CardValue>>& cards) {
     auto hand = std::make_unique<core::Hand>(static_cast<int>(cards.size()));
     for (const auto& p : cards)
-        hand->addCard(std::make_unique<core::Card>(p.first, p.second));
+        hand->addCard(core::Card(p.first, p.second));
     return hand;
 }
 
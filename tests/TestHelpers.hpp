@@ -16,7 +16,7 @@ namespace whot {
 namespace test {
 
 // --- Factory helpers ---
-std::unique_ptr<core::Card> makeCard(core::Suit suit, core::CardValue value);
+core::Card makeCard(core::Suit suit, core::CardValue value);
 
 std::unique_ptr<core::Hand> makeHandWithCards(
     const std::vector<std::pair<core::Suit, core::CardValue>>& cards);
@@ -68,7 +68,7 @@ TEST(TestStartGame, StartGame_TransitionsToInProgress) {
     const game::GameEngine* eng = app.getGame(gameId);
     ASSERT_NE(eng, nullptr);
     EXPECT_EQ(eng->getState()->getPhase(), game::GamePhase::IN_PROGRESS);
-    EXPECT_NE(eng->getState()->getCallCard(), nullptr);
+    EXPECT_TRUE(eng->getState()->getCallCard().has_value());
 }
 
 } // namespace whot
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "Utils/ByteStream.hpp"
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace whot::utils {
+
+TEST(TestByteStream, Varints_RoundTripAndStayShort) {
+    std::string buf;
+    ByteWriter w(buf);
+    w.varint(0);
+    w.varint(127);
+    w.varint(128);
+    w.varint(std::numeric_limits<uint64_t>::max());
+    w.svarint(-1);
+    w.svarint(std::numeric_limits<int64_t>::min());
+    EXPECT_EQ(buf.size(), 1u + 1u + 2u + 10u + 1u + 10u);
+
+    ByteReader r(buf);
+    EXPECT_EQ(r.varint(), 0u);
+    EXPECT_EQ(r.varint(), 127u);
+    EXPECT_EQ(r.varint(), 128u);
+    EXPECT_EQ(r.varint(), std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(r.svarint(), -1);
+    EXPECT_EQ(r.svarint(), std::numeric_limits<int64_t>::min());
+    EXPECT_TRUE(r.ok());
+    EXPECT_TRUE(r.atEnd());
+}
+
+TEST(TestByteStream, Strings_AndRest) {
+    std::string buf;
+    ByteWriter w(buf);
+    w.str("hello");
+    w.u8(7);
+    w.bytes("tail");
+    ByteReader r(buf);
+    EXPECT_EQ(r.str(), "hello");
+    EXPECT_EQ(r.u8(), 7);
+    EXPECT_EQ(r.rest(), "tail");
+    EXPECT_TRUE(r.ok());
+}
+
+TEST(TestByteStream, Truncated_FailsSticky) {
+    std::string buf;
+    ByteWriter(buf).str("hello");
+    ByteReader r(std::string_view(buf).substr(0, 3));
+    EXPECT_EQ(r.str(), "");
+    EXPECT_FALSE(r.ok());
+    EXPECT_EQ(r.u8(), 0);
+    EXPECT_EQ(r.rest(), "");
+
+    ByteReader endless("\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff");
+    endless.varint();
+    EXPECT_FALSE(endless.ok());
+}
+
+TEST(TestByteStream, U64AndChecksum) {
+    std::string buf;
+    ByteWriter w(buf);
+    w.u64(0x0102030405060708ULL);
+    w.u64(~0ULL);
+    EXPECT_EQ(buf.size(), 16u);
+    EXPECT_EQ(buf[0], '\x08');  // little-endian
+    ByteReader r(buf);
+    EXPECT_EQ(r.u64(), 0x0102030405060708ULL);
+    EXPECT_EQ(r.u64(), ~0ULL);
+    EXPECT_TRUE(r.atEnd());
+    EXPECT_EQ(r.u64(), 0u);
+    EXPECT_FALSE(r.ok());
+
+    EXPECT_EQ(checksum64(""), 0xcbf29ce484222325ULL);
+    EXPECT_EQ(checksum64("a"), 0xaf63dc4c8601ec8cULL);
+    EXPECT_NE(checksum64("ab"), checksum64("ba"));
+}
+
+} // namespace whot::utils
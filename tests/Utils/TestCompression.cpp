@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "Utils/Compression.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace whot::utils {
+
+TEST(TestCompression, Gzip_RoundTrips) {
+    std::string text;
+    for (int i = 0; i < 200; ++i) text += "{\"suit\":\"CIRCLE\",\"value\":" + std::to_string(i % 14) + "},";
+    std::string packed = Compression::gzip(text);
+    ASSERT_GE(packed.size(), 2u);
+    EXPECT_EQ(static_cast<unsigned char>(packed[0]), 0x1f);  // gzip magic
+    EXPECT_EQ(static_cast<unsigned char>(packed[1]), 0x8b);
+    EXPECT_LT(packed.size(), text.size() / 4);
+    EXPECT_EQ(Compression::gunzip(packed), text);
+}
+
+TEST(TestCompression, Gzip_EmptyInput) {
+    EXPECT_EQ(Compression::gunzip(Compression::gzip("")), "");
+}
+
+TEST(TestCompression, Gunzip_CorruptInputThrows) {
+    EXPECT_THROW(Compression::gunzip("not gzip at all"), std::runtime_error);
+    std::string packed = Compression::gzip(std::string(1000, 'a'));
+    EXPECT_THROW(Compression::gunzip(packed.substr(0, packed.size() / 2)), std::runtime_error);
+}
+
+TEST(TestCompression, Compress_ZlibRoundTripsThroughInflate) {
+    const std::string text(5000, 'w');
+    std::string packed = Compression::compress(text, Compression::Format::ZLIB, 6);
+    EXPECT_EQ(static_cast<unsigned char>(packed[0]) & 0x0f, 8);  // zlib header: deflate method
+    EXPECT_EQ(Compression::inflate(packed), text);
+}
+
+TEST(TestCompression, Compress_IncompressibleInputOutgrowsReservation) {
+    // Random bytes do not shrink, so the output buffer has to grow.
+    std::string noise(200 * 1024, '\0');
+    uint32_t x = 2463534242u;
+    for (char& c : noise) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        c = static_cast<char>(x);
+    }
+    const std::string packed = Compression::compress(noise, Compression::Format::GZIP, 6);
+    EXPECT_GT(packed.size(), noise.size() / 2);
+    EXPECT_EQ(Compression::gunzip(packed), noise);
+}
+
+TEST(TestCompression, Compress_ReusedStreamSwitchesFormatAndLevel) {
+    const std::string text = "{\"players\":[" + std::string(3000, '1') + "]}";
+    for (int round = 0; round < 3; ++round) {
+        EXPECT_EQ(Compression::gunzip(Compression::compress(text, Compression::Format::GZIP, 1)), text);
+        EXPECT_EQ(Compression::inflate(Compression::compress(text, Compression::Format::ZLIB, 9)), text);
+    }
+}
+
+} // namespace whot::utils
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "Utils/Executor.hpp"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace whot::utils {
+
+TEST(TestExecutor, WorkerPool_NotRunning_SubmitRunsInline) {
+    WorkerPool pool(2);
+    bool ran = false;
+    pool.submit([&] { ran = true; });
+    EXPECT_TRUE(ran);
+    EXPECT_FALSE(pool.isRunning());
+}
+
+TEST(TestExecutor, WorkerPool_StopRunsQueuedTasks) {
+    WorkerPool pool(2);
+    pool.start();
+    std::atomic<int> count{0};
+    for (int i = 0; i < 100; ++i)
+        pool.submit([&] { ++count; });
+    pool.stop();
+    EXPECT_EQ(count.load(), 100);
+    EXPECT_FALSE(pool.isRunning());
+}
+
+TEST(TestExecutor, Strand_Inline_RunsBeforePostReturns) {
+    WorkerPool pool(1);
+    auto strand = std::make_shared<Strand>(pool);
+    int value = 0;
+    strand->post([&] { value = 42; });
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(strand->pendingCount(), 0u);
+}
+
+TEST(TestExecutor, Strand_NestedPost_RunsAfterCurrentTask) {
+    WorkerPool pool(1);
+    auto strand = std::make_shared<Strand>(pool);
+    std::vector<int> order;
+    strand->post([&] {
+        strand->post([&] { order.push_back(2); });
+        order.push_back(1);
+    });
+    ASSERT_EQ(order.size(), 2u);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+}
+
+TEST(TestExecutor, Strand_DispatchOnStrand_RunsImmediately) {
+    WorkerPool pool(1);
+    auto strand = std::make_shared<Strand>(pool);
+    std::vector<int> order;
+    strand->post([&] {
+        EXPECT_TRUE(strand->runningInThisThread());
+        strand->dispatch([&] { order.push_back(1); });
+        order.push_back(2);
+    });
+    EXPECT_FALSE(strand->runningInThisThread());
+    ASSERT_EQ(order.size(), 2u);
+    EXPECT_EQ(order[0], 1);
+}
+
+TEST(TestExecutor, Strand_TaskException_DoesNotStopLaterTasks) {
+    WorkerPool pool(1);
+    auto strand = std::make_shared<Strand>(pool);
+    bool ran = false;
+    strand->post([] { throw std::runtime_error("boom"); });
+    strand->post([&] { ran = true; });
+    EXPECT_TRUE(ran);
+}
+
+TEST(TestExecutor, Strand_Pooled_TasksNeverOverlapAndKeepOrder) {
+    WorkerPool pool(4);
+    pool.start();
+    auto strand = std::make_shared<Strand>(pool);
+    std::atomic<int> inFlight{0};
+    std::atomic<bool> overlapped{false};
+    std::vector<int> order;
+    const int taskCount = 500;
+    for (int i = 0; i < taskCount; ++i) {
+        strand->post([&, i] {
+            if (inFlight.fetch_add(1) != 0) overlapped = true;
+            order.push_back(i);
+            inFlight.fetch_sub(1);
+        });
+    }
+    pool.stop();
+    EXPECT_FALSE(overlapped.load());
+    ASSERT_EQ(order.size(), static_cast<size_t>(taskCount));
+    for (int i = 0; i < taskCount; ++i)
+        EXPECT_EQ(order[i], i);
+}
+
+TEST(TestExecutor, Strand_Pooled_DifferentStrandsRunInParallel) {
+    WorkerPool pool(2);
+    pool.start();
+    auto a = std::make_shared<Strand>(pool);
+    auto b = std::make_shared<Strand>(pool);
+    std::promise<void> aStarted;
+    std::promise<void> bDone;
+    auto bDoneFuture = bDone.get_future();
+    // a blocks until b has run; this only completes if the strands run concurrently.
+    a->post([&] {
+        aStarted.set_value();
+        bDoneFuture.wait();
+    });
+    aStarted.get_future().wait();
+    b->post([&] { bDone.set_value(); });
+    pool.stop();
+    SUCCEED();
+}
+
+} // namespace whot::utils
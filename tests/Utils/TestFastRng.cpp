@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include "Utils/FastRng.hpp"
+#include <set>
+
+namespace whot::utils {
+
+TEST(TestFastRng, SameSeed_SameSequence) {
+    FastRng a(42);
+    FastRng b(42);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(a(), b());
+}
+
+TEST(TestFastRng, Reseed_RestartsSequence) {
+    FastRng rng(7);
+    uint64_t first = rng();
+    rng();
+    rng.seed(7);
+    EXPECT_EQ(rng(), first);
+}
+
+TEST(TestFastRng, Below_StaysInRange) {
+    FastRng rng(1);
+    std::set<uint32_t> seen;
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t v = rng.below(6);
+        EXPECT_LT(v, 6u);
+        seen.insert(v);
+    }
+    EXPECT_EQ(seen.size(), 6u);
+}
+
+TEST(TestFastRng, FreshSeed_Distinct) {
+    std::set<uint64_t> seeds;
+    for (int i = 0; i < 100; ++i) seeds.insert(FastRng::freshSeed());
+    EXPECT_EQ(seeds.size(), 100u);
+}
+
+} // namespace whot::utils
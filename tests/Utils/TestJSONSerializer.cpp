@@ -96,4 +96,21 @@ TEST(TestJSONSerializer, Unescape_NotQuoted_ReturnsSame) {
     EXPECT_EQ(JsonSerializer::unescape(s), s);
 }
 
+TEST(TestJSONSerializer, JsonWriter_NestedRawAndEscaping) {
+    std::string out;
+    JsonWriter w(out);
+    w.beginObject();
+    w.key("s").value("q\"\\\n\x01");
+    w.key("n").value(-12);
+    w.key("u").value(uint64_t{18446744073709551615ULL});
+    w.key("b").value(false);
+    w.key("a").beginArray().value(1).null().raw("{\"x\":[]}").endArray();
+    w.key("e").beginObject().endObject();
+    w.endObject();
+    EXPECT_EQ(out, "{\"s\":\"q\\\"\\\\\\n\\u0001\",\"n\":-12,"
+                   "\"u\":18446744073709551615,\"b\":false,"
+                   "\"a\":[1,null,{\"x\":[]}],\"e\":{}}");
+    EXPECT_TRUE(JsonSerializer::isValidJson(out));
+}
+
 } // namespace whot::utils
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "Utils/Random.hpp"
+#include <cctype>
+#include <limits>
+#include <thread>
+#include <vector>
 
 namespace whot::utils {
 
@@ -74,4 +78,57 @@ TEST(TestRandom, GenerateUUID_Format) {
     EXPECT_EQ(u[13], '-');
 }
 
+TEST(TestRandom, GenerateUUID_LowercaseHex) {
+    Random& R = Random::getInstance();
+    R.seed(6);
+    std::string u = R.generateUUID();
+    for (size_t i = 0; i < u.size(); ++i) {
+        if (i == 8 || i == 13 || i == 18 || i == 23) {
+            EXPECT_EQ(u[i], '-');
+        } else {
+            EXPECT_TRUE(std::isxdigit(static_cast<unsigned char>(u[i])) && !std::isupper(static_cast<unsigned char>(u[i])));
+        }
+    }
+}
+
+TEST(TestRandom, Seed_OtherThreadsGetDistinctDeterministicStreams) {
+    Random& R = Random::getInstance();
+    auto drawOnThread = [&R] {
+        std::vector<int> out;
+        std::thread t([&] {
+            for (int i = 0; i < 8; ++i) out.push_back(R.nextInt(0, 1 << 20));
+        });
+        t.join();
+        return out;
+    };
+    R.seed(77);
+    std::vector<int> mainFirst;
+    for (int i = 0; i < 8; ++i) mainFirst.push_back(R.nextInt(0, 1 << 20));
+    std::vector<int> workerFirst = drawOnThread();
+    EXPECT_NE(mainFirst, workerFirst);
+
+    R.seed(77);
+    std::vector<int> mainSecond;
+    for (int i = 0; i < 8; ++i) mainSecond.push_back(R.nextInt(0, 1 << 20));
+    EXPECT_EQ(mainFirst, mainSecond);
+    EXPECT_EQ(drawOnThread(), workerFirst);
+}
+
+TEST(TestRandom, SeedStream_PinsSequence) {
+    Random& R = Random::getInstance();
+    R.seed(8);
+    R.seedStream(3);
+    int a = R.nextInt(0, 1 << 20);
+    R.seedStream(3);
+    EXPECT_EQ(R.nextInt(0, 1 << 20), a);
+}
+
+TEST(TestRandom, NextInt_FullRange) {
+    Random& R = Random::getInstance();
+    R.seed(9);
+    for (int i = 0; i < 20; ++i)
+        (void)R.nextInt(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    SUCCEED();
+}
+
 } // namespace whot::utils
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "Utils/TimerQueue.hpp"
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace whot::utils {
+
+using namespace std::chrono_literals;
+
+TEST(TestTimerQueue, NotRunning_FiresInline) {
+    TimerQueue timers;
+    bool fired = false;
+    TimerQueue::TimerId id = timers.schedule(5000ms, [&] { fired = true; });
+    EXPECT_TRUE(fired);
+    EXPECT_EQ(id, 0u);
+    EXPECT_EQ(timers.pendingCount(), 0u);
+}
+
+TEST(TestTimerQueue, Running_FiresAfterDelay) {
+    TimerQueue timers;
+    timers.start();
+    std::promise<TimerQueue::Clock::time_point> firedAt;
+    auto future = firedAt.get_future();
+    const auto scheduledAt = TimerQueue::Clock::now();
+    timers.schedule(30ms, [&] { firedAt.set_value(TimerQueue::Clock::now()); });
+    ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+    EXPECT_GE(future.get() - scheduledAt, 30ms);
+    timers.stop();
+}
+
+TEST(TestTimerQueue, Running_FiresInDeadlineOrder) {
+    TimerQueue timers;
+    timers.start();
+    std::mutex m;
+    std::vector<int> order;
+    std::promise<void> done;
+    timers.schedule(60ms, [&] {
+        std::lock_guard<std::mutex> lock(m);
+        order.push_back(3);
+        done.set_value();
+    });
+    timers.schedule(40ms, [&] { std::lock_guard<std::mutex> lock(m); order.push_back(2); });
+    timers.schedule(20ms, [&] { std::lock_guard<std::mutex> lock(m); order.push_back(1); });
+    ASSERT_EQ(done.get_future().wait_for(2s), std::future_status::ready);
+    timers.stop();
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+    EXPECT_EQ(order[2], 3);
+}
+
+TEST(TestTimerQueue, Cancel_PreventsFiring) {
+    TimerQueue timers;
+    timers.start();
+    bool cancelledFired = false;
+    std::promise<void> done;
+    TimerQueue::TimerId id = timers.schedule(20ms, [&] { cancelledFired = true; });
+    EXPECT_TRUE(timers.cancel(id));
+    EXPECT_FALSE(timers.cancel(id));
+    timers.schedule(50ms, [&] { done.set_value(); });
+    ASSERT_EQ(done.get_future().wait_for(2s), std::future_status::ready);
+    timers.stop();
+    EXPECT_FALSE(cancelledFired);
+}
+
+TEST(TestTimerQueue, Stop_DropsPendingTimers) {
+    TimerQueue timers;
+    timers.start();
+    timers.schedule(10s, [] {});
+    EXPECT_EQ(timers.pendingCount(), 1u);
+    timers.stop();
+    EXPECT_EQ(timers.pendingCount(), 0u);
+    EXPECT_FALSE(timers.isRunning());
+}
+
+} // namespace whot::utils
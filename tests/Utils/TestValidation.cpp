@@ -71,4 +71,17 @@ TEST(TestValidation, ValidationResult) {
     EXPECT_FALSE(r.getErrorMessage().empty());
 }
 
+TEST(TestValidation, IsValidUtf8) {
+    EXPECT_TRUE(Validator::isValidUtf8(""));
+    EXPECT_TRUE(Validator::isValidUtf8("Ada"));
+    EXPECT_TRUE(Validator::isValidUtf8("Ad\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x83\x8F"));
+    EXPECT_FALSE(Validator::isValidUtf8("\xC3"));              // truncated
+    EXPECT_FALSE(Validator::isValidUtf8("\xC3\x41"));          // bad continuation
+    EXPECT_FALSE(Validator::isValidUtf8("\xC0\xAF"));          // overlong '/'
+    EXPECT_FALSE(Validator::isValidUtf8("\xE0\x80\xAF"));      // overlong
+    EXPECT_FALSE(Validator::isValidUtf8("\xED\xA0\x80"));      // surrogate
+    EXPECT_FALSE(Validator::isValidUtf8("\xF4\x90\x80\x80"));  // above U+10FFFF
+    EXPECT_FALSE(Validator::isValidUtf8("\xFF"));
+}
+
 } // namespace whot::utils
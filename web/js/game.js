@@ -1,9 +1,243 @@
+/**
+ * Binary wire protocol "whot.bin.1", offered as a WebSocket subprotocol.
+ * Frame: varint type, format byte (0 = JSON text payload, 1 = binary body),
+ * varint timestamp, playerId and gameId (varint length + UTF-8), payload.
+ * Cards are one byte: suit index in the top 3 bits, face value in the low 5.
+ * Layouts mirror Message::encode, PlayCardPayload/JoinGamePayload::toBinary
+ * and GameState::toBinaryForPlayer on the server.
+ */
+const WhotBinaryProtocol = {
+    SUBPROTOCOL: 'whot.bin.1',
+    SUITS: ['CIRCLE', 'TRIANGLE', 'CROSS', 'BLOCK', 'STAR', 'WHOT'],
+    NONE: 0xFF,
+    textEncoder: new TextEncoder(),
+    textDecoder: new TextDecoder(),
+
+    writer() {
+        const bytes = [];
+        const enc = this.textEncoder;
+        return {
+            u8(v) { bytes.push(v & 0xFF); },
+            varint(v) {
+                let n = Math.max(0, Math.floor(v));
+                while (n >= 0x80) {
+                    bytes.push((n % 0x80) | 0x80);
+                    n = Math.floor(n / 0x80);
+                }
+                bytes.push(n);
+            },
+            str(s) {
+                const b = enc.encode(s || '');
+                this.varint(b.length);
+                for (const x of b) bytes.push(x);
+            },
+            raw(b) { for (const x of b) bytes.push(x); },
+            finish() { return new Uint8Array(bytes); }
+        };
+    },
+
+    reader(bytes) {
+        let pos = 0;
+        const dec = this.textDecoder;
+        return {
+            u8() {
+                if (pos >= bytes.length) throw new RangeError('truncated frame');
+                return bytes[pos++];
+            },
+            varint() {
+                // Numbers lose precision past 2^53; only timestamps get that large.
+                let value = 0;
+                let scale = 1;
+                for (let i = 0; i < 10; i++) {
+                    const b = this.u8();
+                    value += (b & 0x7F) * scale;
+                    if (!(b & 0x80)) return value;
+                    scale *= 0x80;
+                }
+                throw new RangeError('bad varint');
+            },
+            svarint() {
+                const raw = this.varint();
+                return raw % 2 ? -(raw + 1) / 2 : raw / 2;
+            },
+            str() {
+                const len = this.varint();
+                if (pos + len > bytes.length) throw new RangeError('truncated frame');
+                const s = dec.decode(bytes.subarray(pos, pos + len));
+                pos += len;
+                return s;
+            },
+            rest() {
+                const r = bytes.subarray(pos);
+                pos = bytes.length;
+                return r;
+            }
+        };
+    },
+
+    suitIndex(suit) {
+        const i = this.SUITS.indexOf(suit);
+        return i >= 0 ? i : this.NONE;
+    },
+
+    decodeCard(b) {
+        return b === this.NONE ? null : { suit: this.SUITS[b >> 5], value: String(b & 0x1F) };
+    },
+
+    /** Body for types the server reads as binary; null means send JSON text. */
+    encodePayload(type, payload) {
+        const w = this.writer();
+        switch (type) {
+            case 100: { // JOIN_GAME
+                w.str(payload.playerName);
+                w.str(payload.gameId);
+                w.u8((payload.gameCode ? 1 : 0) | (payload.password ? 2 : 0));
+                if (payload.gameCode) w.str(payload.gameCode);
+                if (payload.password) w.str(payload.password);
+                break;
+            }
+            case 102: // PLAY_CARD
+            case 106: { // CHOOSE_SUIT
+                const extra = Array.isArray(payload.additionalCards) ? payload.additionalCards : [];
+                w.varint(payload.cardIndex || 0);
+                w.u8(payload.chosenSuit ? this.suitIndex(payload.chosenSuit) : this.NONE);
+                w.u8(typeof payload.reverseDirection === 'boolean' ? Number(payload.reverseDirection) : this.NONE);
+                w.varint(extra.length);
+                extra.forEach((i) => w.varint(i));
+                break;
+            }
+            case 103: // DRAW_CARD
+            case 104: // DECLARE_LAST_CARD
+            case 105: // DECLARE_CHECK_UP
+                break;
+            default:
+                return null;
+        }
+        return w.finish();
+    },
+
+    encodeMessage(type, playerId, gameId, payload, timestamp) {
+        const body = this.encodePayload(type, payload || {});
+        const w = this.writer();
+        w.varint(type);
+        w.u8(body ? 1 : 0);
+        w.varint(timestamp);
+        w.str(playerId);
+        w.str(gameId);
+        w.raw(body || this.textEncoder.encode(JSON.stringify(payload || {})));
+        return w.finish();
+    },
+
+    /** Same shape as a parsed JSON frame; binary state arrives as payload.gameState. */
+    decodeMessage(buffer) {
+        const r = this.reader(new Uint8Array(buffer));
+        const message = { type: r.varint() };
+        const format = r.u8();
+        message.timestamp = r.varint();
+        message.playerId = r.str();
+        message.gameId = r.str();
+        const body = r.rest();
+        if (format === 0) {
+            message.payload = this.textDecoder.decode(body);
+        } else if (message.type === 200) { // GAME_STATE_UPDATE
+            message.payload = { gameState: this.decodeStateView(body) };
+        } else {
+            message.payload = {};
+        }
+        return message;
+    },
+
+    decodeStateView(body) {
+        const r = this.reader(body);
+        const version = r.u8();
+        if (version !== 1) throw new RangeError(`unknown state view version ${version}`);
+        const state = {
+            gameId: r.str(),
+            gameCode: r.str(),
+            creatorPlayerId: r.str(),
+            phase: r.u8(),
+            currentPlayerIndex: r.svarint(),
+            direction: r.u8() === 0 ? 'clockwise' : 'counter_clockwise',
+            activePickCount: r.varint()
+        };
+        const demandedSuit = r.u8();
+        if (demandedSuit !== this.NONE) state.demandedSuit = this.SUITS[demandedSuit];
+        const callCard = this.decodeCard(r.u8());
+        if (callCard) state.callCard = callCard;
+        state.deckSize = r.varint();
+        state.discardPileSize = r.varint();
+        const winnerId = r.str();
+        if (winnerId) state.winnerId = winnerId;
+        const count = r.varint();
+        state.players = [];
+        for (let i = 0; i < count; i++) {
+            const player = {
+                id: r.str(),
+                name: r.str(),
+                type: r.u8(),
+                status: r.u8(),
+                currentScore: r.svarint(),
+                cumulativeScore: r.svarint()
+            };
+            const flags = r.u8();
+            player.saidLastCard = !!(flags & 1);
+            player.saidCheckUp = !!(flags & 2);
+            player.gamesPlayed = r.varint();
+            player.gamesWon = r.varint();
+            const handSize = r.varint();
+            if (flags & 4) {
+                player.hand = [];
+                for (let c = 0; c < handSize; c++) player.hand.push(this.decodeCard(r.u8()));
+            } else {
+                player.hand = { count: handSize };
+            }
+            state.players.push(player);
+        }
+        return state;
+    }
+};
+
+/**
+ * Applies a GAME_STATE_PATCH (network::diffJson on the server). Objects merge
+ * key by key, null removes a key; arrays take {"$items": {index: patch}} or
+ * {"$splice": [start, deleteCount, items]}. Returns new objects along changed
+ * paths and leaves `base` untouched.
+ */
+const WhotStatePatch = {
+    apply(base, patch) {
+        if (patch === null || typeof patch !== 'object' || Array.isArray(patch)) return patch;
+        if (Array.isArray(base)) {
+            if (patch.$items) {
+                const next = base.slice();
+                for (const [index, itemPatch] of Object.entries(patch.$items)) {
+                    if (Number(index) < next.length) next[index] = this.apply(next[index], itemPatch);
+                }
+                return next;
+            }
+            if (Array.isArray(patch.$splice)) {
+                const [start, deleteCount, items] = patch.$splice;
+                const next = base.slice();
+                next.splice(start, deleteCount, ...items);
+                return next;
+            }
+        }
+        const next = base !== null && typeof base === 'object' && !Array.isArray(base) ? { ...base } : {};
+        for (const [key, value] of Object.entries(patch)) {
+            if (value === null) delete next[key];
+            else next[key] = this.apply(next[key], value);
+        }
+        return next;
+    }
+};
+
 class WhotGameClient {
     constructor() {
         this.ws = null;
         this.gameId = null;
         this.playerId = null;
         this.gameState = null;
+        this.stateSeq = 0;
+        this.resyncRequested = false;
         this.gameCode = null;
         this.pendingJoinPayload = null;
         this.pendingAutoStartBots = false;
@@ -94,7 +328,13 @@ class WhotGameClient {
             return;
         }
         const wsUrl = this.getWebSocketUrl();
-        this.ws = new WebSocket(wsUrl);
+        const runtimeConfig = (typeof window !== 'undefined' && window.WHOT_CONFIG) ? window.WHOT_CONFIG : {};
+        // Offer the binary protocol unless configured off; servers that do not
+        // select it keep talking JSON on the same socket.
+        this.ws = runtimeConfig.wsProtocol === 'json'
+            ? new WebSocket(wsUrl)
+            : new WebSocket(wsUrl, [WhotBinaryProtocol.SUBPROTOCOL]);
+        this.ws.binaryType = 'arraybuffer';
         
         this.ws.onopen = () => {
             console.log('Connected to server');
@@ -104,7 +344,8 @@ class WhotGameClient {
             if (!this.pendingJoinPayload && this.gameId && this.playerId) {
                 this.sendMessage(100, {
                     playerName: this.getPlayerName(),
-                    gameId: this.gameId
+                    gameId: this.gameId,
+                    statePatches: true
                 });
             }
             // If a bot game reconnects while still in lobby phase, allow one
@@ -116,7 +357,15 @@ class WhotGameClient {
         };
         
         this.ws.onmessage = (event) => {
-            const message = JSON.parse(event.data);
+            let message;
+            try {
+                message = typeof event.data === 'string'
+                    ? JSON.parse(event.data)
+                    : WhotBinaryProtocol.decodeMessage(event.data);
+            } catch (e) {
+                console.error('Dropped malformed frame:', e);
+                return;
+            }
             this.handleMessage(message);
         };
         
@@ -154,11 +403,18 @@ class WhotGameClient {
             case 208: // ERROR
                 this.handleError(message);
                 break;
+            case 210: // GAME_STATE_PATCH
+                this.applyStatePatch(message);
+                break;
         }
     }
     
     sendMessage(type, payload) {
         if (this.ws && this.ws.readyState === WebSocket.OPEN) {
+            if (this.ws.protocol === WhotBinaryProtocol.SUBPROTOCOL) {
+                this.ws.send(WhotBinaryProtocol.encodeMessage(type, this.playerId, this.gameId, payload, Date.now()));
+                return;
+            }
             const message = {
                 type: type,
                 playerId: this.playerId,
@@ -252,7 +508,8 @@ class WhotGameClient {
     sendJoinGameMessage() {
         const payload = {
             playerName: this.getPlayerName(),
-            gameId: this.gameId
+            gameId: this.gameId,
+            statePatches: true
         };
         if (!this.ws || this.ws.readyState !== WebSocket.OPEN) {
             this.pendingJoinPayload = payload;
@@ -371,10 +628,27 @@ class WhotGameClient {
         this.sendMessage(104, {}); // DECLARE_LAST_CARD
     }
     
+    applyStatePatch(message) {
+        const payload = typeof message.payload === 'string' ? JSON.parse(message.payload) : message.payload;
+        if (!this.gameState || payload.seq !== this.stateSeq + 1) {
+            // Missed an update: ask once for a snapshot and drop patches until it arrives.
+            if (!this.resyncRequested) {
+                this.resyncRequested = true;
+                this.sendMessage(110, {}); // STATE_RESYNC
+            }
+            return;
+        }
+        this.updateGameState({
+            payload: { seq: payload.seq, gameState: WhotStatePatch.apply(this.gameState, payload.patch) }
+        });
+    }
+
     updateGameState(message) {
+        // The server embeds the state as a JSON value, so the frame parse already built it.
         const payload = typeof message.payload === 'string' ? JSON.parse(message.payload) : message.payload;
-        const jsonStr = payload.gameStateJson || payload.gameState;
-        this.gameState = typeof jsonStr === 'string' ? JSON.parse(jsonStr) : jsonStr;
+        this.gameState = payload.gameState;
+        this.stateSeq = payload.seq || 0;
+        this.resyncRequested = false;
         if (this.gameState && this.gameState.gameCode) {
             this.gameCode = this.gameState.gameCode;
         }
@@ -819,6 +1093,7 @@ class WhotGameClient {
         this.gameId = null;
         this.playerId = null;
         this.gameState = null;
+        this.stateSeq = 0;
         this.gameCode = null;
         this.sessionMode = null;
         this.pendingAutoStartBots = false;
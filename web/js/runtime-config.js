@@ -3,8 +3,9 @@
  * - Local dev: leave unset; game.js uses current origin and /ws.
  * - Production (Railway/GitHub Pages): inject via runtime-config.injected.js
  *   or set window.WHOT_CONFIG before loading game.js.
- * Expected shape: { apiBase?: string, wsUrl?: string }
+ * Expected shape: { apiBase?: string, wsUrl?: string, wsProtocol?: "binary" | "json" }
  * - apiBase: e.g. "https://your-app.railway.app" (no trailing slash)
  * - wsUrl: e.g. "wss://your-app.railway.app/ws"
+ * - wsProtocol: "json" stops the client offering the binary subprotocol
  */
 window.WHOT_CONFIG = window.WHOT_CONFIG || {};